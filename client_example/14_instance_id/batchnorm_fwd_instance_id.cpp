@@ -5,6 +5,7 @@
 #include <numeric>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <vector>
 
 #include "ck/ck.hpp"
@@ -12,6 +13,7 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_forward.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
 
 using XDataType       = float;
 using YDataType       = float;
@@ -44,9 +46,9 @@ struct SimpleDeviceMem
     void* p_mem_;
 };
 
-// In the actual application, the instance index and name are usually from the perf db
-static int instance_index = -1;
-static std::string instance_name;
+// In the actual application, the instance id is usually from the perf db. Unlike the index of the
+// instance, it stays the same across builds of the instance library.
+static std::optional<uint64_t> instance_id;
 
 int main(int argc, char* argv[])
 {
@@ -90,8 +92,7 @@ int main(int argc, char* argv[])
     int best_op_index   = -1;
     float best_ave_time = std::numeric_limits<float>::max();
 
-    // profile device operation instances and save the best performant instance index and instance
-    // name
+    // profile device operation instances and save the id of the best performant instance
     std::cout << "Run all instances and do timing" << std::endl;
 
     for(int i = 0; i < op_ptrs.size(); ++i)
@@ -141,19 +142,16 @@ int main(int argc, char* argv[])
 
     if(found)
     {
-        instance_index = best_op_index;
-        instance_name  = op_ptrs[instance_index]->GetTypeIdHashCode();
+        instance_id = op_ptrs[best_op_index]->GetInstanceId();
     };
 
-    // simulate the execution of the operation when the instance index and name are available
-    const auto op_ptrs_2 = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
-
-    if(instance_index >= 0 && instance_index < op_ptrs_2.size())
+    // simulate the execution of the operation when the instance id is available
+    if(instance_id)
     {
-        auto& op_ptr = op_ptrs_2[instance_index];
+        const auto op_ptr =
+            ck::tensor_operation::device::instance::FindInstanceById<DeviceOp>(*instance_id);
 
-        if(op_ptr->GetTypeIdHashCode() == instance_name)
+        if(op_ptr)
         {
 
             auto argument_ptr = op_ptr->MakeArgumentPointer(xyLengths,
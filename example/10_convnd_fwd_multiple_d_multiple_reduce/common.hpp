@@ -25,6 +25,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 using BF16 = ck::bhalf_t;
 using FP16 = ck::half_t;
@@ -16,7 +16,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_quantization.hpp"
 #include "ck/library/utility/check_err.hpp"
 
 template <ck::index_t... Is>
@@ -94,13 +94,8 @@ using DeviceGemmInstance = ck::tensor_operation::device::DeviceGemmMultipleD_Xdl
      8>;                         // index_t CShuffleBlockTransferScalarPerVector_NPerBlock>
 // clang-format on
 
-using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                        BDataType,
-                                                                        AccDataType,
-                                                                        AccDataType,
-                                                                        PassThrough,
-                                                                        PassThrough,
-                                                                        PassThrough>;
+using ReferenceGemmInstance =
+    ck::tensor_operation::host::ReferenceGemmQuantization<EDataType, CDEElementOp, BiasDataType>;
 
 int main()
 {
@@ -210,24 +205,17 @@ int main()
 
     if(do_verification)
     {
-        Tensor<AccDataType> c_m_n(HostTensorDescriptor{M, N});
-
         auto ref_gemm    = ReferenceGemmInstance{};
         auto ref_invoker = ref_gemm.MakeInvoker();
 
+        const auto bias_m_n =
+            TensorView<const BiasDataType>{bias_n}.Broadcast(e_m_n_host_result.GetLengths());
+
         auto ref_argument =
-            ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, PassThrough{});
+            ref_gemm.MakeArgument(a_m_k, b_k_n, {bias_m_n}, e_m_n_host_result, cde_element_op);
 
         ref_invoker.Run(ref_argument);
 
-        for(int m = 0; m < M; ++m)
-        {
-            for(int n = 0; n < N; ++n)
-            {
-                cde_element_op(e_m_n_host_result(m, n), c_m_n(m, n), bias_n(n));
-            }
-        }
-
         return ck::utils::check_err(e_m_n_device_result, e_m_n_host_result) ? 0 : 1;
     }
 
@@ -15,6 +15,7 @@
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 
@@ -206,8 +207,6 @@ auto run_gemm_reduce_max_xdl(ck::index_t M,
 
     if(do_verification)
     {
-        auto I0 = ck::Number<0>{};
-
         Tensor<ReduceAccDataType> e_m_n_host(e_m_n.mDesc);
         Tensor<R0DataType> r0_m_host(r0_m.mDesc);
 
@@ -219,20 +218,18 @@ auto run_gemm_reduce_max_xdl(ck::index_t M,
 
         ref_invoker.Run(ref_argument);
 
-        auto reduce0_op = RsThreadReduceOp{}[I0];
-
-        for(int m = 0; m < M; ++m)
-        {
-            auto reduce0_acc = reduce0_op.template GetIdentityValue<ReduceAccDataType>();
+        using ReferenceReduceInstance =
+            ck::tensor_operation::host::ReferenceMultipleReduce<ReduceAccDataType,
+                                                                ReduceAccDataType,
+                                                                ck::Tuple<R0DataType>,
+                                                                RsThreadReduceOp,
+                                                                QsElementOp,
+                                                                RsElementOp>;
 
-            for(int n = 0; n < N; ++n)
-            {
-                auto e_val = e_m_n_host(m, n);
-                reduce0_op(reduce0_acc, e_val);
-            };
+        auto ref_reduce = ReferenceReduceInstance{};
 
-            r0_m_host(m) = ck::type_convert<R0DataType>(reduce0_acc);
-        }
+        ref_reduce.MakeInvoker().Run(ref_reduce.MakeArgument(
+            e_m_n_host, {r0_m_host}, {1}, qs_element_op, rs_element_op));
 
         e_device_buf.FromDevice(e_m_n.mData.data());
         Tensor<EDataType> e_m_n_host_converted(e_m_n_host);
@@ -410,9 +407,6 @@ bool run_gemm_reduce_mean_meansquare_xdl(ck::index_t M,
 
     if(do_verification)
     {
-        auto I0 = ck::Number<0>{};
-        auto I1 = ck::Number<1>{};
-
         Tensor<ReduceAccDataType> e_m_n_host(e_m_n.mDesc);
         Tensor<R0DataType> r0_m_host(r0_m.mDesc);
         Tensor<R1DataType> r1_m_host(r1_m.mDesc);
@@ -425,29 +419,19 @@ bool run_gemm_reduce_mean_meansquare_xdl(ck::index_t M,
 
         ref_invoker.Run(ref_argument);
 
-        auto reduce0_op = RsThreadReduceOp{}[I0];
-        auto reduce1_op = RsThreadReduceOp{}[I1];
+        using ReferenceReduceInstance =
+            ck::tensor_operation::host::ReferenceMultipleReduce<ReduceAccDataType,
+                                                                ReduceAccDataType,
+                                                                ck::Tuple<R0DataType, R1DataType>,
+                                                                RsThreadReduceOp,
+                                                                QsElementOp,
+                                                                RsElementOp>;
 
-        for(int m = 0; m < M; ++m)
-        {
-            auto reduce0_acc = reduce0_op.template GetIdentityValue<ReduceAccDataType>();
-            auto reduce1_acc = reduce1_op.template GetIdentityValue<ReduceAccDataType>();
+        auto ref_reduce = ReferenceReduceInstance{};
 
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType square_e_val;
-                auto e_val = ck::type_convert<ReduceAccDataType>(e_m_n_host(m, n));
-                qs_element_op[I1](square_e_val, e_val);
+        ref_reduce.MakeInvoker().Run(ref_reduce.MakeArgument(
+            e_m_n_host, {r0_m_host, r1_m_host}, {1}, qs_element_op, rs_element_op));
 
-                reduce0_op(reduce0_acc, e_val);
-                reduce1_op(reduce1_acc, square_e_val);
-            }
-
-            rs_element_op[I0](reduce0_acc, reduce0_acc);
-            rs_element_op[I1](reduce1_acc, reduce1_acc);
-            r0_m_host(m) = ck::type_convert<R0DataType>(reduce0_acc);
-            r1_m_host(m) = ck::type_convert<R1DataType>(reduce1_acc);
-        }
         e_device_buf.FromDevice(e_m_n.mData.data());
         Tensor<EDataType> e_m_n_host_converted(e_m_n_host);
 
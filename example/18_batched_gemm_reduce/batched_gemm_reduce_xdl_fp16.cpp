@@ -18,6 +18,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 template <ck::index_t... Is>
 using S = ck::Sequence<Is...>;
@@ -265,33 +266,22 @@ int main(int argc, char* argv[])
 
         ref_invoker.Run(ref_argument);
 
-        auto reduce0_op = ReduceOp0{};
-        auto reduce1_op = ReduceOp1{};
-
-        for(int batch = 0; batch < BatchCount; ++batch)
-        {
-            for(int m = 0; m < M; ++m)
-            {
-                auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
-                auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto c_val =
-                        ck::type_convert<ReduceAccDataType>(c_g_m_n_host_result(batch, m, n));
-                    ReduceAccDataType d0_val;
-                    ReduceAccDataType d1_val;
-
-                    UnaryIdenticElementOp{}(d0_val, c_val);
-                    UnarySquareElementOp{}(d1_val, c_val);
-                    reduce0_op(reduce0_acc, d0_val);
-                    reduce1_op(reduce1_acc, d1_val);
-                }
-
-                d0_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce0_acc);
-                d1_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce1_acc);
-            }
-        }
+        using ReferenceReduceInstance = ck::tensor_operation::host::ReferenceMultipleReduce<
+            CDataType,
+            ReduceAccDataType,
+            ck::Tuple<ReduceDataType, ReduceDataType>,
+            ReduceOps,
+            ReduceInElementOps,
+            ReduceOutElementOps>;
+
+        auto ref_reduce = ReferenceReduceInstance{};
+
+        ref_reduce.MakeInvoker().Run(
+            ref_reduce.MakeArgument(c_g_m_n_host_result,
+                                    {d0_g_m_host_result, d1_g_m_host_result},
+                                    {2},
+                                    ReduceInElementOps{},
+                                    ReduceOutElementOps{}));
 
         pass = ck::utils::check_err(
                    c_g_m_n_host_result, c_g_m_n_device_result, "Error: Incorrect results c") &&
@@ -8,6 +8,7 @@
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_elementwise.hpp"
 
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -31,36 +32,10 @@ using DeviceElementwiseAddInstance =
                                                     ck::Sequence<8, 8>,
                                                     ck::Sequence<8>>;
 
-template <typename HostTensorA,
-          typename HostTensorB,
-          typename HostTensorC,
-          typename Functor,
-          int broadcastDim>
-void host_broadcast2D(
-    HostTensorC& C, const HostTensorA& A, const HostTensorB& B, int M, int N, Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0))>;
-
-    for(int m = 0; m < M; ++m)
-    {
-        for(int n = 0; n < N; ++n)
-        {
-            auto Amn  = A(m, n);
-            ctype Cmn = 0;
-            if constexpr(broadcastDim == 0)
-            {
-                auto Bn = B(n);
-                functor(Cmn, Amn, Bn);
-            }
-            else
-            {
-                auto Bm = B(m);
-                functor(Cmn, Amn, Bm);
-            }
-            C(m, n) = Cmn;
-        }
-    }
-}
+using ReferenceElementwiseAddInstance =
+    ck::tensor_operation::host::ReferenceElementwise<ck::Tuple<ABDataType, ABDataType>,
+                                                     ck::Tuple<CDataType>,
+                                                     Add>;
 
 int main()
 {
@@ -126,8 +101,14 @@ int main()
         c_m_n_device_buf.FromDevice(c_m_n.mData.data());
         Tensor<CDataType> host_c_m_n(f_host_tensor_descriptor2d(M, N, Stride));
 
-        host_broadcast2D<Tensor<ABDataType>, Tensor<ABDataType>, Tensor<CDataType>, Add, 0>(
-            host_c_m_n, a_m_n, b_n, M, N, Add{});
+        // b(n) broadcast along m
+        const auto b_m_n = make_tensor_view(b_n).Broadcast(host_c_m_n.GetLengths());
+
+        auto ref_elementwise = ReferenceElementwiseAddInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument    = ref_elementwise.MakeArgument({a_m_n, b_m_n}, {host_c_m_n}, Add{});
+
+        ref_invoker.Run(ref_argument);
 
         pass &= ck::utils::check_err(c_m_n, host_c_m_n, "Error: Incorrect results c", 1e-3, 1e-3);
     }
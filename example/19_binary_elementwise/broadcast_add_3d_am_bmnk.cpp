@@ -8,6 +8,7 @@
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_elementwise.hpp"
 
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
@@ -31,26 +32,10 @@ using DeviceElementwiseAddInstance =
                                                     ck::Sequence<1, 8>,
                                                     ck::Sequence<8>>;
 
-template <typename HostTensorA, typename HostTensorB, typename HostTensorC, typename Functor>
-void host_broadcast3D_am_bmnk(HostTensorC& C,
-                              const HostTensorA& A,
-                              const HostTensorB& B,
-                              const std::vector<std::size_t>& shape,
-                              Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0))>;
-
-    for(std::size_t m = 0; m < shape[0]; ++m)
-        for(std::size_t n = 0; n < shape[1]; ++n)
-            for(std::size_t k = 0; k < shape[2]; ++k)
-            {
-                auto a_val  = A(m);
-                auto b_val  = B(m, n, k);
-                ctype c_val = 0;
-                functor(c_val, a_val, b_val);
-                C(m, n, k) = c_val;
-            }
-}
+using ReferenceElementwiseAddInstance =
+    ck::tensor_operation::host::ReferenceElementwise<ck::Tuple<ABDataType, ABDataType>,
+                                                     ck::Tuple<CDataType>,
+                                                     Add>;
 
 int main()
 {
@@ -109,8 +94,15 @@ int main()
         c_m_n_k_device_buf.FromDevice(c_m_n_k.mData.data());
         Tensor<CDataType> host_c_m_n_k(mnk);
 
-        host_broadcast3D_am_bmnk<Tensor<ABDataType>, Tensor<ABDataType>, Tensor<CDataType>, Add>(
-            host_c_m_n_k, a_m, b_m_n_k, mnk, Add{});
+        // a(m) broadcast along n and k
+        const auto a_m_n_k = make_tensor_view(a_m).Reshape({mnk[0], 1, 1}).Broadcast(mnk);
+
+        auto ref_elementwise = ReferenceElementwiseAddInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument =
+            ref_elementwise.MakeArgument({a_m_n_k, b_m_n_k}, {host_c_m_n_k}, Add{});
+
+        ref_invoker.Run(ref_argument);
 
         pass &=
             ck::utils::check_err(c_m_n_k, host_c_m_n_k, "Error: Incorrect results c", 1e-3, 1e-3);
@@ -7,6 +7,7 @@
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_elementwise.hpp"
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -29,21 +30,10 @@ using DeviceElementwiseAddInstance =
                                                     ck::Sequence<8, 8>,
                                                     ck::Sequence<8>>;
 
-template <typename HostTensorA, typename HostTensorB, typename HostTensorC, typename Functor>
-void host_elementwise1D(
-    HostTensorC& C, const HostTensorA& A, const HostTensorB& B, int M, Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0))>;
-
-    for(int m = 0; m < M; ++m)
-    {
-        auto Am  = A(m);
-        auto Bm  = B(m);
-        ctype Cm = 0;
-        functor(Cm, Am, Bm);
-        C(m) = Cm;
-    }
-}
+using ReferenceElementwiseAddInstance =
+    ck::tensor_operation::host::ReferenceElementwise<ck::Tuple<ABDataType, ABDataType>,
+                                                     ck::Tuple<CDataType>,
+                                                     Add>;
 
 int main()
 {
@@ -101,8 +91,11 @@ int main()
         c_m_device_buf.FromDevice(c_m.mData.data());
         Tensor<CDataType> host_c_m(f_host_tensor_descriptor1d(M, 1));
 
-        host_elementwise1D<Tensor<ABDataType>, Tensor<ABDataType>, Tensor<CDataType>, Add>(
-            host_c_m, a_m, b_m, M, Add{});
+        auto ref_elementwise = ReferenceElementwiseAddInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument    = ref_elementwise.MakeArgument({a_m, b_m}, {host_c_m}, Add{});
+
+        ref_invoker.Run(ref_argument);
 
         pass &= ck::utils::check_err(c_m, host_c_m, "Error: Incorrect results c", 1e-3, 1e-3);
     }
@@ -9,6 +9,7 @@
 #include "ck/tensor_operation/gpu/device/impl/device_elementwise.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -31,27 +32,10 @@ using DeviceElementwiseAddInstance =
                                                     ck::Sequence<8, 8>,
                                                     ck::Sequence<8>>;
 
-template <typename HostTensorA, typename HostTensorB, typename HostTensorC, typename Functor>
-void host_elementwise4D(HostTensorC& C,
-                        const HostTensorA& A,
-                        const HostTensorB& B,
-                        const std::vector<std::size_t>& shape,
-                        Functor functor)
-{
-    using ctype = ck::remove_reference_t<decltype(C(0, 0, 0, 0))>;
-
-    for(std::size_t n = 0; n < shape[0]; ++n)
-        for(std::size_t c = 0; c < shape[1]; ++c)
-            for(std::size_t h = 0; h < shape[2]; ++h)
-                for(std::size_t w = 0; w < shape[3]; ++w)
-                {
-                    auto a_val  = A(n, c, h, w);
-                    auto b_val  = B(n, c, h, w);
-                    ctype c_val = 0;
-                    functor(c_val, a_val, b_val);
-                    C(n, c, h, w) = c_val;
-                }
-}
+using ReferenceElementwiseAddInstance =
+    ck::tensor_operation::host::ReferenceElementwise<ck::Tuple<ABDataType, ABDataType>,
+                                                     ck::Tuple<CDataType>,
+                                                     Add>;
 
 int main()
 {
@@ -110,8 +94,11 @@ int main()
         c_device_buf.FromDevice(c.mData.data());
         Tensor<CDataType> host_c(nchw);
 
-        host_elementwise4D<Tensor<ABDataType>, Tensor<ABDataType>, Tensor<CDataType>, Add>(
-            host_c, a, b, nchw, Add{});
+        auto ref_elementwise = ReferenceElementwiseAddInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument    = ref_elementwise.MakeArgument({a, b}, {host_c}, Add{});
+
+        ref_invoker.Run(ref_argument);
 
         pass &= ck::utils::check_err(c, host_c, "Error: Incorrect results c", 1e-3, 1e-3);
     }
@@ -18,6 +18,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 static struct option long_options[] = {{"inLengths", required_argument, nullptr, 'D'},
                                        {"verify", required_argument, nullptr, 'v'},
@@ -115,63 +116,6 @@ class SimpleAppArgs
     };
 };
 
-template <typename InDataType, typename OutDataType1, typename OutDataType2, typename AccDataType>
-static void mean_meansquare_host(const Tensor<InDataType>& in,
-                                 Tensor<OutDataType1>& mean_ref,
-                                 Tensor<OutDataType2>& meansquare_ref,
-                                 size_t n,
-                                 size_t h,
-                                 size_t w,
-                                 size_t c)
-
-{
-    auto thread_reduce_func = [&](auto iN) {
-        AccDataType mean       = ck::type_convert<AccDataType>(0.0f);
-        AccDataType meansquare = ck::type_convert<AccDataType>(0.0f);
-
-        // compute mean, meanquare, variance, invVariance
-        for(std::size_t iH = 0; iH < h; iH++)
-        {
-            for(std::size_t iW = 0; iW < w; iW++)
-            {
-                for(std::size_t iC = 0; iC < c; iC++)
-                {
-                    AccDataType curr_value = ck::type_convert<AccDataType>(in(iN, iH, iW, iC));
-
-                    mean += curr_value;
-                    meansquare += curr_value * curr_value;
-                };
-            }
-        };
-
-        mean       = mean / (h * w * c);
-        meansquare = meansquare / (h * w * c);
-
-        mean_ref(iN)       = ck::type_convert<OutDataType1>(mean);
-        meansquare_ref(iN) = ck::type_convert<OutDataType2>(meansquare);
-    };
-
-    std::size_t num_thread      = std::thread::hardware_concurrency();
-    std::size_t work_per_thread = (n + num_thread - 1) / num_thread;
-
-    std::vector<joinable_thread> threads(num_thread);
-
-    for(std::size_t it = 0; it < num_thread; it++)
-    {
-        std::size_t iN_begin = it * work_per_thread;
-        std::size_t iN_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread), n);
-
-        auto f = [=] {
-            for(std::size_t iN = iN_begin; iN < iN_end; iN++)
-            {
-                thread_reduce_func(iN);
-            }
-        };
-
-        threads[it] = joinable_thread(f);
-    }
-};
-
 using ReduceOperation = ck::reduce::Add;
 
 using InElementwiseOperation_Mean  = ck::tensor_operation::element_wise::PassThrough;
@@ -242,8 +186,26 @@ int mean_meansquare_dual_reduce_test(size_t n,
 
     if(do_verification)
     {
-        mean_meansquare_host<InDataType, OutDataType, OutDataType, AccDataType>(
-            in, mean_ref, meansquare_ref, n, h, w, c);
+        using ReferenceDualReduce = ck::tensor_operation::host::ReferenceMultipleReduce<
+            InDataType,
+            AccDataType,
+            ck::Tuple<OutDataType, OutDataType>,
+            ck::Tuple<ReduceOperation, ReduceOperation>,
+            InElementwiseOperationTuple,
+            AccElementwiseOperationTuple>;
+
+        auto ref_dual_reduce = ReferenceDualReduce{};
+
+        auto ref_argument = ref_dual_reduce.MakeArgument(
+            in,
+            {mean_ref, meansquare_ref},
+            std::vector<int>(reduceDims.begin(), reduceDims.end()),
+            ck::make_tuple(InElementwiseOperation_Mean{}, InElementwiseOperation_Meansquare{}),
+            ck::make_tuple(
+                AccElementwiseOperation_Mean{static_cast<int32_t>(reduce_total_length)},
+                AccElementwiseOperation_Meansquare{static_cast<int32_t>(reduce_total_length)}));
+
+        ref_dual_reduce.MakeInvoker().Run(ref_argument);
     };
 
     constexpr ck::index_t NumInputDim  = Rank;
@@ -14,7 +14,7 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_quantization.hpp"
 
 using InDataType           = int8_t;
 using WeiDataType          = int8_t;
@@ -219,35 +219,26 @@ bool run_grouped_conv_fwd(bool do_verification,
 
     if(do_verification)
     {
-        Tensor<CShuffleDataType> c_host(out_g_n_k_wos_desc);
-
-        auto ref_conv = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
-                                                                     InDataType,
-                                                                     WeiDataType,
-                                                                     CShuffleDataType,
-                                                                     InElementOp,
-                                                                     WeiElementOp,
-                                                                     PassThrough>();
+        auto ref_conv =
+            ck::tensor_operation::host::ReferenceConvFwdQuantization<NDimSpatial,
+                                                                     OutDataType,
+                                                                     OutElementOp,
+                                                                     BiasDataType,
+                                                                     RequantScaleDataType>();
 
         auto ref_invoker  = ref_conv.MakeInvoker();
         auto ref_argument = ref_conv.MakeArgument(in,
                                                   wei,
-                                                  c_host,
+                                                  {bias, requant_scale},
+                                                  out_host,
                                                   conv_param.conv_filter_strides_,
                                                   conv_param.conv_filter_dilations_,
                                                   conv_param.input_left_pads_,
                                                   conv_param.input_right_pads_,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  PassThrough{});
+                                                  out_element_op);
 
         ref_invoker.Run(ref_argument);
 
-        // TODO: implement elementwise operation for host
-        out_host.ForEach([&](auto&, auto idx) {
-            out_element_op(out_host(idx), c_host(idx), bias(idx), requant_scale(idx));
-        });
-
         out_device_buf.FromDevice(out_device.mData.data());
 
         pass &=
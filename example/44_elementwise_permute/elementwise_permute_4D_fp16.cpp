@@ -5,6 +5,7 @@
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_elementwise.hpp"
 
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
@@ -27,18 +28,9 @@ using DeviceElementwisePermuteInstance =
                                                     ck::Sequence<8>,
                                                     ck::Sequence<1>>;
 
-template <typename HostTensorA, typename HostTensorB, typename Functor>
-void host_elementwise4D(HostTensorB& B_nhwc, const HostTensorA& A_nchw, Functor functor)
-{
-    for(std::size_t n = 0; n < A_nchw.mDesc.GetLengths()[0]; ++n)
-        for(std::size_t c = 0; c < A_nchw.mDesc.GetLengths()[1]; ++c)
-            for(std::size_t h = 0; h < A_nchw.mDesc.GetLengths()[2]; ++h)
-                for(std::size_t w = 0; w < A_nchw.mDesc.GetLengths()[3]; ++w)
-                {
-                    auto a_val = A_nchw(n, c, h, w);
-                    functor(B_nhwc(n, h, w, c), a_val);
-                }
-}
+using ReferenceElementwisePermuteInstance =
+    ck::tensor_operation::host::
+        ReferenceElementwise<ck::Tuple<ADataType>, ck::Tuple<BDataType>, PassThrough>;
 
 int main()
 {
@@ -106,7 +98,14 @@ int main()
     {
         b_device_buf.FromDevice(b.mData.data());
         Tensor<BDataType> host_b(nhwc);
-        host_elementwise4D(host_b, a, PassThrough{});
+
+        // write through an NCHW-ordered view of the NHWC result
+        auto ref_elementwise = ReferenceElementwisePermuteInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument    = ref_elementwise.MakeArgument(
+            {a}, {make_tensor_view(host_b).Permute({0, 3, 1, 2})}, PassThrough{});
+
+        ref_invoker.Run(ref_argument);
 
         pass &=
             ck::utils::check_err(b.mData, host_b.mData, "Error: Incorrect results b", 1e-3, 1e-3);
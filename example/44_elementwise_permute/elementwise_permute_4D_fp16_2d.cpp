@@ -5,6 +5,7 @@
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_elementwise_2d.hpp"
 
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -27,21 +28,9 @@ using DeviceElementwisePermuteInstance =
                                                     ck::Sequence<8>,
                                                     ck::Sequence<8>>;
 
-template <typename HostTensorA, typename HostTensorB, typename Functor>
-void host_elementwise4D(HostTensorB& B_nhwc,
-                        const HostTensorA& A_nchw,
-                        const std::vector<std::size_t>& shape_nchw,
-                        Functor functor)
-{
-    for(std::size_t n = 0; n < shape_nchw[0]; ++n)
-        for(std::size_t c = 0; c < shape_nchw[1]; ++c)
-            for(std::size_t h = 0; h < shape_nchw[2]; ++h)
-                for(std::size_t w = 0; w < shape_nchw[3]; ++w)
-                {
-                    auto a_val = A_nchw(n, c, h, w);
-                    functor(B_nhwc(n, h, w, c), a_val);
-                }
-}
+using ReferenceElementwisePermuteInstance =
+    ck::tensor_operation::host::
+        ReferenceElementwise<ck::Tuple<ADataType>, ck::Tuple<BDataType>, PassThrough>;
 
 int main()
 {
@@ -118,8 +107,13 @@ int main()
         // LogRangeAsType<float>(std::cout << "Tensor b  : ", b.mData, ",") << std::endl;
 
         Tensor<BDataType> host_b(nhwc);
-        host_elementwise4D<Tensor<ADataType>, Tensor<BDataType>, PassThrough>(
-            host_b, a, nchw, PassThrough{});
+        // write through an NCHW-ordered view of the NHWC result
+        auto ref_elementwise = ReferenceElementwisePermuteInstance{};
+        auto ref_invoker     = ref_elementwise.MakeInvoker();
+        auto ref_argument    = ref_elementwise.MakeArgument(
+            {a}, {make_tensor_view(host_b).Permute({0, 3, 1, 2})}, PassThrough{});
+
+        ref_invoker.Run(ref_argument);
 
         // LogRangeAsType<float>(std::cout << "Host b  : ", host_b.mData, ",") << std::endl;
         pass &=
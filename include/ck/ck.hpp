@@ -10,6 +10,12 @@
 
 #define CK_TIME_KERNEL 1
 
+// host tracing of kernel launches, host references and profiler phases, see
+// ck/host_utility/trace.hpp
+#ifndef CK_ENABLE_TRACE
+#define CK_ENABLE_TRACE 0
+#endif
+
 // constant address space for kernel parameter
 // https://llvm.org/docs/AMDGPUUsage.html#address-spaces
 #define CK_CONSTANT_ADDRESS_SPACE __attribute__((address_space(4)))
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <hip/hip_runtime.h>
 
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/trace.hpp"
 
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
@@ -17,6 +20,18 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
                              std::size_t lds_byte,
                              Args... args)
 {
+    CK_TRACE_ZONE(zone, "kernel", "launch_and_time_kernel");
+    zone.AddArg("grid_x", grid_dim.x);
+    zone.AddArg("grid_y", grid_dim.y);
+    zone.AddArg("grid_z", grid_dim.z);
+    zone.AddArg("block_x", block_dim.x);
+    zone.AddArg("block_y", block_dim.y);
+    zone.AddArg("block_z", block_dim.z);
+    zone.AddArg("lds_byte", lds_byte);
+    zone.AddArg("stream", reinterpret_cast<uintptr_t>(stream_config.stream_id_));
+    zone.AddArg("time_kernel", stream_config.time_kernel_);
+    zone.AddArg("log_level", stream_config.log_level_);
+
 #if CK_TIME_KERNEL
     if(stream_config.time_kernel_)
     {
@@ -58,6 +73,8 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
 
         hip_check_error(hipEventElapsedTime(&total_time, start, stop));
 
+        zone.AddArg("ave_time_ms", total_time / nrepeat);
+
         return total_time / nrepeat;
     }
     else
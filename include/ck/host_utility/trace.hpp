@@ -0,0 +1,494 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+// Host tracing to the Chrome trace event format, which chrome://tracing and Perfetto open.
+//
+// Built in with CK_ENABLE_TRACE, e.g. with the CMake option of the same name, and recording when
+// CK_TRACE names the trace file, which is written at exit. Without CK_ENABLE_TRACE the macros
+// below expand to nothing that has a cost.
+//
+//     CK_TRACE_ZONE(zone, "kernel", "launch");   // a span, up to the end of the scope
+//     zone.AddArg("grid_x", grid_dim.x);
+//     CK_TRACE_COUNTER("profiler", "tflops", tflops);
+//
+// Every thread records to a buffer of its own, which it moves to the tracer once half full, unless
+// the tracer is busy, e.g. writing: with CK_TRACE, to the trace file, otherwise to memory, up to
+// Tracer::max_moved_bytes. Events are only dropped, and counted in the thread name, if a buffer
+// fills up meanwhile. The category, name and argument keys have to be string literals.
+#if CK_ENABLE_TRACE
+#define CK_TRACE_ZONE(zone, category, name) ::ck::trace::Zone zone{category, name}
+#define CK_TRACE_COUNTER(category, name, value) ::ck::trace::counter(category, name, value)
+#else
+#define CK_TRACE_ZONE(zone, category, name) [[maybe_unused]] ::ck::trace::NullZone zone{}
+#define CK_TRACE_COUNTER(category, name, value) \
+    do                                          \
+    {                                           \
+    } while(false)
+#endif
+
+namespace ck {
+namespace trace {
+
+struct Event
+{
+    static constexpr std::size_t max_num_args    = 12;
+    static constexpr std::size_t max_detail_size = 96;
+
+    const char* category_ = "";
+    const char* name_     = "";
+
+    // 'X' for a zone, 'C' for a counter
+    char phase_ = 'X';
+
+    // since the start of the tracer
+    int64_t ts_ns_  = 0;
+    int64_t dur_ns_ = 0;
+
+    std::size_t num_args_    = 0;
+    std::size_t detail_size_ = 0;
+
+    std::array<std::pair<const char*, double>, max_num_args> args_;
+
+    // free text, e.g. an instance type string, truncated
+    std::array<char, max_detail_size> detail_{};
+};
+
+// Ring buffer of the events of one thread, which pushes them without locking, until another
+// drains them. Events pushed to a full buffer are dropped and counted.
+class EventBuffer
+{
+    public:
+    EventBuffer(std::size_t capacity, uint64_t thread_id)
+        : events_(capacity), thread_id_{thread_id}
+    {
+    }
+
+    // by the owning thread only
+    bool Push(const Event& event)
+    {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+
+        if(head - tail_.load(std::memory_order_acquire) == events_.size())
+        {
+            num_dropped_.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        events_[head % events_.size()] = event;
+
+        head_.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // by one thread at a time, e.g. Tracer::Write()
+    template <typename F>
+    void Drain(F&& f)
+    {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+        for(; tail != head; ++tail)
+        {
+            f(events_[tail % events_.size()]);
+        }
+
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    // by the owning thread, or by the draining one
+    std::size_t GetSize() const
+    {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t GetCapacity() const { return events_.size(); }
+
+    uint64_t GetThreadId() const { return thread_id_; }
+
+    uint64_t GetNumDropped() const { return num_dropped_.load(std::memory_order_relaxed); }
+
+    private:
+    std::vector<Event> events_;
+    const uint64_t thread_id_;
+
+    std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> num_dropped_{0};
+};
+
+class Tracer
+{
+    public:
+    // events per thread, moved to the tracer once half of them are recorded
+    static constexpr std::size_t buffer_capacity = 1 << 14;
+
+    // of the events moved to memory, written as JSON; beyond, the buffers are left to fill up
+    static constexpr std::size_t max_moved_bytes = 1 << 24;
+
+    static Tracer& GetInstance()
+    {
+        static Tracer tracer;
+
+        return tracer;
+    }
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    // completes the CK_TRACE file
+    ~Tracer()
+    {
+        if(path_.empty())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        OpenFileLocked();
+
+        WriteBuffersLocked(file_);
+        WriteFooter(file_);
+    }
+
+    bool IsEnabled() const { return is_enabled_.load(std::memory_order_relaxed); }
+
+    // e.g. to trace a part of a run only, or to trace without CK_TRACE and Write() explicitly
+    void SetEnabled(bool is_enabled) { is_enabled_.store(is_enabled, std::memory_order_relaxed); }
+
+    int64_t GetTimestamp() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - start_)
+            .count();
+    }
+
+    void Record(const Event& event)
+    {
+        EventBuffer& buffer = GetThreadBuffer();
+
+        buffer.Push(event);
+
+        if(buffer.GetSize() < buffer.GetCapacity() / 2)
+        {
+            return;
+        }
+
+        // never waits, e.g. for Write(), which drains the buffer anyway
+        std::unique_lock<std::mutex> lock{mutex_, std::try_to_lock};
+
+        if(!lock.owns_lock())
+        {
+            return;
+        }
+
+        if(!path_.empty())
+        {
+            OpenFileLocked();
+
+            WriteEventsLocked(file_, buffer);
+        }
+        else if(moved_events_.size() < max_moved_bytes)
+        {
+            std::ostringstream os;
+
+            WriteEventsLocked(os, buffer);
+
+            moved_events_ += os.str();
+        }
+    }
+
+    // Writes the events recorded since the last write, as a Chrome trace; with CK_TRACE, but for
+    // those still in the buffers, they have been written to its file instead
+    void Write(std::ostream& os)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        WriteHeader(os);
+
+        os << std::exchange(moved_events_, std::string{});
+
+        WriteBuffersLocked(os);
+        WriteFooter(os);
+    }
+
+    private:
+    Tracer() : start_{std::chrono::steady_clock::now()}
+    {
+        if(const char* path = std::getenv("CK_TRACE"); path != nullptr)
+        {
+            path_ = path;
+        }
+
+        is_enabled_.store(!path_.empty(), std::memory_order_relaxed);
+    }
+
+    // with mutex_ held; opens the CK_TRACE file on first use
+    void OpenFileLocked()
+    {
+        if(!file_.is_open())
+        {
+            file_.open(path_);
+
+            WriteHeader(file_);
+        }
+    }
+
+    static void WriteHeader(std::ostream& os)
+    {
+        os << "{\"traceEvents\":[\n";
+        os << R"({"ph":"M","name":"process_name","pid":0,"tid":0,)"
+           << R"("args":{"name":"composable_kernel"}})";
+    }
+
+    static void WriteFooter(std::ostream& os) { os << "\n],\"displayTimeUnit\":\"ns\"}\n"; }
+
+    // with mutex_ held, drains buffer
+    static void WriteEventsLocked(std::ostream& os, EventBuffer& buffer)
+    {
+        buffer.Drain([&](const Event& event) {
+            os << ",\n";
+
+            WriteEvent(os, event, buffer.GetThreadId());
+        });
+    }
+
+    // with mutex_ held, names the threads and drains their buffers
+    void WriteBuffersLocked(std::ostream& os)
+    {
+        for(const auto& buffer : buffers_)
+        {
+            os << ",\n"
+               << R"({"ph":"M","name":"thread_name","pid":0,"tid":)" << buffer->GetThreadId()
+               << R"(,"args":{"name":"thread )" << buffer->GetThreadId();
+
+            if(const uint64_t num_dropped = buffer->GetNumDropped(); num_dropped > 0)
+            {
+                os << " (" << num_dropped << " events dropped)";
+            }
+
+            os << "\"}}";
+
+            WriteEventsLocked(os, *buffer);
+        }
+    }
+
+    EventBuffer& GetThreadBuffer()
+    {
+        thread_local EventBuffer* p_buffer = nullptr;
+
+        if(p_buffer == nullptr)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            buffers_.push_back(std::make_unique<EventBuffer>(buffer_capacity, buffers_.size() + 1));
+
+            p_buffer = buffers_.back().get();
+        }
+
+        return *p_buffer;
+    }
+
+    static void WriteString(std::ostream& os, std::string_view str)
+    {
+        os << '"';
+
+        for(const char c : str)
+        {
+            if(c == '"' || c == '\\')
+            {
+                os << '\\' << c;
+            }
+            else if(static_cast<unsigned char>(c) < 0x20)
+            {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int{c}
+                   << std::dec << std::setfill(' ');
+            }
+            else
+            {
+                os << c;
+            }
+        }
+
+        os << '"';
+    }
+
+    static void WriteNumber(std::ostream& os, double value)
+    {
+        if(std::isfinite(value))
+        {
+            os << std::setprecision(15) << value;
+        }
+        else
+        {
+            os << "null";
+        }
+    }
+
+    static void WriteEvent(std::ostream& os, const Event& event, uint64_t thread_id)
+    {
+        os << R"({"ph":")" << event.phase_ << R"(","cat":)";
+        WriteString(os, event.category_);
+        os << R"(,"name":)";
+        WriteString(os, event.name_);
+        os << R"(,"pid":0,"tid":)" << thread_id << R"(,"ts":)" << std::fixed
+           << std::setprecision(3) << event.ts_ns_ / 1e3;
+
+        if(event.phase_ == 'X')
+        {
+            os << R"(,"dur":)" << event.dur_ns_ / 1e3;
+        }
+
+        os << std::defaultfloat << R"(,"args":{)";
+
+        for(std::size_t i = 0; i < event.num_args_; ++i)
+        {
+            os << (i == 0 ? "" : ",");
+            WriteString(os, event.args_[i].first);
+            os << ':';
+            WriteNumber(os, event.args_[i].second);
+        }
+
+        if(event.detail_size_ > 0)
+        {
+            os << (event.num_args_ == 0 ? "" : ",") << R"("detail":)";
+            WriteString(os, std::string_view{event.detail_.data(), event.detail_size_});
+        }
+
+        os << "}}";
+    }
+
+    const std::chrono::steady_clock::time_point start_;
+
+    std::string path_;
+    std::atomic<bool> is_enabled_{false};
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<EventBuffer>> buffers_;
+
+    // with CK_TRACE, the file the events moved out of the buffers are streamed to
+    std::ofstream file_;
+
+    // without CK_TRACE, the events moved out of the buffers since the last write, as Write()
+    // writes them
+    std::string moved_events_;
+};
+
+// A span of time, from its construction to its destruction
+class Zone
+{
+    public:
+    Zone(const char* category, const char* name)
+    {
+        Tracer& tracer = Tracer::GetInstance();
+
+        if(!tracer.IsEnabled())
+        {
+            return;
+        }
+
+        event_.category_ = category;
+        event_.name_     = name;
+        event_.ts_ns_    = tracer.GetTimestamp();
+
+        is_active_ = true;
+    }
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+    ~Zone()
+    {
+        if(!is_active_)
+        {
+            return;
+        }
+
+        Tracer& tracer = Tracer::GetInstance();
+
+        event_.dur_ns_ = tracer.GetTimestamp() - event_.ts_ns_;
+
+        tracer.Record(event_);
+    }
+
+    // key has to be a string literal; arguments beyond Event::max_num_args are ignored
+    void AddArg(const char* key, double value)
+    {
+        if(is_active_ && event_.num_args_ < Event::max_num_args)
+        {
+            event_.args_[event_.num_args_++] = {key, value};
+        }
+    }
+
+    void SetDetail(std::string_view detail)
+    {
+        if(is_active_)
+        {
+            event_.detail_size_ = std::min(detail.size(), Event::max_detail_size);
+
+            std::copy_n(detail.begin(), event_.detail_size_, event_.detail_.begin());
+        }
+    }
+
+    private:
+    Event event_;
+    bool is_active_ = false;
+};
+
+// Zone of a build without CK_ENABLE_TRACE
+struct NullZone
+{
+    void AddArg(const char*, double) {}
+
+    void SetDetail(std::string_view) {}
+};
+
+inline void counter(const char* category, const char* name, double value)
+{
+    Tracer& tracer = Tracer::GetInstance();
+
+    if(!tracer.IsEnabled())
+    {
+        return;
+    }
+
+    Event event;
+
+    event.category_ = category;
+    event.name_     = name;
+    event.phase_    = 'C';
+    event.ts_ns_    = tracer.GetTimestamp();
+    event.num_args_ = 1;
+    event.args_[0]  = {name, value};
+
+    tracer.Record(event);
+}
+
+} // namespace trace
+} // namespace ck
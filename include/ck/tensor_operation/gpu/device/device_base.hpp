@@ -4,8 +4,11 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <sstream>
+#include <typeinfo>
 
 #include "ck/stream_config.hpp"
 
@@ -21,9 +24,26 @@ struct BaseArgument
 
     virtual ~BaseArgument() {}
 
+    // Rebind the buffers of an argument in O(1), keeping its descriptors, e.g. for a static-shape
+    // problem that is run on other buffers. Inputs and outputs are numbered in the order of the
+    // pointer parameters of MakeArgumentPointer(), D tensors among the inputs. Return false,
+    // leaving the argument unchanged, if there is no such buffer or the argument cannot be
+    // rebound. The workspace is rebound with BaseOperator::SetWorkSpacePointer().
+    virtual bool SetInputPointer(std::size_t, const void*) { return false; }
+    virtual bool SetOutputPointer(std::size_t, void*) { return false; }
+
     void* p_workspace_ = nullptr;
 };
 
+// Sets the i-th of the pointer members p_members of an argument to p, false if there are fewer
+template <typename VoidPointer, typename... Pointers>
+bool SetArgumentPointer(std::size_t i, VoidPointer p, Pointers&... p_members)
+{
+    std::size_t n = 0;
+
+    return ((n++ == i ? (p_members = static_cast<Pointers>(p), true) : false) || ...);
+}
+
 struct BaseInvoker
 {
     BaseInvoker()                   = default;
@@ -38,6 +58,21 @@ struct BaseInvoker
     virtual ~BaseInvoker() {}
 };
 
+// Instance ID that is stable across builds: FNV-1a of the mangled type name, which only depends on
+// the template arguments of the instance. Unlike type_info::hash_code() or the position of the
+// instance in the instance lists, it can be stored, e.g. in a tuning database.
+inline uint64_t MakeInstanceId(const std::type_info& type)
+{
+    uint64_t id = 0xcbf29ce484222325ull;
+
+    for(const char* p = type.name(); *p != '\0'; ++p)
+    {
+        id = (id ^ static_cast<unsigned char>(*p)) * 0x100000001b3ull;
+    }
+
+    return id;
+}
+
 struct BaseOperator
 {
     BaseOperator()                    = default;
@@ -58,6 +93,8 @@ struct BaseOperator
         return oss.str();
     };
 
+    virtual uint64_t GetInstanceId() const { return MakeInstanceId(typeid(*this)); }
+
     virtual size_t GetWorkSpaceSize(const BaseArgument*) const { return 0; }
 
     virtual void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const
@@ -35,6 +35,16 @@ struct DeviceGemm : public BaseOperator
                         CElementwiseOperation c_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Rebinds the element-wise operations of an argument made by MakeArgumentPointer(), keeping
+    // its descriptors. False, leaving the argument unchanged, if the instance does not support it.
+    virtual bool SetElementwiseOps(BaseArgument*,
+                                   AElementwiseOperation,
+                                   BElementwiseOperation,
+                                   CElementwiseOperation)
+    {
+        return false;
+    }
 };
 
 } // namespace device
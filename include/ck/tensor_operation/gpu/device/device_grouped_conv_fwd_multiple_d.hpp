@@ -58,6 +58,16 @@ struct DeviceGroupedConvFwdMultipleD : public BaseOperator
         const CDEElementwiseOperation& cde_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Rebinds the element-wise operations of an argument made by MakeArgumentPointer(), keeping
+    // its descriptors. False, leaving the argument unchanged, if the instance does not support it.
+    virtual bool SetElementwiseOps(BaseArgument*,
+                                   const AElementwiseOperation&,
+                                   const BElementwiseOperation&,
+                                   const CDEElementwiseOperation&)
+    {
+        return false;
+    }
 };
 
 } // namespace device
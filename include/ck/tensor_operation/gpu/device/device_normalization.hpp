@@ -38,6 +38,10 @@ struct DeviceNormalization : public BaseOperator
                         AccElementwiseOperation acc_elementwise_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Rebinds the element-wise operations of an argument made by MakeArgumentPointer(), keeping
+    // its descriptors. False, leaving the argument unchanged, if the instance does not support it.
+    virtual bool SetElementwiseOps(BaseArgument*, AccElementwiseOperation) { return false; }
 };
 
 template <typename XDataType,
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// What a device operation instance supports, known at compile time like its DeviceOperationTile,
+// so that instances can be filtered without constructing them. Fields that do not apply to an
+// operation, or that it does not report, keep their defaults; IsSupportedArgument() stays the
+// final word.
+struct DeviceOperationCapabilities
+{
+    // GEMM dimensions (of the implicit GEMM for a convolution) that need not be a multiple of the
+    // tile
+    GemmSpecialization gemm_spec_ = GemmSpecialization::Default;
+
+    // convolution forward: Filter1x1Pad0 and Filter1x1Stride1Pad0 only run 1x1 filters
+    ConvolutionForwardSpecialization conv_fwd_spec_ = ConvolutionForwardSpecialization::Default;
+
+    // reduction: NaNs propagate to the output, the indices of the reduced values are output, and
+    // the output is accumulated with atomics, so it must be zeroed and beta must be 0
+    bool propagate_nan_     = false;
+    bool output_index_      = false;
+    bool atomic_add_output_ = false;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Block tile of a device operation instance. Known at compile time, so that an instance registry
+// can describe the instance without constructing it; zero for operations that do not report one.
+struct DeviceOperationTile
+{
+    index_t block_size_  = 0;
+    index_t m_per_block_ = 0;
+    index_t n_per_block_ = 0;
+    index_t k_per_block_ = 0;
+
+    // dimensions the instance pads, i.e. which need not be a multiple of the tile
+    GemmSpecialization gemm_spec_ = GemmSpecialization::Default;
+
+    // LDS allocated by one block, in bytes
+    index_t lds_bytes_ = 0;
+
+    // elements per global memory access of A, B and C
+    index_t a_scalar_per_vector_ = 0;
+    index_t b_scalar_per_vector_ = 0;
+    index_t c_scalar_per_vector_ = 0;
+
+    // main loop pipeline: 1 or 2 for PipelineVersion::v1 or v2 (whose header is device code),
+    // and the K blocks of A and B it loads ahead of the one computed, 1 for none; the LDS the
+    // pipeline needs for them is in lds_bytes_
+    index_t pipeline_version_    = 1;
+    index_t num_prefetch_stages_ = 1;
+
+    // swizzle of the block to C tile map: consecutive blocks walk M01 rows of C tiles before
+    // moving to the next column, 1 walks along rows
+    index_t m01_ = 1;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
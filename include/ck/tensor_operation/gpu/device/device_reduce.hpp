@@ -37,6 +37,19 @@ struct DeviceReduce : public BaseOperator
                         const AccElementwiseOperation acc_elementwise_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Rebinds the element-wise operations of an argument made by MakeArgumentPointer(), keeping
+    // its descriptors. False, leaving the argument unchanged, if the instance does not support it.
+    virtual bool SetElementwiseOps(BaseArgument*,
+                                   const InElementwiseOperation,
+                                   const AccElementwiseOperation)
+    {
+        return false;
+    }
+
+    // Same for alpha and beta. Whether beta is 0 decides whether the argument is supported, so
+    // IsSupportedArgument() has to be called again when that changes.
+    virtual bool SetScales(BaseArgument*, float, float) { return false; }
 };
 
 template <index_t Rank,
@@ -53,6 +53,23 @@ struct DeviceSoftmax : public BaseOperator
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
     virtual index_t GetRank() const                           = 0;
     virtual index_t GetNumReduceDim() const                   = 0;
+
+    //
+    // @brief      Rebinds the element-wise operations of an argument made by
+    //             MakeArgumentPointer(), keeping its descriptors.
+    //
+    // @return     False, leaving the argument unchanged, if the instance does not support it.
+    //
+    virtual bool SetElementwiseOps(BaseArgument*, InElementwiseOp, AccElementwiseOp)
+    {
+        return false;
+    }
+
+    //
+    // @brief      Same for alpha and beta, typeless pointers in host memory as in
+    //             MakeArgumentPointer().
+    //
+    virtual bool SetScales(BaseArgument*, const void*, const void*) { return false; }
 };
 
 template <typename InDataType,
@@ -11,6 +11,7 @@
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_conv_fwd.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_capabilities.hpp"
 #include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_v3r1.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -869,6 +870,15 @@ struct DeviceConv2dFwdXdl_C_Shuffle_Input_N_Hi_Wi_C_Weight_K_Y_X_C_Output_N_Ho_W
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr DeviceOperationCapabilities GetCapabilities()
+    {
+        DeviceOperationCapabilities capabilities{};
+
+        capabilities.conv_fwd_spec_ = ConvForwardSpecialization;
+
+        return capabilities;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -11,6 +11,7 @@
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_tile.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_dl_v1r3.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -295,6 +296,18 @@ struct DeviceGemmDl : public DeviceGemm<ALayout,
             }
         }
 
+        // polymorphic
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return SetArgumentPointer(i, p, p_a_grid_, p_b_grid_);
+        }
+
+        // polymorphic
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, p_c_grid_);
+        }
+
         //  private:
         const ADataType* p_a_grid_;
         const BDataType* p_b_grid_;
@@ -567,6 +580,38 @@ struct DeviceGemmDl : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr DeviceOperationTile GetTile()
+    {
+        // A and B are read through vector tensors, their widths are not reported
+        return DeviceOperationTile{BlockSize,
+                                   MPerBlock,
+                                   NPerBlock,
+                                   K0PerBlock * K1,
+                                   GemmSpec,
+                                   GridwiseGemm::GetSharedMemoryNumberOfByte(),
+                                   0,
+                                   0,
+                                   CThreadTransferDstScalarPerVector,
+                                   1,
+                                   2, // A and B double buffered in LDS
+                                   1};
+    }
+
+    // polymorphic
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           AElementwiseOperation a_element_op,
+                           BElementwiseOperation b_element_op,
+                           CElementwiseOperation c_element_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.a_element_op_ = a_element_op;
+        arg.b_element_op_ = b_element_op;
+        arg.c_element_op_ = c_element_op;
+
+        return true;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
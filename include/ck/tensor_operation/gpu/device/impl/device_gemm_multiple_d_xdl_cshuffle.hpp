@@ -378,6 +378,36 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
             std::cout << "E[M, N]: " << e_grid_desc_m_n_ << std::endl;
         }
 
+        // polymorphic
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            if(i < 2)
+            {
+                return SetArgumentPointer(i, p, p_a_grid_, p_b_grid_);
+            }
+
+            bool is_set = false;
+
+            static_for<0, NumDTensor, 1>{}([&](auto j) {
+                using DDataType = remove_cvref_t<tuple_element_t<j.value, DsDataType>>;
+
+                if(i == 2 + j.value)
+                {
+                    p_ds_grid_(j) = static_cast<const DDataType*>(p);
+
+                    is_set = true;
+                }
+            });
+
+            return is_set;
+        }
+
+        // polymorphic
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, p_e_grid_);
+        }
+
         //  private:
         // pointers
         const ADataType* p_a_grid_;
@@ -661,6 +691,21 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           AElementwiseOperation a_element_op,
+                           BElementwiseOperation b_element_op,
+                           CDEElementwiseOperation cde_element_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.a_element_op_   = a_element_op;
+        arg.b_element_op_   = b_element_op;
+        arg.cde_element_op_ = cde_element_op;
+
+        return true;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -11,6 +11,7 @@
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_tile.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_v2r3.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -285,6 +286,18 @@ struct DeviceGemmXdl : public DeviceGemm<ALayout,
             }
         }
 
+        // polymorphic
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return SetArgumentPointer(i, p, p_a_grid_, p_b_grid_);
+        }
+
+        // polymorphic
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, p_c_grid_);
+        }
+
         //  private:
         const ADataType* p_a_grid_;
         const BDataType* p_b_grid_;
@@ -529,6 +542,37 @@ struct DeviceGemmXdl : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr DeviceOperationTile GetTile()
+    {
+        return DeviceOperationTile{BlockSize,
+                                   MPerBlock,
+                                   NPerBlock,
+                                   K0PerBlock * K1,
+                                   GemmSpec,
+                                   GridwiseGemm::GetSharedMemoryNumberOfByte(),
+                                   ABlockTransferSrcScalarPerVector,
+                                   BBlockTransferSrcScalarPerVector,
+                                   CThreadTransferDstScalarPerVector,
+                                   static_cast<index_t>(PipelineVer) + 1,
+                                   PipelineVer == PipelineVersion::v2 ? 2 : NumPrefetch,
+                                   8}; // BlockToCTileMap_M00_N0_M01Adapt ignores M01 and N01
+    }
+
+    // polymorphic
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           AElementwiseOperation a_element_op,
+                           BElementwiseOperation b_element_op,
+                           CElementwiseOperation c_element_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.a_element_op_ = a_element_op;
+        arg.b_element_op_ = b_element_op;
+        arg.c_element_op_ = c_element_op;
+
+        return true;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -264,6 +264,18 @@ struct DeviceNormalizationImpl : public DeviceNormalization<XDataType,
                 x_grid_desc_m_k_.GetLength(Number<1>{}) <= KThreadClusterSize * KThreadSliceSize;
         }
 
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return SetArgumentPointer(i, p, p_x_, p_gamma_, p_beta_);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            // p_saveMean and p_saveInvVar are ignored by MakeArgumentPointer(), not kept, so they
+            // cannot be rebound
+            return SetArgumentPointer(i, p, p_y_);
+        }
+
         AccDataType epsilon_;
 
         const XDataType* p_x_;
@@ -455,6 +467,14 @@ struct DeviceNormalizationImpl : public DeviceNormalization<XDataType,
         return std::make_unique<Invoker>();
     };
 
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           AccElementwiseOperation acc_elementwise_op) override
+    {
+        dynamic_cast<Argument*>(p_arg)->acc_elementwise_op_ = acc_elementwise_op;
+
+        return true;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -9,6 +9,7 @@
 
 #include "ck/tensor_description/tensor_descriptor.hpp"
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_capabilities.hpp"
 #include "ck/tensor_operation/gpu/device/device_reduce.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_reduce_common.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_2d_reduction_multiblock.hpp"
@@ -307,6 +308,16 @@ struct DeviceReduceMultiBlock
         std::array<index_t, NumDstDim> outLengths_;
         std::array<index_t, NumDstDim> outStrides_;
 
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return SetArgumentPointer(i, p, in_dev_, in_index_dev_);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, out_dev_, out_index_dev_);
+        }
+
         AccDataType alpha_;
         AccDataType beta_;
 
@@ -523,6 +534,39 @@ struct DeviceReduceMultiBlock
         return std::make_unique<Invoker>();
     };
 
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           const InElementwiseOperation in_elementwise_op,
+                           const AccElementwiseOperation acc_elementwise_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.in_elementwise_op_  = in_elementwise_op;
+        arg.acc_elementwise_op_ = acc_elementwise_op;
+
+        return true;
+    }
+
+    bool SetScales(BaseArgument* p_arg, float alpha, float beta) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.alpha_ = type_convert<AccDataType>(alpha);
+        arg.beta_  = type_convert<AccDataType>(beta);
+
+        return true;
+    }
+
+    static constexpr DeviceOperationCapabilities GetCapabilities()
+    {
+        DeviceOperationCapabilities capabilities{};
+
+        capabilities.propagate_nan_     = PropagateNan;
+        capabilities.output_index_      = OutputIndex;
+        capabilities.atomic_add_output_ = use_multiblock;
+
+        return capabilities;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -9,6 +9,7 @@
 
 #include "ck/host_utility/device_prop.hpp"
 #include "ck/host_utility/kernel_launch.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_capabilities.hpp"
 #include "ck/tensor_operation/gpu/device/device_reduce.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_reduce_common.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_2d_reduction_multiblock.hpp"
@@ -198,6 +199,17 @@ struct DeviceReduceThreadWise
         std::array<index_t, NumDstDim> outLengths_;
         std::array<index_t, NumDstDim> outStrides_;
 
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            // in_index_dev is ignored by MakeArgumentPointer(), not kept, so it cannot be rebound
+            return SetArgumentPointer(i, p, in_dev_);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, out_dev_, out_index_dev_);
+        }
+
         AccDataType alpha_;
         AccDataType beta_;
 
@@ -362,6 +374,38 @@ struct DeviceReduceThreadWise
         return std::make_unique<Invoker>();
     };
 
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           const InElementwiseOperation in_elementwise_op,
+                           const AccElementwiseOperation acc_elementwise_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.in_elementwise_op_  = in_elementwise_op;
+        arg.acc_elementwise_op_ = acc_elementwise_op;
+
+        return true;
+    }
+
+    bool SetScales(BaseArgument* p_arg, float alpha, float beta) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.alpha_ = type_convert<AccDataType>(alpha);
+        arg.beta_  = type_convert<AccDataType>(beta);
+
+        return true;
+    }
+
+    static constexpr DeviceOperationCapabilities GetCapabilities()
+    {
+        DeviceOperationCapabilities capabilities{};
+
+        capabilities.propagate_nan_ = PropagateNan;
+        capabilities.output_index_  = OutputIndex;
+
+        return capabilities;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -217,6 +217,16 @@ struct DeviceSoftmaxImpl : public DeviceSoftmax<InDataType,
         std::vector<index_t> inLengths_;
         std::vector<index_t> inStrides_;
 
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return SetArgumentPointer(i, p, in_dev_);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return SetArgumentPointer(i, p, out_dev_);
+        }
+
         AccDataType alpha_;
         AccDataType beta_;
 
@@ -400,6 +410,28 @@ struct DeviceSoftmaxImpl : public DeviceSoftmax<InDataType,
         return std::make_unique<Invoker>();
     };
 
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           InElementwiseOp in_elementwise_op,
+                           AccElementwiseOp acc_elementwise_op) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.in_elementwise_op_  = in_elementwise_op;
+        arg.acc_elementwise_op_ = acc_elementwise_op;
+
+        return true;
+    }
+
+    bool SetScales(BaseArgument* p_arg, const void* alpha, const void* beta) override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.alpha_ = *static_cast<const AccDataType*>(alpha);
+        arg.beta_  = *static_cast<const AccDataType*>(beta);
+
+        return true;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
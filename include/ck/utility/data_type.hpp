@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ck/utility/statically_indexed_array.hpp"
+#include "ck/utility/f8_utils.hpp"
 
 namespace ck {
 
@@ -12,6 +13,14 @@ using half_t  = _Float16;
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 using int4_t = _BitInt(4);
 #endif
+// 8-bit floats, E4M3 and E5M2 (see f8_utils.hpp). These are storage types only, without
+// arithmetic; values are converted to and from them with type_convert
+enum class f8_t : uint8_t
+{
+};
+enum class bf8_t : uint8_t
+{
+};
 
 // vector_type
 template <typename T, index_t N>
@@ -133,6 +142,20 @@ struct scalar_type<int8_t>
     static constexpr index_t vector_size = 1;
 };
 
+template <>
+struct scalar_type<f8_t>
+{
+    using type                           = f8_t;
+    static constexpr index_t vector_size = 1;
+};
+
+template <>
+struct scalar_type<bf8_t>
+{
+    using type                           = bf8_t;
+    static constexpr index_t vector_size = 1;
+};
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 template <>
 struct scalar_type<int4_t>
@@ -942,11 +965,18 @@ using int8x16_t = typename vector_type<int8_t, 16>::type;
 using int8x32_t = typename vector_type<int8_t, 32>::type;
 using int8x64_t = typename vector_type<int8_t, 64>::type;
 
+// f8_t and bf8_t are not arithmetic types and have no ext_vector_type vectors; vectorized
+// accesses to them go through the int8_t vectors above
+
 // Convert X to Y
 template <typename Y, typename X>
 __host__ __device__ constexpr Y type_convert(X x)
 {
     static_assert(!std::is_reference_v<Y> && !std::is_reference_v<X>);
+    static_assert(std::is_same_v<Y, X> ||
+                      !(std::is_same_v<Y, f8_t> || std::is_same_v<Y, bf8_t> ||
+                        std::is_same_v<X, f8_t> || std::is_same_v<X, bf8_t>),
+                  "wrong! f8_t and bf8_t only convert to and from float and half_t");
 
     return static_cast<Y>(x);
 }
@@ -1010,6 +1040,81 @@ inline __host__ __device__ constexpr bhalf_t type_convert<bhalf_t, float>(float
     return uint16_t(u.int32 >> 16);
 }
 
+// convert fp32 to fp8 (E4M3), round to nearest even, saturate to the largest finite value
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, float>(float x)
+{
+    return bit_cast<f8_t>(utils::cast_to_f8<utils::f8_e4m3_format, true>(x));
+}
+
+// convert fp8 (E4M3) to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, f8_t>(f8_t x)
+{
+    return utils::cast_from_f8<utils::f8_e4m3_format>(bit_cast<uint8_t>(x));
+}
+
+// convert fp16 to fp8 (E4M3) through fp32, which is exact
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, half_t>(half_t x)
+{
+    return type_convert<f8_t>(static_cast<float>(x));
+}
+
+// convert fp8 (E4M3) to fp16, exact
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, f8_t>(f8_t x)
+{
+    return static_cast<half_t>(type_convert<float>(x));
+}
+
+// convert fp32 to bf8 (E5M2), round to nearest even, saturate to the largest finite value
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, float>(float x)
+{
+    return bit_cast<bf8_t>(utils::cast_to_f8<utils::f8_e5m2_format, true>(x));
+}
+
+// convert bf8 (E5M2) to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, bf8_t>(bf8_t x)
+{
+    return utils::cast_from_f8<utils::f8_e5m2_format>(bit_cast<uint8_t>(x));
+}
+
+// convert fp16 to bf8 (E5M2) through fp32, which is exact
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, half_t>(half_t x)
+{
+    return type_convert<bf8_t>(static_cast<float>(x));
+}
+
+// convert bf8 (E5M2) to fp16, exact
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, bf8_t>(bf8_t x)
+{
+    return static_cast<half_t>(type_convert<float>(x));
+}
+
+// Convert fp32 to fp8 / bf8 with stochastic rounding, saturating like type_convert. 'rng' is a
+// uniformly random 32-bit value, e.g. from a per-element hash or a host std::mt19937.
+template <typename Y>
+__host__ __device__ constexpr Y f8_convert_sr(float x, uint32_t rng);
+
+template <>
+inline __host__ __device__ constexpr f8_t f8_convert_sr<f8_t>(float x, uint32_t rng)
+{
+    return bit_cast<f8_t>(
+        utils::cast_to_f8<utils::f8_e4m3_format, true, f8_rounding_mode::stochastic>(x, rng));
+}
+
+template <>
+inline __host__ __device__ constexpr bf8_t f8_convert_sr<bf8_t>(float x, uint32_t rng)
+{
+    return bit_cast<bf8_t>(
+        utils::cast_to_f8<utils::f8_e5m2_format, true, f8_rounding_mode::stochastic>(x, rng));
+}
+
 template <typename T>
 struct NumericLimits
 {
@@ -1044,6 +1149,43 @@ struct NumericLimits<half_t>
     __host__ __device__ static constexpr half_t QuietNaN() { return bit_cast<half_t>(binary_qnan); }
 };
 
+template <>
+struct NumericLimits<f8_t>
+{
+    static constexpr uint8_t binary_min    = 0x08; // 2^-6
+    static constexpr uint8_t binary_max    = 0x7E; // 448
+    static constexpr uint8_t binary_lowest = 0xFE; // -448
+    static constexpr uint8_t binary_qnan   = 0x7F;
+
+    __host__ __device__ static constexpr f8_t Min() { return bit_cast<f8_t>(binary_min); }
+
+    __host__ __device__ static constexpr f8_t Max() { return bit_cast<f8_t>(binary_max); }
+
+    __host__ __device__ static constexpr f8_t Lowest() { return bit_cast<f8_t>(binary_lowest); }
+
+    __host__ __device__ static constexpr f8_t QuietNaN() { return bit_cast<f8_t>(binary_qnan); }
+};
+
+template <>
+struct NumericLimits<bf8_t>
+{
+    static constexpr uint8_t binary_min    = 0x04; // 2^-14
+    static constexpr uint8_t binary_max    = 0x7B; // 57344
+    static constexpr uint8_t binary_lowest = 0xFB; // -57344
+    static constexpr uint8_t binary_qnan   = 0x7E;
+    static constexpr uint8_t binary_inf    = 0x7C;
+
+    __host__ __device__ static constexpr bf8_t Min() { return bit_cast<bf8_t>(binary_min); }
+
+    __host__ __device__ static constexpr bf8_t Max() { return bit_cast<bf8_t>(binary_max); }
+
+    __host__ __device__ static constexpr bf8_t Lowest() { return bit_cast<bf8_t>(binary_lowest); }
+
+    __host__ __device__ static constexpr bf8_t QuietNaN() { return bit_cast<bf8_t>(binary_qnan); }
+
+    __host__ __device__ static constexpr bf8_t Infinity() { return bit_cast<bf8_t>(binary_inf); }
+};
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 template <>
 struct NumericLimits<int4_t>
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "ck/utility/type.hpp"
+
+namespace ck {
+
+// Rounding of conversions to the 8-bit float types
+enum struct f8_rounding_mode
+{
+    standard,   // round to nearest, ties to even
+    stochastic, // round up with probability (truncated bits) / (weight of the last kept bit)
+};
+
+namespace utils {
+
+// 8-bit float formats of the OCP FP8 specification, sign in the top bit:
+//   E4M3 (f8_t):  4 exponent bits with bias 7, 3 mantissa bits. No infinities, S.1111.111 is NaN,
+//                 the largest finite value is 448.
+//   E5M2 (bf8_t): 5 exponent bits with bias 15, 2 mantissa bits. IEEE style infinities and NaNs,
+//                 the largest finite value is 57344.
+template <index_t ExpBits, index_t MantBits>
+struct f8_format
+{
+    static constexpr index_t exp_bits  = ExpBits;
+    static constexpr index_t mant_bits = MantBits;
+    static constexpr int32_t bias      = (1 << (ExpBits - 1)) - 1;
+
+    static constexpr bool has_inf = ExpBits == 5;
+
+    static constexpr uint32_t exp_mask  = (1u << ExpBits) - 1;
+    static constexpr uint32_t mant_mask = (1u << MantBits) - 1;
+
+    // bit patterns without the sign
+    static constexpr uint8_t inf_code = exp_mask << MantBits;
+    static constexpr uint8_t nan_code = has_inf ? (inf_code | (1u << (MantBits - 1))) : 0x7f;
+    static constexpr uint8_t max_code = has_inf ? (inf_code - 1) : (nan_code - 1);
+};
+
+using f8_e4m3_format = f8_format<4, 3>;
+using f8_e5m2_format = f8_format<5, 2>;
+
+// Convert fp32 to the bit pattern of an 8-bit float.
+//
+// NaN converts to NaN. Finite values beyond the largest finite value and infinities convert to
+// +-max if Saturate, otherwise to +-Inf (E5M2) or NaN (E4M3). With stochastic rounding the low
+// bits of 'rng' decide the rounding direction, so they must be uniformly random.
+template <typename Format, bool Saturate, f8_rounding_mode Rounding = f8_rounding_mode::standard>
+__host__ __device__ constexpr uint8_t cast_to_f8(float x, uint32_t rng = 0)
+{
+    constexpr int32_t min_normal_exp = 1 - Format::bias;
+
+    constexpr uint8_t overflow_code =
+        Saturate ? Format::max_code : (Format::has_inf ? Format::inf_code : Format::nan_code);
+
+    const uint32_t bits = bit_cast<uint32_t>(x);
+    const uint8_t sign  = static_cast<uint8_t>((bits >> 24) & 0x80);
+    const int32_t exp   = static_cast<int32_t>((bits >> 23) & 0xff);
+    const uint32_t mant = bits & 0x7fffff;
+
+    if(exp == 0xff)
+    {
+        return sign | (mant != 0 ? Format::nan_code : overflow_code);
+    }
+
+    // fp32 zeros and denormals are far below half of the smallest 8-bit denormal
+    if(exp == 0)
+    {
+        return sign;
+    }
+
+    // |x| = m * 2^(e - 23)
+    const uint32_t m = mant | 0x800000;
+    const int32_t e  = exp - 127;
+
+    // number of mantissa bits to drop; results below the smallest normal are denormal and lose
+    // one more bit per binade
+    const int32_t shift = 23 - Format::mant_bits + (e < min_normal_exp ? min_normal_exp - e : 0);
+
+    if(shift > 24)
+    {
+        // below half of the smallest denormal, stochastic rounding may still round up
+        if constexpr(Rounding == f8_rounding_mode::stochastic)
+        {
+            if(shift < 32 && (rng & ((uint32_t{1} << shift) - 1)) < m)
+            {
+                return sign | 1;
+            }
+        }
+
+        return sign;
+    }
+
+    const uint32_t q   = m >> shift;
+    const uint32_t rem = m & ((uint32_t{1} << shift) - 1);
+
+    uint32_t round_up = 0;
+    if constexpr(Rounding == f8_rounding_mode::standard)
+    {
+        const uint32_t half = uint32_t{1} << (shift - 1);
+
+        round_up = (rem > half || (rem == half && (q & 1) != 0)) ? 1 : 0;
+    }
+    else
+    {
+        round_up = (rng & ((uint32_t{1} << shift) - 1)) < rem ? 1 : 0;
+    }
+
+    // a normal q carries the implicit bit, which adds one to the biased exponent, so rounding up
+    // into the next binade (or from the largest denormal to the smallest normal) carries through
+    const int32_t code = (e < min_normal_exp ? 0 : (e + Format::bias - 1) << Format::mant_bits) +
+                         static_cast<int32_t>(q + round_up);
+
+    if(code > Format::max_code)
+    {
+        return sign | overflow_code;
+    }
+
+    return sign | static_cast<uint8_t>(code);
+}
+
+// Convert the bit pattern of an 8-bit float to fp32, exactly
+template <typename Format>
+__host__ __device__ constexpr float cast_from_f8(uint8_t x)
+{
+    const uint32_t sign = static_cast<uint32_t>(x & 0x80) << 24;
+    const uint32_t exp  = (x >> Format::mant_bits) & Format::exp_mask;
+    const uint32_t mant = x & Format::mant_mask;
+
+    if constexpr(Format::has_inf)
+    {
+        if(exp == Format::exp_mask)
+        {
+            return bit_cast<float>(sign | (mant == 0 ? 0x7f800000 : 0x7fc00000));
+        }
+    }
+    else
+    {
+        if((x & 0x7f) == Format::nan_code)
+        {
+            return bit_cast<float>(sign | 0x7fc00000);
+        }
+    }
+
+    if(exp == 0)
+    {
+        // mant * 2^(1 - bias - mant_bits), the scale is a power of two so the product is exact
+        constexpr uint32_t scale_exp = 127 + 1 - Format::bias - Format::mant_bits;
+
+        const float scale = bit_cast<float>(scale_exp << 23);
+        const float value = static_cast<float>(mant) * scale;
+
+        return sign != 0 ? -value : value;
+    }
+
+    return bit_cast<float>(sign | ((exp - Format::bias + 127) << 23) |
+                           (mant << (23 - Format::mant_bits)));
+}
+
+} // namespace utils
+} // namespace ck
@@ -25,9 +25,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_g_m_k,
-                 const Tensor<BDataType>& b_g_k_n,
-                 Tensor<CDataType>& c_g_m_n,
+        Argument(TensorView<const ADataType> a_g_m_k,
+                 TensorView<const BDataType> b_g_k_n,
+                 TensorView<CDataType> c_g_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CElementwiseOperation c_element_op)
@@ -40,9 +40,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
         {
         }
 
-        const Tensor<ADataType>& a_g_m_k_;
-        const Tensor<BDataType>& b_g_k_n_;
-        Tensor<CDataType>& c_g_m_n_;
+        TensorView<const ADataType> a_g_m_k_;
+        TensorView<const BDataType> b_g_k_n_;
+        TensorView<CDataType> c_g_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
@@ -56,8 +56,12 @@ struct ReferenceBatchedGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            const StaticTensorView<const ADataType, 3> a_g_m_k{arg.a_g_m_k_};
+            const StaticTensorView<const BDataType, 3> b_g_k_n{arg.b_g_k_n_};
+            const StaticTensorView<CDataType, 3> c_g_m_n{arg.c_g_m_n_};
+
             auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
-                const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
+                const int K = a_g_m_k.GetLengths()[2];
 
                 AccDataType v_acc = 0;
 
@@ -66,8 +70,8 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                     ADataType v_a;
                     BDataType v_b;
 
-                    arg.a_element_op_(v_a, arg.a_g_m_k_(g, m, k));
-                    arg.b_element_op_(v_b, arg.b_g_k_n_(g, k, n));
+                    arg.a_element_op_(v_a, a_g_m_k(g, m, k));
+                    arg.b_element_op_(v_b, b_g_k_n(g, k, n));
 
                     v_acc +=
                         ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
@@ -77,13 +81,13 @@ struct ReferenceBatchedGemm : public device::BaseOperator
 
                 arg.c_element_op_(v_c, v_acc);
 
-                arg.c_g_m_n_(g, m, n) = ck::type_convert<CDataType>(v_c);
+                c_g_m_n(g, m, n) = ck::type_convert<CDataType>(v_c);
             };
 
             make_ParallelTensorFunctor(f_gmk_gkn_gmn,
-                                       arg.c_g_m_n_.mDesc.GetLengths()[0],
-                                       arg.c_g_m_n_.mDesc.GetLengths()[1],
-                                       arg.c_g_m_n_.mDesc.GetLengths()[2])(
+                                       c_g_m_n.GetLengths()[0],
+                                       c_g_m_n.GetLengths()[1],
+                                       c_g_m_n.GetLengths()[2])(
                 std::thread::hardware_concurrency());
             return 0;
         }
@@ -103,9 +107,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_g_m_k,
-                             const Tensor<BDataType>& b_g_k_n,
-                             Tensor<CDataType>& c_g_m_n,
+    static auto MakeArgument(TensorView<const ADataType> a_g_m_k,
+                             TensorView<const BDataType> b_g_k_n,
+                             TensorView<CDataType> c_g_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
                              CElementwiseOperation c_element_op)
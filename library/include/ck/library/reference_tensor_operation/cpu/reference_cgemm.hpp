@@ -6,6 +6,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "ck/library/utility/host_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
@@ -14,6 +15,21 @@ namespace ck {
 namespace tensor_operation {
 namespace host {
 
+enum struct CGemmAlgorithm
+{
+    // 4 real multiplications per complex product, accumulated in fp32. Real and imaginary
+    // parts are computed together in one blocked pass; each output sums over k in order, with
+    // the same arithmetic as the naive loop.
+    Standard,
+    // Gauss / 3M: Cr = Ar*Br - Ai*Bi, Ci = (Ar+Ai)*(Br+Bi) - Ar*Br - Ai*Bi, i.e. 3 real GEMMs
+    // on the blocked host GEMM engine instead of 4 multiplications per term. Ci is formed by
+    // cancellation, so its absolute error scales with (|Ar|+|Ai|)*(|Br|+|Bi|) rather than |Ci|.
+    Gauss3M,
+    // 3M with the real GEMMs accumulated in fp64, which bounds the cancellation error at fp32
+    // level again
+    Gauss3MFp64Accumulation,
+};
+
 // FIXME: support arbitrary elementwise operation for A/B/C
 template <
     typename ADataType,
@@ -32,15 +48,16 @@ struct ReferenceCGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k_real,
-                 const Tensor<ADataType>& a_m_k_imag,
-                 const Tensor<BDataType>& b_k_n_real,
-                 const Tensor<BDataType>& b_k_n_imag,
-                 Tensor<CDataType>& c_m_n_real,
-                 Tensor<CDataType>& c_m_n_imag,
+        Argument(TensorView<const ADataType> a_m_k_real,
+                 TensorView<const ADataType> a_m_k_imag,
+                 TensorView<const BDataType> b_k_n_real,
+                 TensorView<const BDataType> b_k_n_imag,
+                 TensorView<CDataType> c_m_n_real,
+                 TensorView<CDataType> c_m_n_imag,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 CGemmAlgorithm algorithm)
             : a_m_k_real_{a_m_k_real},
               a_m_k_imag_{a_m_k_imag},
               b_k_n_real_{b_k_n_real},
@@ -49,20 +66,23 @@ struct ReferenceCGemm : public device::BaseOperator
               c_m_n_imag_{c_m_n_imag},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              algorithm_{algorithm}
         {
         }
 
-        const Tensor<ADataType>& a_m_k_real_;
-        const Tensor<ADataType>& a_m_k_imag_;
-        const Tensor<BDataType>& b_k_n_real_;
-        const Tensor<BDataType>& b_k_n_imag_;
-        Tensor<CDataType>& c_m_n_real_;
-        Tensor<CDataType>& c_m_n_imag_;
+        TensorView<const ADataType> a_m_k_real_;
+        TensorView<const ADataType> a_m_k_imag_;
+        TensorView<const BDataType> b_k_n_real_;
+        TensorView<const BDataType> b_k_n_imag_;
+        TensorView<CDataType> c_m_n_real_;
+        TensorView<CDataType> c_m_n_imag_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        CGemmAlgorithm algorithm_;
     };
 
     // Invoker
@@ -72,55 +92,126 @@ struct ReferenceCGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
-            const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
+            const std::size_t M = arg.c_m_n_real_.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_real_.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_real_.GetLengths()[1];
 
-            if(K != arg.a_m_k_imag_.mDesc.GetLengths()[1])
+            if(arg.a_m_k_real_.GetLengths() != arg.a_m_k_imag_.GetLengths() ||
+               arg.b_k_n_real_.GetLengths() != arg.b_k_n_imag_.GetLengths() ||
+               arg.c_m_n_real_.GetLengths() != arg.c_m_n_imag_.GetLengths())
             {
                 throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
             }
 
-            auto f_mk_kn_mn_real = [&](auto m, auto n) {
-                float v_c_real = 0;
+            if(arg.a_m_k_real_.GetLengths()[0] != M || arg.b_k_n_real_.GetLengths()[0] != K ||
+               arg.b_k_n_real_.GetLengths()[1] != N)
+            {
+                throw std::runtime_error("wrong! Incompatible A, B and C sizes in CGEMM");
+            }
+
+            switch(arg.algorithm_)
+            {
+            case CGemmAlgorithm::Standard: RunStandard(arg, M, N, K); break;
+            case CGemmAlgorithm::Gauss3M: RunGauss3M<float>(arg, M, N, K); break;
+            case CGemmAlgorithm::Gauss3MFp64Accumulation: RunGauss3M<double>(arg, M, N, K); break;
+            }
+
+            return 0;
+        }
+
+        static void RunStandard(const Argument& arg, std::size_t M, std::size_t N, std::size_t K)
+        {
+            // inputs are converted to fp32 once, into dense row-major planes
+            const auto a_real = host_gemm_pack<float>(arg.a_m_k_real_);
+            const auto a_imag = host_gemm_pack<float>(arg.a_m_k_imag_);
+            const auto b_real = host_gemm_pack<float>(arg.b_k_n_real_);
+            const auto b_imag = host_gemm_pack<float>(arg.b_k_n_imag_);
+
+            const StaticTensorView<CDataType, 2> c_real{arg.c_m_n_real_};
+            const StaticTensorView<CDataType, 2> c_imag{arg.c_m_n_imag_};
 
-                for(std::size_t k = 0; k < K; ++k)
+            host_gemm_for_each_tile(M, N, [&](auto m_begin, auto m_end, auto n_begin, auto n_end) {
+                float acc_real[HostGemmMPerTile][HostGemmNPerTile] = {};
+                float acc_imag[HostGemmMPerTile][HostGemmNPerTile] = {};
+
+                for(std::size_t k_begin = 0; k_begin < K; k_begin += HostGemmKPerBlock)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    const std::size_t k_end = std::min(k_begin + HostGemmKPerBlock, K);
 
-                    v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
-                }
+                    for(std::size_t m = m_begin; m < m_end; ++m)
+                    {
+                        float* v_c_real = acc_real[m - m_begin];
+                        float* v_c_imag = acc_imag[m - m_begin];
 
-                arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(v_c_real);
-            };
+                        for(std::size_t k = k_begin; k < k_end; ++k)
+                        {
+                            const float v_a_real  = a_real[m * K + k];
+                            const float v_a_imag  = a_imag[m * K + k];
+                            const float* v_b_real = &b_real[k * N];
+                            const float* v_b_imag = &b_imag[k * N];
 
-            auto f_mk_kn_mn_imag = [&](auto m, auto n) {
-                float v_c_imag = 0;
+                            for(std::size_t n = n_begin; n < n_end; ++n)
+                            {
+                                v_c_real[n - n_begin] +=
+                                    v_a_real * v_b_real[n] - v_a_imag * v_b_imag[n];
+                                v_c_imag[n - n_begin] +=
+                                    v_a_real * v_b_imag[n] + v_a_imag * v_b_real[n];
+                            }
+                        }
+                    }
+                }
 
-                for(std::size_t k = 0; k < K; ++k)
+                for(std::size_t m = m_begin; m < m_end; ++m)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    const float* v_c_real = acc_real[m - m_begin];
+                    const float* v_c_imag = acc_imag[m - m_begin];
 
-                    v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
+                    for(std::size_t n = n_begin; n < n_end; ++n)
+                    {
+                        c_real(m, n) = ck::type_convert<CDataType>(v_c_real[n - n_begin]);
+                        c_imag(m, n) = ck::type_convert<CDataType>(v_c_imag[n - n_begin]);
+                    }
                 }
+            });
+        }
 
-                arg.c_m_n_imag_(m, n) = ck::type_convert<CDataType>(v_c_imag);
-            };
+        template <typename AccDataType>
+        static void RunGauss3M(const Argument& arg, std::size_t M, std::size_t N, std::size_t K)
+        {
+            const auto a_real = host_gemm_pack<AccDataType>(arg.a_m_k_real_);
+            const auto a_imag = host_gemm_pack<AccDataType>(arg.a_m_k_imag_);
+            const auto b_real = host_gemm_pack<AccDataType>(arg.b_k_n_real_);
+            const auto b_imag = host_gemm_pack<AccDataType>(arg.b_k_n_imag_);
 
-            make_ParallelTensorFunctor(f_mk_kn_mn_real,
-                                       arg.c_m_n_real_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_real_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
-            make_ParallelTensorFunctor(f_mk_kn_mn_imag,
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            std::vector<AccDataType> a_sum(a_real.size());
+            std::vector<AccDataType> b_sum(b_real.size());
 
-            return 0;
+            std::transform(
+                a_real.begin(), a_real.end(), a_imag.begin(), a_sum.begin(), std::plus<>{});
+            std::transform(
+                b_real.begin(), b_real.end(), b_imag.begin(), b_sum.begin(), std::plus<>{});
+
+            std::vector<AccDataType> t_real(M * N);
+            std::vector<AccDataType> t_imag(M * N);
+            std::vector<AccDataType> t_sum(M * N);
+
+            host_gemm_blocked(a_real.data(), b_real.data(), t_real.data(), M, N, K);
+            host_gemm_blocked(a_imag.data(), b_imag.data(), t_imag.data(), M, N, K);
+            host_gemm_blocked(a_sum.data(), b_sum.data(), t_sum.data(), M, N, K);
+
+            const StaticTensorView<CDataType, 2> c_real{arg.c_m_n_real_};
+            const StaticTensorView<CDataType, 2> c_imag{arg.c_m_n_imag_};
+
+            auto f_mn = [&](auto m, auto n) {
+                const std::size_t i = m * N + n;
+
+                c_real(m, n) =
+                    ck::type_convert<CDataType>(static_cast<float>(t_real[i] - t_imag[i]));
+                c_imag(m, n) = ck::type_convert<CDataType>(
+                    static_cast<float>(t_sum[i] - t_real[i] - t_imag[i]));
+            };
+
+            make_ParallelTensorFunctor(f_mn, M, N)(std::thread::hardware_concurrency());
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -138,15 +229,16 @@ struct ReferenceCGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_m_k_real,
-                             const Tensor<ADataType>& a_m_k_imag,
-                             const Tensor<BDataType>& b_k_n_real,
-                             const Tensor<BDataType>& b_k_n_imag,
-                             Tensor<CDataType>& c_m_n_real,
-                             Tensor<CDataType>& c_m_n_imag,
+    static auto MakeArgument(TensorView<const ADataType> a_m_k_real,
+                             TensorView<const ADataType> a_m_k_imag,
+                             TensorView<const BDataType> b_k_n_real,
+                             TensorView<const BDataType> b_k_n_imag,
+                             TensorView<CDataType> c_m_n_real,
+                             TensorView<CDataType> c_m_n_imag,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::Standard)
     {
         return Argument{a_m_k_real,
                         a_m_k_imag,
@@ -156,7 +248,8 @@ struct ReferenceCGemm : public device::BaseOperator
                         c_m_n_imag,
                         a_element_op,
                         b_element_op,
-                        c_element_op};
+                        c_element_op,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
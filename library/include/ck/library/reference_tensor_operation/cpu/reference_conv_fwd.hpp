@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <sstream>
 
+#include "ck/host_utility/trace.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
@@ -98,30 +99,41 @@ struct ReferenceConvFwd : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            const StaticTensorView<const InDataType, NDimSpatial + 3> input{arg.input_};
+            const StaticTensorView<const WeiDataType, NDimSpatial + 3> weight{arg.weight_};
+            const StaticTensorView<OutDataType, NDimSpatial + 3> output{arg.output_};
+
+            CK_TRACE_ZONE(zone, "reference", "ReferenceConvFwd");
+            zone.AddArg("NDimSpatial", NDimSpatial);
+            zone.AddArg("G", output.GetLengths()[0]);
+            zone.AddArg("N", output.GetLengths()[1]);
+            zone.AddArg("K", output.GetLengths()[2]);
+            zone.AddArg("C", weight.GetLengths()[2]);
+
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
                     float v_acc = 0;
 
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                    for(std::size_t c = 0; c < weight.GetLengths()[2]; ++c)
                     {
-                        for(std::size_t x = 0; x < arg.weight_.GetLengths()[3]; ++x)
+                        for(std::size_t x = 0; x < weight.GetLengths()[3]; ++x)
                         {
                             auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
                                       static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
                                       static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
 
                             if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[3])
+                               ck::type_convert<std::size_t>(wi) < input.GetLengths()[3])
                             {
                                 float v_in;
                                 float v_wei;
 
                                 arg.in_element_op_(
-                                    v_in, ck::type_convert<float>(arg.input_(g, n, c, wi)));
+                                    v_in, ck::type_convert<float>(input(g, n, c, wi)));
 
                                 arg.wei_element_op_(
-                                    v_wei, ck::type_convert<float>(arg.weight_(g, k, c, x)));
+                                    v_wei, ck::type_convert<float>(weight(g, k, c, x)));
 
                                 v_acc += v_in * v_wei;
                             }
@@ -132,14 +144,14 @@ struct ReferenceConvFwd : public device::BaseOperator
 
                     arg.out_element_op_(v_out, v_acc);
 
-                    arg.output_(g, n, k, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(g, n, k, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3])(
+                                           output.GetLengths()[0],
+                                           output.GetLengths()[1],
+                                           output.GetLengths()[2],
+                                           output.GetLengths()[3])(
                     std::thread::hardware_concurrency());
 
                 return 0;
@@ -149,15 +161,15 @@ struct ReferenceConvFwd : public device::BaseOperator
                 auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
                     float v_acc = 0;
 
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                    for(std::size_t c = 0; c < weight.GetLengths()[2]; ++c)
                     {
-                        for(std::size_t y = 0; y < arg.weight_.GetLengths()[3]; ++y)
+                        for(std::size_t y = 0; y < weight.GetLengths()[3]; ++y)
                         {
                             auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
                                       static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
                                       static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
 
-                            for(std::size_t x = 0; x < arg.weight_.GetLengths()[4]; ++x)
+                            for(std::size_t x = 0; x < weight.GetLengths()[4]; ++x)
                             {
                                 auto wi =
                                     static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
@@ -165,18 +177,18 @@ struct ReferenceConvFwd : public device::BaseOperator
                                     static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
 
                                 if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) < arg.input_.GetLengths()[3] &&
+                                   ck::type_convert<std::size_t>(hi) < input.GetLengths()[3] &&
                                    wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[4])
+                                   ck::type_convert<std::size_t>(wi) < input.GetLengths()[4])
                                 {
                                     float v_in;
                                     float v_wei;
 
                                     arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(g, n, c, hi, wi)));
+                                        v_in, ck::type_convert<float>(input(g, n, c, hi, wi)));
 
                                     arg.wei_element_op_(
-                                        v_wei, ck::type_convert<float>(arg.weight_(g, k, c, y, x)));
+                                        v_wei, ck::type_convert<float>(weight(g, k, c, y, x)));
 
                                     v_acc += v_in * v_wei;
                                 }
@@ -188,15 +200,15 @@ struct ReferenceConvFwd : public device::BaseOperator
 
                     arg.out_element_op_(v_out, v_acc);
 
-                    arg.output_(g, n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(g, n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3],
-                                           arg.output_.GetLengths()[4])(
+                                           output.GetLengths()[0],
+                                           output.GetLengths()[1],
+                                           output.GetLengths()[2],
+                                           output.GetLengths()[3],
+                                           output.GetLengths()[4])(
                     std::thread::hardware_concurrency());
 
                 return 0;
@@ -206,20 +218,20 @@ struct ReferenceConvFwd : public device::BaseOperator
                 auto func = [&](auto g, auto n, auto k, auto d_o, auto ho, auto wo) {
                     float v_acc = 0;
 
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                    for(std::size_t c = 0; c < weight.GetLengths()[2]; ++c)
                     {
-                        for(std::size_t z = 0; z < arg.weight_.GetLengths()[3]; ++z)
+                        for(std::size_t z = 0; z < weight.GetLengths()[3]; ++z)
                         {
                             auto di = static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
                                       static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
                                       static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                            for(std::size_t y = 0; y < arg.weight_.GetLengths()[4]; ++y)
+                            for(std::size_t y = 0; y < weight.GetLengths()[4]; ++y)
                             {
                                 auto hi =
                                     static_cast<ck::long_index_t>(ho * arg.conv_strides_[1]) +
                                     static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]) -
                                     static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                                for(std::size_t x = 0; x < arg.weight_.GetLengths()[5]; ++x)
+                                for(std::size_t x = 0; x < weight.GetLengths()[5]; ++x)
                                 {
                                     auto wi =
                                         static_cast<ck::long_index_t>(wo * arg.conv_strides_[2]) +
@@ -227,24 +239,24 @@ struct ReferenceConvFwd : public device::BaseOperator
                                         static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
                                     if(di >= 0 &&
                                        ck::type_convert<std::size_t>(di) <
-                                           arg.input_.GetLengths()[3] &&
+                                           input.GetLengths()[3] &&
                                        hi >= 0 &&
                                        ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.GetLengths()[4] &&
+                                           input.GetLengths()[4] &&
                                        wi >= 0 &&
                                        ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.GetLengths()[5])
+                                           input.GetLengths()[5])
                                     {
                                         float v_in;
                                         float v_wei;
 
                                         arg.in_element_op_(v_in,
                                                            ck::type_convert<float>(
-                                                               arg.input_(g, n, c, di, hi, wi)));
+                                                               input(g, n, c, di, hi, wi)));
 
                                         arg.wei_element_op_(
                                             v_wei,
-                                            ck::type_convert<float>(arg.weight_(g, k, c, z, y, x)));
+                                            ck::type_convert<float>(weight(g, k, c, z, y, x)));
 
                                         v_acc += v_in * v_wei;
                                     }
@@ -257,16 +269,16 @@ struct ReferenceConvFwd : public device::BaseOperator
 
                     arg.out_element_op_(v_out, v_acc);
 
-                    arg.output_(g, n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    output(g, n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
                 };
 
                 make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3],
-                                           arg.output_.GetLengths()[4],
-                                           arg.output_.GetLengths()[5])(
+                                           output.GetLengths()[0],
+                                           output.GetLengths()[1],
+                                           output.GetLengths()[2],
+                                           output.GetLengths()[3],
+                                           output.GetLengths()[4],
+                                           output.GetLengths()[5])(
                     std::thread::hardware_concurrency());
 
                 return 0;
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_gemm_int8.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference int8 forward convolution with a requantization epilogue:
+//             out = cde_op(conv(in, wei), Ds...).
+//
+// @paragraph
+//             The convolution runs as an implicit GEMM on the int8 host GEMM engine: per group,
+//             GemmM = N * Wo..., GemmN = K and GemmK = C * X..., where rows of the im2col input
+//             are gathered tile by tile and never materialized as a whole. Accumulation is int32;
+//             each result is passed straight to the CDE element-wise operation together with the
+//             Ds values at the same output index (Activation_Mul_Clamp,
+//             Add_Activation_Mul_Clamp, the per-channel Mul2 variants, ...).
+//
+//             The result equals ReferenceConvFwd (float accumulation) followed by cde_op as long
+//             as float accumulation is exact, i.e. every partial sum stays within 2^24, and
+//             equals int32 device accumulation always.
+//
+// input descriptor in [G, N, C, Di, Hi, Wi] order
+// weight descriptor in [G, K, C, Z, Y, X] order
+// output and Ds descriptors in [G, N, K, Do, Ho, Wo] order
+// phyiscal layout is irrelavent
+template <ck::index_t NDimSpatial,
+          typename EDataType,
+          typename CDEElementwiseOperation,
+          typename... DsDataType>
+struct ReferenceConvFwdQuantization : public device::BaseOperator
+{
+    static_assert(NDimSpatial >= 1 && NDimSpatial <= 3, "wrong! unsupported NDimSpatial");
+
+    static constexpr std::size_t NDim = NDimSpatial + 3;
+
+    using DsView = std::tuple<TensorView<const DsDataType>...>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(TensorView<const int8_t> input,
+                 TensorView<const int8_t> weight,
+                 const DsView& ds,
+                 TensorView<EDataType> output,
+                 std::vector<ck::index_t> conv_filter_strides,
+                 std::vector<ck::index_t> conv_filter_dilations,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 CDEElementwiseOperation cde_element_op)
+            : input_{input},
+              weight_{weight},
+              ds_{ds},
+              output_{output},
+              conv_strides_{conv_filter_strides},
+              conv_dilations_{conv_filter_dilations},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        TensorView<const int8_t> input_;
+        TensorView<const int8_t> weight_;
+        DsView ds_;
+        TensorView<EDataType> output_;
+
+        std::vector<index_t> conv_strides_;
+        std::vector<index_t> conv_dilations_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceConvFwdQuantization::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const StaticTensorView<const int8_t, NDim> input{arg.input_};
+            const StaticTensorView<const int8_t, NDim> weight{arg.weight_};
+            const StaticTensorView<EDataType, NDim> output{arg.output_};
+
+            const std::tuple<StaticTensorView<const DsDataType, NDim>...> ds = std::apply(
+                [](const auto&... d) {
+                    return std::tuple<StaticTensorView<const DsDataType, NDim>...>{d...};
+                },
+                arg.ds_);
+
+            std::apply(
+                [&](const auto&... d) {
+                    if(!((d.GetLengths() == output.GetLengths()) && ...))
+                    {
+                        throw std::runtime_error("wrong! Ds and output lengths mismatch");
+                    }
+                },
+                ds);
+
+            const auto& in_lengths  = input.GetLengths();
+            const auto& wei_lengths = weight.GetLengths();
+            const auto& out_lengths = output.GetLengths();
+
+            std::array<std::size_t, NDimSpatial> filter_lengths;
+            std::array<std::size_t, NDimSpatial> out_spatial_lengths;
+            std::copy(wei_lengths.begin() + 3, wei_lengths.end(), filter_lengths.begin());
+            std::copy(out_lengths.begin() + 3, out_lengths.end(), out_spatial_lengths.begin());
+
+            const std::size_t G = out_lengths[0];
+            const std::size_t N = out_lengths[1];
+            const std::size_t K = out_lengths[2];
+            const std::size_t C = wei_lengths[2];
+
+            const std::size_t filter_size      = get_size(filter_lengths);
+            const std::size_t out_spatial_size = get_size(out_spatial_lengths);
+
+            for(std::size_t g = 0; g < G; ++g)
+            {
+                // B[k][c * filter_size + x] = weight(g, k, c, x...)
+                const auto b_k_cx =
+                    ck::utils::host_gemm_int8_pack_b(K, C * filter_size, [&](auto k, auto cx) {
+                        std::array<std::size_t, NDim> idx;
+                        idx[0] = g;
+                        idx[1] = k;
+                        idx[2] = cx / filter_size;
+                        unflatten(cx % filter_size, filter_lengths, idx.begin() + 3);
+
+                        return weight(idx);
+                    });
+
+                // A[n * out_spatial_size + wo][c * filter_size + x], zero in the padding
+                auto f_load_a_row = [&](auto m, int8_t* p_row) {
+                    std::array<std::size_t, NDimSpatial> wo;
+                    unflatten(m % out_spatial_size, out_spatial_lengths, wo.begin());
+
+                    std::array<std::size_t, NDim> in_idx;
+                    in_idx[0] = g;
+                    in_idx[1] = m / out_spatial_size;
+
+                    std::array<std::size_t, NDimSpatial> x;
+                    for(std::size_t ix = 0; ix < filter_size; ++ix)
+                    {
+                        unflatten(ix, filter_lengths, x.begin());
+
+                        bool in_range = true;
+                        for(std::size_t d = 0; d < NDimSpatial; ++d)
+                        {
+                            const auto wi =
+                                static_cast<ck::long_index_t>(wo[d] * arg.conv_strides_[d]) +
+                                static_cast<ck::long_index_t>(x[d] * arg.conv_dilations_[d]) -
+                                static_cast<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                            in_range = in_range && wi >= 0 &&
+                                       ck::type_convert<std::size_t>(wi) < in_lengths[3 + d];
+                            in_idx[3 + d] = static_cast<std::size_t>(wi);
+                        }
+
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            in_idx[2] = c;
+                            p_row[c * filter_size + ix] = in_range ? input(in_idx) : int8_t{0};
+                        }
+                    }
+                };
+
+                auto f_epilogue = [&](auto m, auto k_begin, auto k_end, const int32_t* p_c) {
+                    std::array<std::size_t, NDim> out_idx;
+                    out_idx[0] = g;
+                    out_idx[1] = m / out_spatial_size;
+                    unflatten(m % out_spatial_size, out_spatial_lengths, out_idx.begin() + 3);
+
+                    for(auto k = k_begin; k < k_end; ++k)
+                    {
+                        out_idx[2] = k;
+
+                        const int32_t v_c = p_c[k - k_begin];
+
+                        std::apply(
+                            [&](const auto&... d) {
+                                arg.cde_element_op_(output(out_idx), v_c, d(out_idx)...);
+                            },
+                            ds);
+                    }
+                };
+
+                ck::utils::host_gemm_s8s8s32(
+                    N * out_spatial_size, b_k_cx, f_load_a_row, f_epilogue);
+            }
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /*stream_config*/ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+
+        private:
+        static std::size_t get_size(const std::array<std::size_t, NDimSpatial>& lengths)
+        {
+            std::size_t size = 1;
+            for(auto len : lengths)
+                size *= len;
+            return size;
+        }
+
+        // row-major multi-index of a flat index
+        template <typename OutputIt>
+        static void unflatten(std::size_t i,
+                              const std::array<std::size_t, NDimSpatial>& lengths,
+                              OutputIt idx)
+        {
+            for(std::size_t d = NDimSpatial; d-- > 0;)
+            {
+                idx[d] = i % lengths[d];
+                i /= lengths[d];
+            }
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(TensorView<const int8_t> input,
+                             TensorView<const int8_t> weight,
+                             const DsView& ds,
+                             TensorView<EDataType> output,
+                             std::vector<ck::index_t> conv_filter_strides,
+                             std::vector<ck::index_t> conv_filter_dilations,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{input,
+                        weight,
+                        ds,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceConvFwdQuantization"
+            << "<" << ck::utils::GetHostInt8DotString(ck::utils::GetHostInt8Dot()) << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/utility/tuple.hpp"
+#include "ck/host_utility/trace.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_permute.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+template <typename InDataTypeTuple, typename OutDataTypeTuple, typename ElementwiseOperation>
+struct ReferenceElementwise;
+
+//
+// @brief      Reference for DeviceElementwise / DevicePermute and multiple-D epilogues,
+//             element_op(outs(idx)..., ins(idx)...) for every index of the output lengths.
+//
+// @paragraph
+//             All operands are views with the lengths of the outputs and arbitrary strides, so
+//             NumPy style broadcasting is a zero stride (see TensorView::Broadcast) and a permute
+//             is a permuted output view. Unit dimensions are dropped, the rest are ordered by the
+//             strides of the first output and dimensions contiguous in every operand are merged.
+//             The innermost run is split into blocks which are distributed over threads; with a
+//             single output each block goes through ck::utils::HostElementwise, in place where
+//             an operand is contiguous and gathered / scattered otherwise, so element-wise
+//             operators with vectorized host specializations use them. A PassThrough between
+//             two tensors of the same type is a layout change and goes to ck::utils::host_permute.
+//
+template <typename... InDataTypes, typename... OutDataTypes, typename ElementwiseOperation>
+struct ReferenceElementwise<ck::Tuple<InDataTypes...>,
+                            ck::Tuple<OutDataTypes...>,
+                            ElementwiseOperation> : public device::BaseOperator
+{
+    static constexpr index_t NumInput  = sizeof...(InDataTypes);
+    static constexpr index_t NumOutput = sizeof...(OutDataTypes);
+
+    static constexpr bool IsCopy =
+        NumInput == 1 && NumOutput == 1 &&
+        std::is_same_v<ElementwiseOperation, element_wise::PassThrough> &&
+        std::is_same_v<ck::Tuple<InDataTypes...>, ck::Tuple<OutDataTypes...>>;
+
+    static_assert(NumOutput > 0, "wrong! at least one output is required");
+
+    using InTensorViews  = std::tuple<TensorView<const InDataTypes>...>;
+    using OutTensorViews = std::tuple<TensorView<OutDataTypes>...>;
+
+    // elements of the innermost run processed by one task
+    static constexpr std::size_t BlockSize = 4096;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const InTensorViews& in_tensors,
+                 const OutTensorViews& out_tensors,
+                 ElementwiseOperation element_op)
+            : in_tensors_{in_tensors}, out_tensors_{out_tensors}, element_op_{element_op}
+        {
+        }
+
+        InTensorViews in_tensors_;
+        OutTensorViews out_tensors_;
+
+        ElementwiseOperation element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceElementwise::Argument;
+
+        template <std::size_t... Os, std::size_t... Is>
+        static void RunBlock(const Argument& arg,
+                             const std::array<std::size_t, NumOutput + NumInput>& offsets,
+                             const std::array<std::size_t, NumOutput + NumInput>& strides,
+                             std::size_t n,
+                             std::index_sequence<Os...>,
+                             std::index_sequence<Is...>)
+        {
+            const auto p_outs =
+                std::make_tuple((std::get<Os>(arg.out_tensors_).data() + offsets[Os])...);
+            const auto p_ins = std::make_tuple(
+                (std::get<Is>(arg.in_tensors_).data() + offsets[NumOutput + Is])...);
+
+            if constexpr(NumOutput == 1)
+            {
+                using OutDataType = std::tuple_element_t<0, std::tuple<OutDataTypes...>>;
+
+                OutDataType* const p_out = std::get<0>(p_outs);
+
+                std::tuple<std::vector<InDataTypes>...> in_bufs;
+                std::vector<OutDataType> out_buf(strides[0] == 1 ? 0 : n);
+
+                const span<OutDataType> out{strides[0] == 1 ? p_out : out_buf.data(), n};
+
+                ck::utils::HostElementwise<ElementwiseOperation>::Apply(
+                    arg.element_op_,
+                    out,
+                    ck::utils::detail::gather_run(std::get<Is>(p_ins),
+                                                  strides[NumOutput + Is],
+                                                  n,
+                                                  std::get<Is>(in_bufs))...);
+
+                if(strides[0] != 1)
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                    {
+                        p_out[i * strides[0]] = out_buf[i];
+                    }
+                }
+            }
+            else
+            {
+                const bool contiguous =
+                    std::all_of(strides.begin(), strides.end(), [](auto s) { return s == 1; });
+
+                if(contiguous)
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                    {
+                        arg.element_op_(std::get<Os>(p_outs)[i]..., std::get<Is>(p_ins)[i]...);
+                    }
+                }
+                else
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                    {
+                        arg.element_op_(std::get<Os>(p_outs)[i * strides[Os]]...,
+                                        std::get<Is>(p_ins)[i * strides[NumOutput + Is]]...);
+                    }
+                }
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            CK_TRACE_ZONE(zone, "reference", "ReferenceElementwise");
+            zone.AddArg("NumInput", NumInput);
+            zone.AddArg("NumOutput", NumOutput);
+            zone.AddArg("size", std::get<0>(arg.out_tensors_).GetElementSize());
+
+            if constexpr(IsCopy)
+            {
+                ck::utils::host_permute(std::get<0>(arg.in_tensors_),
+                                        std::get<0>(arg.out_tensors_));
+
+                return 0;
+            }
+
+            constexpr std::size_t NumOperand = NumOutput + NumInput;
+
+            const auto& lengths = std::get<0>(arg.out_tensors_).GetLengths();
+
+            // outputs first, the first output decides the loop order
+            std::vector<std::vector<std::size_t>> operand_strides;
+
+            auto f_add_operand = [&](const auto& tensor) {
+                if(tensor.GetLengths() != lengths)
+                {
+                    throw std::runtime_error(
+                        "wrong! ReferenceElementwise: operand lengths differ from output lengths");
+                }
+
+                operand_strides.emplace_back(tensor.GetStrides().begin(),
+                                             tensor.GetStrides().end());
+            };
+
+            std::apply([&](const auto&... outs) { (f_add_operand(outs), ...); }, arg.out_tensors_);
+            std::apply([&](const auto&... ins) { (f_add_operand(ins), ...); }, arg.in_tensors_);
+
+            const auto loop = ck::utils::detail::make_host_elementwise_loop(
+                std::vector<std::size_t>(lengths.begin(), lengths.end()), operand_strides);
+
+            const std::size_t rank  = loop.lengths.size();
+            const std::size_t inner = loop.lengths.back();
+
+            std::size_t outer = 1;
+            for(std::size_t d = 0; d + 1 < rank; ++d)
+            {
+                outer *= loop.lengths[d];
+            }
+
+            if(outer * inner == 0)
+            {
+                return 0;
+            }
+
+            std::array<std::size_t, NumOperand> inner_strides;
+            for(std::size_t k = 0; k < NumOperand; ++k)
+            {
+                inner_strides[k] = loop.strides[k].back();
+            }
+
+            auto f_block = [&](auto i_outer, auto i_block) {
+                std::array<std::size_t, NumOperand> offsets{};
+
+                for(std::size_t d = rank - 1, i = i_outer; d-- > 0;)
+                {
+                    const std::size_t idx = i % loop.lengths[d];
+                    i /= loop.lengths[d];
+
+                    for(std::size_t k = 0; k < NumOperand; ++k)
+                    {
+                        offsets[k] += idx * loop.strides[k][d];
+                    }
+                }
+
+                const std::size_t begin = i_block * BlockSize;
+
+                for(std::size_t k = 0; k < NumOperand; ++k)
+                {
+                    offsets[k] += begin * inner_strides[k];
+                }
+
+                RunBlock(arg,
+                         offsets,
+                         inner_strides,
+                         std::min(BlockSize, inner - begin),
+                         std::make_index_sequence<NumOutput>{},
+                         std::make_index_sequence<NumInput>{});
+            };
+
+            make_ParallelTensorFunctor(f_block, outer, (inner + BlockSize - 1) / BlockSize)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const InTensorViews& in_tensors,
+                             const OutTensorViews& out_tensors,
+                             ElementwiseOperation element_op)
+    {
+        return Argument{in_tensors, out_tensors, element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceElementwise"
+            << "<" << NumInput << ", " << NumOutput << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "ck/host_utility/trace.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
@@ -25,9 +26,9 @@ struct ReferenceGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k,
-                 const Tensor<BDataType>& b_k_n,
-                 Tensor<CDataType>& c_m_n,
+        Argument(TensorView<const ADataType> a_m_k,
+                 TensorView<const BDataType> b_k_n,
+                 TensorView<CDataType> c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CElementwiseOperation c_element_op)
@@ -40,9 +41,9 @@ struct ReferenceGemm : public device::BaseOperator
         {
         }
 
-        const Tensor<ADataType>& a_m_k_;
-        const Tensor<BDataType>& b_k_n_;
-        Tensor<CDataType>& c_m_n_;
+        TensorView<const ADataType> a_m_k_;
+        TensorView<const BDataType> b_k_n_;
+        TensorView<CDataType> c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
@@ -56,8 +57,17 @@ struct ReferenceGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            const StaticTensorView<const ADataType, 2> a_m_k{arg.a_m_k_};
+            const StaticTensorView<const BDataType, 2> b_k_n{arg.b_k_n_};
+            const StaticTensorView<CDataType, 2> c_m_n{arg.c_m_n_};
+
+            CK_TRACE_ZONE(zone, "reference", "ReferenceGemm");
+            zone.AddArg("M", c_m_n.GetLengths()[0]);
+            zone.AddArg("N", c_m_n.GetLengths()[1]);
+            zone.AddArg("K", a_m_k.GetLengths()[1]);
+
             auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+                const int K = a_m_k.GetLengths()[1];
 
                 AccDataType v_acc = 0;
 
@@ -66,8 +76,8 @@ struct ReferenceGemm : public device::BaseOperator
                     ADataType v_a;
                     BDataType v_b;
 
-                    arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+                    arg.a_element_op_(v_a, a_m_k(m, k));
+                    arg.b_element_op_(v_b, b_k_n(k, n));
 
                     v_acc +=
                         ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
@@ -77,11 +87,10 @@ struct ReferenceGemm : public device::BaseOperator
 
                 arg.c_element_op_(v_c, v_acc);
 
-                arg.c_m_n_(m, n) = ck::type_convert<CDataType>(v_c);
+                c_m_n(m, n) = ck::type_convert<CDataType>(v_c);
             };
 
-            make_ParallelTensorFunctor(
-                f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
+            make_ParallelTensorFunctor(f_mk_kn_mn, c_m_n.GetLengths()[0], c_m_n.GetLengths()[1])(
                 std::thread::hardware_concurrency());
 
             return 0;
@@ -102,9 +111,9 @@ struct ReferenceGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
-                             const Tensor<BDataType>& b_k_n,
-                             Tensor<CDataType>& c_m_n,
+    static auto MakeArgument(TensorView<const ADataType> a_m_k,
+                             TensorView<const BDataType> b_k_n,
+                             TensorView<CDataType> c_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
                              CElementwiseOperation c_element_op)
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_gemm_int8.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/packed_int4.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference GEMM on packed int4 operands, C = c_op(A * B).
+//
+// @paragraph
+//             A (M x K) and B (K x N) stay packed two values per byte; the int8 host GEMM engine
+//             unpacks one K block of the rows of A and columns of B of a tile at a time, so
+//             neither operand is ever held unpacked as a whole. Accumulation is int32, then
+//             c_element_op(AccDataType&, int32_t) and type_convert<CDataType> are applied, like
+//             ReferenceGemm with AccDataType = int32_t.
+//
+template <typename CDataType, typename CElementwiseOperation>
+struct ReferenceGemmPackedInt4 : public device::BaseOperator
+{
+    using AccDataType = int32_t;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const PackedInt4Tensor& a_m_k,
+                 const PackedInt4Tensor& b_k_n,
+                 TensorView<CDataType> c_m_n,
+                 CElementwiseOperation c_element_op)
+            : a_m_k_{a_m_k}, b_k_n_{b_k_n}, c_m_n_{c_m_n}, c_element_op_{c_element_op}
+        {
+        }
+
+        const PackedInt4Tensor& a_m_k_;
+        const PackedInt4Tensor& b_k_n_;
+        TensorView<CDataType> c_m_n_;
+
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmPackedInt4::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const auto& a_m_k = arg.a_m_k_;
+            const auto& b_k_n = arg.b_k_n_;
+
+            const StaticTensorView<CDataType, 2> c_m_n{arg.c_m_n_};
+
+            const std::size_t M = c_m_n.GetLengths()[0];
+            const std::size_t N = c_m_n.GetLengths()[1];
+            const std::size_t K = a_m_k.GetLengths()[1];
+
+            // n values of a packed tensor from element offset on, stride elements apart
+            auto f_unpack = [](const PackedInt4Tensor& t,
+                               std::size_t offset,
+                               std::size_t stride,
+                               std::size_t n,
+                               int8_t* p_dst) {
+                if(stride == 1 && n != 0)
+                {
+                    // bulk unpack from the first byte boundary
+                    const std::size_t head = offset % 2;
+
+                    if(head != 0)
+                        p_dst[0] = ck::utils::get_packed_int4(t.data(), offset);
+
+                    ck::utils::detail::unpack_int4_chunk(t.data() + (offset + head) / 2,
+                                                         p_dst + head,
+                                                         n - head,
+                                                         ck::utils::GetHostSimd());
+                }
+                else
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                        p_dst[i] = ck::utils::get_packed_int4(t.data(), offset + i * stride);
+                }
+            };
+
+            auto f_load_a = [&](auto m, auto k_begin, auto k_end, int8_t* p_row) {
+                f_unpack(a_m_k,
+                         a_m_k.mDesc.GetOffsetFromMultiIndex(m, k_begin),
+                         a_m_k.GetStrides()[1],
+                         k_end - k_begin,
+                         p_row);
+            };
+
+            auto f_load_b = [&](auto n, auto k_begin, auto k_end, int8_t* p_row) {
+                f_unpack(b_k_n,
+                         b_k_n.mDesc.GetOffsetFromMultiIndex(k_begin, n),
+                         b_k_n.GetStrides()[0],
+                         k_end - k_begin,
+                         p_row);
+            };
+
+            auto f_epilogue = [&](auto m, auto n_begin, auto n_end, const int32_t* p_c) {
+                for(auto n = n_begin; n < n_end; ++n)
+                {
+                    AccDataType v_c;
+
+                    arg.c_element_op_(v_c, p_c[n - n_begin]);
+
+                    c_m_n(m, n) = ck::type_convert<CDataType>(v_c);
+                }
+            };
+
+            ck::utils::host_gemm_s8s8s32(M, N, K, f_load_a, f_load_b, f_epilogue);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const PackedInt4Tensor& a_m_k,
+                             const PackedInt4Tensor& b_k_n,
+                             TensorView<CDataType> c_m_n,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{a_m_k, b_k_n, c_m_n, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmPackedInt4"
+            << "<" << ck::utils::GetHostInt8DotString(ck::utils::GetHostInt8Dot()) << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_gemm_int8.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference int8 GEMM with a requantization epilogue: E = cde_op(A * B, Ds...).
+//
+// @paragraph
+//             A and B are int8 and are multiplied with int32 accumulation on the int8 host
+//             GEMM engine (VNNI / AVX2 where available). Each int32 result is passed straight to
+//             the CDE element-wise operation together with the Ds values at the same (m, n),
+//             e.g. Activation_Mul_Clamp, Add_Activation_Mul_Clamp or the per-channel Mul2
+//             variants. Ds have the shape of E; broadcast them with TensorView::Broadcast.
+//
+//             The result equals ReferenceGemm (float accumulation) followed by cde_op as long
+//             as float accumulation is exact, i.e. every partial sum stays within 2^24, and
+//             equals int32 device accumulation always.
+//
+// @tparam     EDataType                Output data type.
+// @tparam     CDEElementwiseOperation  Functor called as op(e, c_int32, ds...).
+// @tparam     DsDataType               Data types of the auxiliary tensors.
+//
+template <typename EDataType, typename CDEElementwiseOperation, typename... DsDataType>
+struct ReferenceGemmQuantization : public device::BaseOperator
+{
+    using DsView = std::tuple<TensorView<const DsDataType>...>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(TensorView<const int8_t> a_m_k,
+                 TensorView<const int8_t> b_k_n,
+                 const DsView& ds_m_n,
+                 TensorView<EDataType> e_m_n,
+                 CDEElementwiseOperation cde_element_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              ds_m_n_{ds_m_n},
+              e_m_n_{e_m_n},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        TensorView<const int8_t> a_m_k_;
+        TensorView<const int8_t> b_k_n_;
+        DsView ds_m_n_;
+        TensorView<EDataType> e_m_n_;
+
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmQuantization::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const StaticTensorView<const int8_t, 2> a_m_k{arg.a_m_k_};
+            const StaticTensorView<const int8_t, 2> b_k_n{arg.b_k_n_};
+            const StaticTensorView<EDataType, 2> e_m_n{arg.e_m_n_};
+
+            const std::tuple<StaticTensorView<const DsDataType, 2>...> ds_m_n = std::apply(
+                [](const auto&... ds) {
+                    return std::tuple<StaticTensorView<const DsDataType, 2>...>{ds...};
+                },
+                arg.ds_m_n_);
+
+            const std::size_t M = e_m_n.GetLengths()[0];
+            const std::size_t N = e_m_n.GetLengths()[1];
+            const std::size_t K = a_m_k.GetLengths()[1];
+
+            std::apply(
+                [&](const auto&... ds) {
+                    if(!((ds.GetLengths() == e_m_n.GetLengths()) && ...))
+                    {
+                        throw std::runtime_error("wrong! Ds and E lengths mismatch");
+                    }
+                },
+                ds_m_n);
+
+            const auto b_n_k = ck::utils::host_gemm_int8_pack_b(
+                N, K, [&](auto n, auto k) { return b_k_n(k, n); });
+
+            auto f_load_a_row = [&](auto m, int8_t* p_row) {
+                if(K != 0 && a_m_k.GetStrides()[1] == 1)
+                {
+                    std::copy(&a_m_k(m, 0), &a_m_k(m, 0) + K, p_row);
+                }
+                else
+                {
+                    for(std::size_t k = 0; k < K; ++k)
+                        p_row[k] = a_m_k(m, k);
+                }
+            };
+
+            auto f_epilogue = [&](auto m, auto n_begin, auto n_end, const int32_t* p_c) {
+                for(auto n = n_begin; n < n_end; ++n)
+                {
+                    const int32_t v_c = p_c[n - n_begin];
+
+                    std::apply(
+                        [&](const auto&... ds) {
+                            arg.cde_element_op_(e_m_n(m, n), v_c, ds(m, n)...);
+                        },
+                        ds_m_n);
+                }
+            };
+
+            ck::utils::host_gemm_s8s8s32(M, b_n_k, f_load_a_row, f_epilogue);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(TensorView<const int8_t> a_m_k,
+                             TensorView<const int8_t> b_k_n,
+                             const DsView& ds_m_n,
+                             TensorView<EDataType> e_m_n,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{a_m_k, b_k_n, ds_m_n, e_m_n, cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmQuantization"
+            << "<" << ck::utils::GetHostInt8DotString(ck::utils::GetHostInt8Dot()) << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
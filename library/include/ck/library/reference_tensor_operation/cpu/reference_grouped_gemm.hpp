@@ -0,0 +1,373 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/host_utility/trace.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference for DeviceGroupedGemm, C_i = c_op(a_op(A_i) * b_op(B_i)) for every group.
+//
+// @paragraph
+//             Takes the host pointers and the GemmDesc vector of DeviceGroupedGemm. The groups are
+//             cut into work items of rows of similar cost (M x N x K multiply-adds): large groups
+//             are split into row blocks, groups much smaller than an item are packed together.
+//             One team of threads pulls items, most expensive first, so the run time follows the
+//             total flops rather than the number of groups. Each B_i is converted to AccDataType
+//             once; every C_i(m, n) accumulates over k in order, like ReferenceGemm.
+//
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct ReferenceGroupedGemm : public device::BaseOperator
+{
+    // work items per thread, so that threads finishing early can pick up the tail
+    static constexpr std::size_t ItemsPerThread = 8;
+
+    // multiply-adds below which a work item is not split any further
+    static constexpr std::size_t MinItemCost = 1 << 16;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::vector<const ADataType*>& p_as,
+                 const std::vector<const BDataType*>& p_bs,
+                 const std::vector<CDataType*>& p_cs,
+                 const std::vector<device::GemmDesc>& gemm_descs,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : p_as_{p_as},
+              p_bs_{p_bs},
+              p_cs_{p_cs},
+              gemm_descs_{gemm_descs},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        std::vector<const ADataType*> p_as_;
+        std::vector<const BDataType*> p_bs_;
+        std::vector<CDataType*> p_cs_;
+
+        std::vector<device::GemmDesc> gemm_descs_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGroupedGemm::Argument;
+
+        // rows [m_begin, m_end) of one group
+        struct Segment
+        {
+            std::size_t group;
+            std::size_t m_begin;
+            std::size_t m_end;
+        };
+
+        struct WorkItem
+        {
+            std::size_t cost = 0;
+            std::vector<Segment> segments;
+        };
+
+        template <typename Layout>
+        static std::size_t Offset(std::size_t row, std::size_t col, std::size_t stride)
+        {
+            if constexpr(std::is_same_v<Layout, tensor_layout::gemm::RowMajor>)
+            {
+                return row * stride + col;
+            }
+            else
+            {
+                return row + col * stride;
+            }
+        }
+
+        static std::size_t Cost(const device::GemmDesc& desc, std::size_t rows)
+        {
+            // K = 0 still writes c_op(0) to every element
+            return rows * desc.N_ * std::max<std::size_t>(desc.K_, 1);
+        }
+
+        // f(i) for i in [0, n), indices handed out to the threads one at a time
+        template <typename F>
+        static void ParallelForItems(std::size_t n, F f)
+        {
+            const std::size_t num_threads =
+                std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), n);
+
+            std::atomic<std::size_t> next{0};
+
+            auto f_worker = [&]() {
+                for(std::size_t i = next++; i < n; i = next++)
+                {
+                    f(i);
+                }
+            };
+
+            if(num_threads <= 1)
+            {
+                f_worker();
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+
+            for(std::size_t t = 0; t < num_threads; ++t)
+            {
+                threads.emplace_back(f_worker);
+            }
+
+            for(auto& t : threads)
+            {
+                t.join();
+            }
+        }
+
+        static std::vector<WorkItem> MakeWorkItems(const std::vector<device::GemmDesc>& descs)
+        {
+            std::size_t total_cost = 0;
+            for(const auto& desc : descs)
+            {
+                total_cost += Cost(desc, desc.M_);
+            }
+
+            const std::size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+            const std::size_t target_cost =
+                std::max(MinItemCost, total_cost / (num_threads * ItemsPerThread));
+
+            std::vector<WorkItem> items;
+            WorkItem small_groups;
+
+            for(std::size_t g = 0; g < descs.size(); ++g)
+            {
+                const auto& desc = descs[g];
+                const std::size_t M = desc.M_;
+
+                if(M == 0 || desc.N_ == 0)
+                {
+                    continue;
+                }
+
+                const std::size_t cost = Cost(desc, M);
+
+                if(cost < target_cost)
+                {
+                    small_groups.cost += cost;
+                    small_groups.segments.push_back({g, 0, M});
+
+                    if(small_groups.cost >= target_cost)
+                    {
+                        items.push_back(std::move(small_groups));
+                        small_groups = WorkItem{};
+                    }
+
+                    continue;
+                }
+
+                const std::size_t row_cost = Cost(desc, 1);
+                const std::size_t rows     = std::max<std::size_t>(1, target_cost / row_cost);
+
+                for(std::size_t m = 0; m < M; m += rows)
+                {
+                    const std::size_t m_end = std::min(M, m + rows);
+
+                    items.push_back(WorkItem{Cost(desc, m_end - m), {{g, m, m_end}}});
+                }
+            }
+
+            if(!small_groups.segments.empty())
+            {
+                items.push_back(std::move(small_groups));
+            }
+
+            // longest processing time first
+            std::sort(items.begin(), items.end(), [](const auto& x, const auto& y) {
+                return x.cost > y.cost;
+            });
+
+            return items;
+        }
+
+        float Run(const Argument& arg)
+        {
+            const auto& descs = arg.gemm_descs_;
+
+            const std::size_t group_count = descs.size();
+
+            if(arg.p_as_.size() != group_count || arg.p_bs_.size() != group_count ||
+               arg.p_cs_.size() != group_count)
+            {
+                throw std::runtime_error(
+                    "wrong! ReferenceGroupedGemm: number of A/B/C pointers and GemmDesc differ");
+            }
+
+            double flop = 0;
+
+            for(const auto& desc : descs)
+            {
+                flop += 2.0 * desc.M_ * desc.N_ * desc.K_;
+            }
+
+            CK_TRACE_ZONE(zone, "reference", "ReferenceGroupedGemm");
+            zone.AddArg("group_count", group_count);
+            zone.AddArg("flop", flop);
+
+            // b_op(B_i) in AccDataType, K x N row major
+            std::vector<std::vector<AccDataType>> b_k_n_acc(group_count);
+
+            ParallelForItems(group_count, [&](std::size_t g) {
+                const auto& desc    = descs[g];
+                const std::size_t K = desc.K_;
+                const std::size_t N = desc.N_;
+
+                const BDataType* p_b = arg.p_bs_[g];
+
+                auto& b = b_k_n_acc[g];
+                b.resize(K * N);
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        BDataType v_b;
+                        arg.b_element_op_(v_b, p_b[Offset<BLayout>(k, n, desc.stride_B_)]);
+
+                        b[k * N + n] = ck::type_convert<AccDataType>(v_b);
+                    }
+                }
+            });
+
+            const auto items = MakeWorkItems(descs);
+
+            ParallelForItems(items.size(), [&](std::size_t i) {
+                std::vector<AccDataType> acc;
+
+                for(const auto& segment : items[i].segments)
+                {
+                    const auto& desc    = descs[segment.group];
+                    const std::size_t K = desc.K_;
+                    const std::size_t N = desc.N_;
+
+                    const ADataType* p_a = arg.p_as_[segment.group];
+                    CDataType* p_c       = arg.p_cs_[segment.group];
+
+                    const AccDataType* p_b = b_k_n_acc[segment.group].data();
+
+                    acc.resize(N);
+
+                    for(std::size_t m = segment.m_begin; m < segment.m_end; ++m)
+                    {
+                        std::fill(acc.begin(), acc.end(), AccDataType{0});
+
+                        for(std::size_t k = 0; k < K; ++k)
+                        {
+                            ADataType v_a;
+                            arg.a_element_op_(v_a, p_a[Offset<ALayout>(m, k, desc.stride_A_)]);
+
+                            const AccDataType v_a_acc = ck::type_convert<AccDataType>(v_a);
+                            const AccDataType* p_b_k  = p_b + k * N;
+
+                            for(std::size_t n = 0; n < N; ++n)
+                            {
+                                acc[n] += v_a_acc * p_b_k[n];
+                            }
+                        }
+
+                        for(std::size_t n = 0; n < N; ++n)
+                        {
+                            AccDataType v_c;
+                            arg.c_element_op_(v_c, acc[n]);
+
+                            p_c[Offset<CLayout>(m, n, desc.stride_C_)] =
+                                ck::type_convert<CDataType>(v_c);
+                        }
+                    }
+                }
+            });
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const std::vector<const ADataType*>& p_as,
+                             const std::vector<const BDataType*>& p_bs,
+                             const std::vector<CDataType*>& p_cs,
+                             const std::vector<device::GemmDesc>& gemm_descs,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{
+            p_as, p_bs, p_cs, gemm_descs, a_element_op, b_element_op, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGroupedGemm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
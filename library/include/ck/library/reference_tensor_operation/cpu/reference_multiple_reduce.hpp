@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/functional2.hpp"
+#include "ck/utility/reduction_functions_accumulate.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/utility/tuple.hpp"
+#include "ck/host_utility/trace.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataTypeTuple,
+          typename ReduceOperationTuple,
+          typename InElementwiseOperationTuple,
+          typename AccElementwiseOperationTuple,
+          bool PropagateNan = false>
+struct ReferenceMultipleReduce;
+
+//
+// @brief      Reference for DeviceMultipleReduce and the reductions fused into GEMM / convolution
+//             epilogues, out_i = acc_op_i(reduce_i(in_op_i(in))) over the given dimensions of in.
+//
+// @paragraph
+//             All reductions are computed in one pass: every input element is read once,
+//             converted to AccDataType and fed through each in_op_i into the accumulator of
+//             reduce_i, starting from its GetIdentityValue(). Output i holds the invariant
+//             dimensions of in in their original order (lengths {1} when every dimension is
+//             reduced) with arbitrary strides. Invariant and reduced dimensions are collapsed
+//             separately; when the fastest invariant dimension has the smaller input stride a
+//             tile of neighbouring outputs is accumulated side by side, so a reduction over an
+//             outer dimension still streams through memory. Tiles are distributed over threads.
+//
+template <typename InDataType,
+          typename AccDataType,
+          typename... OutDataTypes,
+          typename ReduceOperationTuple,
+          typename InElementwiseOperationTuple,
+          typename AccElementwiseOperationTuple,
+          bool PropagateNan>
+struct ReferenceMultipleReduce<InDataType,
+                               AccDataType,
+                               ck::Tuple<OutDataTypes...>,
+                               ReduceOperationTuple,
+                               InElementwiseOperationTuple,
+                               AccElementwiseOperationTuple,
+                               PropagateNan> : public device::BaseOperator
+{
+    static constexpr index_t NumReduction = sizeof...(OutDataTypes);
+
+    static_assert(NumReduction > 0, "wrong! at least one reduction is required");
+    static_assert(ReduceOperationTuple::Size() == NumReduction &&
+                      InElementwiseOperationTuple::Size() == NumReduction &&
+                      AccElementwiseOperationTuple::Size() == NumReduction,
+                  "wrong! every reduction needs a ReduceOperation and in/acc element-ops");
+
+    using OutTensorViews = std::tuple<TensorView<OutDataTypes>...>;
+
+    // at most this many outputs are accumulated together by one task
+    static constexpr std::size_t TileSize = 256;
+
+    // reduced elements below which outputs reduced one after the other share a task
+    static constexpr std::size_t MinTileWork = 1 << 16;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const TensorView<const InDataType>& in_tensor,
+                 const OutTensorViews& out_tensors,
+                 const std::vector<int>& reduce_dims,
+                 InElementwiseOperationTuple in_element_ops,
+                 AccElementwiseOperationTuple acc_element_ops)
+            : in_tensor_{in_tensor},
+              out_tensors_{out_tensors},
+              reduce_dims_{reduce_dims},
+              in_element_ops_{in_element_ops},
+              acc_element_ops_{acc_element_ops}
+        {
+        }
+
+        TensorView<const InDataType> in_tensor_;
+        OutTensorViews out_tensors_;
+
+        std::vector<int> reduce_dims_;
+
+        InElementwiseOperationTuple in_element_ops_;
+        AccElementwiseOperationTuple acc_element_ops_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceMultipleReduce::Argument;
+
+        using Accumulators = std::array<std::array<AccDataType, TileSize>, NumReduction>;
+
+        static void Init(Accumulators& acc, std::size_t n)
+        {
+            static_for<0, NumReduction, 1>{}([&](auto I) {
+                using ReduceOperation = remove_cvref_t<tuple_element_t<I, ReduceOperationTuple>>;
+
+                std::fill_n(acc[I].begin(),
+                            n,
+                            ReduceOperation::template GetIdentityValue<AccDataType>());
+            });
+        }
+
+        static void
+        Accumulate(const Argument& arg, Accumulators& acc, std::size_t i, const InDataType& x)
+        {
+            const AccDataType v = ck::type_convert<AccDataType>(x);
+
+            static_for<0, NumReduction, 1>{}([&](auto I) {
+                using ReduceOperation = remove_cvref_t<tuple_element_t<I, ReduceOperationTuple>>;
+                using Accumulation =
+                    ck::detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>;
+
+                AccDataType v_i;
+                arg.in_element_ops_[I](v_i, v);
+
+                Accumulation::Calculate(acc[I][i], v_i);
+            });
+        }
+
+        template <std::size_t... Is>
+        static void Store(const Argument& arg,
+                          Accumulators& acc,
+                          std::size_t i,
+                          const std::array<std::size_t, NumReduction>& offsets,
+                          std::index_sequence<Is...>)
+        {
+            (arg.acc_element_ops_[Number<Is>{}](acc[Is][i], acc[Is][i]), ...);
+
+            ((std::get<Is>(arg.out_tensors_).data()[offsets[Is]] =
+                  ck::type_convert<OutDataTypes>(acc[Is][i])),
+             ...);
+        }
+
+        float Run(const Argument& arg)
+        {
+            const auto& in_lengths = arg.in_tensor_.GetLengths();
+            const auto& in_strides = arg.in_tensor_.GetStrides();
+
+            const std::size_t rank = in_lengths.size();
+
+            std::vector<bool> is_reduce_dim(rank, false);
+
+            for(const int d : arg.reduce_dims_)
+            {
+                if(d < 0 || static_cast<std::size_t>(d) >= rank || is_reduce_dim[d])
+                {
+                    throw std::runtime_error(
+                        "wrong! ReferenceMultipleReduce: invalid or repeated reduce dimension");
+                }
+
+                is_reduce_dim[d] = true;
+            }
+
+            // operand 0 is the input, followed by the outputs
+            std::vector<std::size_t> invariant_lengths;
+            std::vector<std::vector<std::size_t>> invariant_strides(1 + NumReduction);
+
+            std::vector<std::size_t> reduce_lengths;
+            std::vector<std::vector<std::size_t>> reduce_strides(1);
+
+            for(std::size_t d = 0; d < rank; ++d)
+            {
+                if(is_reduce_dim[d])
+                {
+                    reduce_lengths.push_back(in_lengths[d]);
+                    reduce_strides[0].push_back(in_strides[d]);
+                }
+                else
+                {
+                    invariant_lengths.push_back(in_lengths[d]);
+                    invariant_strides[0].push_back(in_strides[d]);
+                }
+            }
+
+            CK_TRACE_ZONE(zone, "reference", "ReferenceMultipleReduce");
+            zone.AddArg("NumReduction", NumReduction);
+            zone.AddArg("size", arg.in_tensor_.GetElementSize());
+            zone.AddArg("reduce_size",
+                        std::accumulate(reduce_lengths.begin(),
+                                        reduce_lengths.end(),
+                                        std::size_t{1},
+                                        std::multiplies<std::size_t>{}));
+
+            std::size_t k = 1;
+
+            auto f_add_output = [&](const auto& out) {
+                const auto& out_lengths = out.GetLengths();
+
+                const bool scalar = invariant_lengths.empty() && out_lengths.size() == 1 &&
+                                    out_lengths[0] == 1;
+
+                if(!scalar && out_lengths != invariant_lengths)
+                {
+                    throw std::runtime_error("wrong! ReferenceMultipleReduce: output lengths "
+                                             "differ from the invariant lengths of the input");
+                }
+
+                if(!scalar)
+                {
+                    invariant_strides[k].assign(out.GetStrides().begin(), out.GetStrides().end());
+                }
+
+                ++k;
+            };
+
+            std::apply([&](const auto&... outs) { (f_add_output(outs), ...); }, arg.out_tensors_);
+
+            const auto invariant_loop =
+                ck::utils::detail::make_host_elementwise_loop(invariant_lengths, invariant_strides);
+            const auto reduce_loop =
+                ck::utils::detail::make_host_elementwise_loop(reduce_lengths, reduce_strides);
+
+            // input offsets of the reduced elements, innermost reduce dimension excluded
+            const std::size_t reduce_rank   = reduce_loop.lengths.size();
+            const std::size_t reduce_inner  = reduce_loop.lengths.back();
+            const std::size_t reduce_stride = reduce_loop.strides[0].back();
+
+            std::vector<std::size_t> reduce_offsets{0};
+
+            for(std::size_t d = 0; d + 1 < reduce_rank; ++d)
+            {
+                std::vector<std::size_t> offsets;
+                offsets.reserve(reduce_offsets.size() * reduce_loop.lengths[d]);
+
+                for(const auto offset : reduce_offsets)
+                {
+                    for(std::size_t i = 0; i < reduce_loop.lengths[d]; ++i)
+                    {
+                        offsets.push_back(offset + i * reduce_loop.strides[0][d]);
+                    }
+                }
+
+                reduce_offsets = std::move(offsets);
+            }
+
+            if(reduce_inner == 0)
+            {
+                reduce_offsets.clear();
+            }
+
+            const std::size_t invariant_rank  = invariant_loop.lengths.size();
+            const std::size_t invariant_inner = invariant_loop.lengths.back();
+
+            std::size_t invariant_outer = 1;
+            for(std::size_t d = 0; d + 1 < invariant_rank; ++d)
+            {
+                invariant_outer *= invariant_loop.lengths[d];
+            }
+
+            if(invariant_outer * invariant_inner == 0)
+            {
+                return 0;
+            }
+
+            std::array<std::size_t, NumReduction> out_inner_strides;
+            for(std::size_t r = 0; r < NumReduction; ++r)
+            {
+                out_inner_strides[r] = invariant_loop.strides[1 + r].back();
+            }
+
+            const std::size_t in_inner_stride = invariant_loop.strides[0].back();
+
+            // neighbouring outputs are closer in memory than neighbouring reduced elements
+            const bool by_column = invariant_inner > 1 && in_inner_stride < reduce_stride;
+
+            const std::size_t reduce_total = reduce_offsets.size() * reduce_inner;
+
+            const std::size_t tile_size =
+                by_column ? TileSize
+                          : std::clamp<std::size_t>(
+                                MinTileWork / std::max<std::size_t>(reduce_total, 1), 1, TileSize);
+
+            auto f_tile = [&](auto i_outer, auto i_tile) {
+                std::size_t in_offset = 0;
+                std::array<std::size_t, NumReduction> out_offsets{};
+
+                for(std::size_t d = invariant_rank - 1, i = i_outer; d-- > 0;)
+                {
+                    const std::size_t idx = i % invariant_loop.lengths[d];
+                    i /= invariant_loop.lengths[d];
+
+                    in_offset += idx * invariant_loop.strides[0][d];
+
+                    for(std::size_t r = 0; r < NumReduction; ++r)
+                    {
+                        out_offsets[r] += idx * invariant_loop.strides[1 + r][d];
+                    }
+                }
+
+                const std::size_t begin = i_tile * tile_size;
+                const std::size_t n     = std::min(tile_size, invariant_inner - begin);
+
+                const InDataType* p_in =
+                    arg.in_tensor_.data() + in_offset + begin * in_inner_stride;
+
+                Accumulators acc;
+                Init(acc, n);
+
+                if(by_column)
+                {
+                    for(const auto offset : reduce_offsets)
+                    {
+                        for(std::size_t j = 0; j < reduce_inner; ++j)
+                        {
+                            const InDataType* p = p_in + offset + j * reduce_stride;
+
+                            for(std::size_t i = 0; i < n; ++i)
+                            {
+                                Accumulate(arg, acc, i, p[i * in_inner_stride]);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                    {
+                        for(const auto offset : reduce_offsets)
+                        {
+                            const InDataType* p = p_in + i * in_inner_stride + offset;
+
+                            for(std::size_t j = 0; j < reduce_inner; ++j)
+                            {
+                                Accumulate(arg, acc, i, p[j * reduce_stride]);
+                            }
+                        }
+                    }
+                }
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    std::array<std::size_t, NumReduction> offsets;
+                    for(std::size_t r = 0; r < NumReduction; ++r)
+                    {
+                        offsets[r] = out_offsets[r] + (begin + i) * out_inner_strides[r];
+                    }
+
+                    Store(arg, acc, i, offsets, std::index_sequence_for<OutDataTypes...>{});
+                }
+            };
+
+            make_ParallelTensorFunctor(
+                f_tile, invariant_outer, (invariant_inner + tile_size - 1) / tile_size)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const TensorView<const InDataType>& in_tensor,
+                             const OutTensorViews& out_tensors,
+                             const std::vector<int>& reduce_dims,
+                             InElementwiseOperationTuple in_element_ops,
+                             AccElementwiseOperationTuple acc_element_ops)
+    {
+        return Argument{in_tensor, out_tensors, reduce_dims, in_element_ops, acc_element_ops};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceMultipleReduce"
+            << "<" << NumReduction << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
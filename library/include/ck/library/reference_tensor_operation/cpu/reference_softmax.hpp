@@ -22,8 +22,8 @@ struct ReferenceSoftmax : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<InDataType>& in,
-                 Tensor<OutDataType>& out,
+        Argument(TensorView<const InDataType> in,
+                 TensorView<OutDataType> out,
                  AccDataType alpha,
                  AccDataType beta,
                  const std::vector<index_t> sm_reduce_dims)
@@ -42,8 +42,8 @@ struct ReferenceSoftmax : public device::BaseOperator
             // std::cout << std::endl;
         }
 
-        const Tensor<InDataType>& in_;
-        Tensor<OutDataType>& out_;
+        TensorView<const InDataType> in_;
+        TensorView<OutDataType> out_;
         AccDataType alpha_;
         AccDataType beta_;
         std::vector<index_t> sm_reduce_dims_;
@@ -93,7 +93,7 @@ struct ReferenceSoftmax : public device::BaseOperator
             // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
             // std::endl;
 
-            Tensor<AccDataType> in_stable(arg.in_.mDesc);
+            Tensor<AccDataType> in_stable(arg.in_.mDesc.GetLengths());
             in_stable.ForEach([&](auto& self, auto idx) {
                 // numerator = exp(x - max(x))
                 self(idx) = std::exp(ck::type_convert<AccDataType>(arg.in_(idx)) -
@@ -141,8 +141,8 @@ struct ReferenceSoftmax : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<InDataType>& in,
-                             Tensor<OutDataType>& out,
+    static auto MakeArgument(TensorView<const InDataType> in,
+                             TensorView<OutDataType> out,
                              AccDataType alpha,
                              AccDataType beta,
                              const std::vector<index_t> sm_reduce_dims)
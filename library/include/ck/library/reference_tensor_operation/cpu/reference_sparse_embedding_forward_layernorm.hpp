@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+/**
+ * @brief      out[l, :] = layernorm(sum_i emb_i[index_i[l], :]) * gamma + beta
+ *
+ *             The argument only holds views, so embedding tables of any size (including
+ *             memory-mapped ones) are never copied. Each output row is produced in one pass:
+ *             the gathered rows are summed into a row buffer while the mean and variance are
+ *             accumulated with Welford's algorithm, then the row is normalized. Rows are
+ *             distributed over threads, and each thread prefetches the table rows of its next
+ *             output row while summing the current one.
+ */
+template <typename EmbType,
+          typename IndexType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          ck::index_t NumEmbeddings>
+struct ReferenceSparseEmbeddingForwardLayernorm : public device::BaseOperator
+{
+    static_assert(NumEmbeddings > 0, "wrong! need at least one embedding table");
+
+    using EmbTables = std::array<TensorView<const EmbType>, NumEmbeddings>;
+    using Indices   = std::array<TensorView<const IndexType>, NumEmbeddings>;
+
+    struct Argument : public device::BaseArgument
+    {
+        Argument(TensorView<OutType> output,
+                 const EmbTables& emb_tables,
+                 const Indices& indices,
+                 TensorView<const GammaDataType> gamma,
+                 TensorView<const BetaDataType> beta,
+                 ck::index_t NumRows,
+                 ck::index_t EmbeddingDim,
+                 ck::index_t IndexLength,
+                 AccDataType epsilon)
+            : output_(output),
+              emb_tables_(emb_tables),
+              indices_(indices),
+              gamma_(gamma),
+              beta_(beta),
+              NumRows_(NumRows),
+              EmbeddingDim_(EmbeddingDim),
+              IndexLength_(IndexLength),
+              epsilon_(epsilon)
+        {
+        }
+
+        TensorView<OutType> output_;
+        EmbTables emb_tables_;
+        Indices indices_;
+        TensorView<const GammaDataType> gamma_;
+        TensorView<const BetaDataType> beta_;
+        ck::index_t NumRows_;
+        ck::index_t EmbeddingDim_;
+        ck::index_t IndexLength_;
+        AccDataType epsilon_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceSparseEmbeddingForwardLayernorm::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const ck::index_t D = arg.EmbeddingDim_;
+            const ck::index_t L = arg.IndexLength_;
+            const ck::index_t E = arg.NumRows_;
+
+            // elements per cache line of a table row, the prefetch granularity
+            constexpr ck::index_t PrefetchStride =
+                std::max<ck::index_t>(64 / sizeof(EmbType), ck::index_t{1});
+
+            const auto embs    = make_static_views<2>(arg.emb_tables_);
+            const auto indices = make_static_views<1>(arg.indices_);
+
+            const StaticTensorView<const GammaDataType, 1> gamma{arg.gamma_};
+            const StaticTensorView<const BetaDataType, 1> beta{arg.beta_};
+            const StaticTensorView<OutType, 2> output{arg.output_};
+
+            // validate up front, exceptions cannot leave the worker threads
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                for(ck::index_t l = 0; l < L; ++l)
+                {
+                    const IndexType idx = indices[i](l);
+
+                    bool in_range = static_cast<uint64_t>(idx) < static_cast<uint64_t>(E);
+
+                    // no comparison of an unsigned index with 0
+                    if constexpr(std::is_signed_v<IndexType>)
+                    {
+                        in_range = in_range && idx >= 0;
+                    }
+
+                    if(!in_range)
+                    {
+                        throw(std::runtime_error("wrong! out of range"));
+                    }
+                }
+            }
+
+            // x is the row buffer of the calling thread
+            auto f_emb_per_row = [&](std::size_t l, std::vector<AccDataType>& x) {
+                std::fill(x.begin(), x.end(), AccDataType{0});
+
+                AccDataType mean = 0;
+                AccDataType m2   = 0;
+
+                for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                {
+                    const auto& emb      = embs[i];
+                    const IndexType row  = indices[i](l);
+                    const bool prefetch  = l + 1 < static_cast<std::size_t>(L);
+                    const IndexType next = prefetch ? indices[i](l + 1) : row;
+                    const bool last      = i == NumEmbeddings - 1;
+
+                    for(ck::index_t d = 0; d < D; ++d)
+                    {
+                        if(prefetch && d % PrefetchStride == 0)
+                        {
+                            __builtin_prefetch(&emb(next, d));
+                        }
+
+                        x[d] += ck::type_convert<AccDataType>(emb(row, d));
+
+                        if(last)
+                        {
+                            // Welford update, fused with the final sum
+                            const AccDataType delta = x[d] - mean;
+                            mean += delta / (d + 1);
+                            m2 += delta * (x[d] - mean);
+                        }
+                    }
+                }
+
+                const AccDataType var     = m2 / D;
+                const AccDataType inv_std = 1 / std::sqrt(var + arg.epsilon_);
+
+                for(ck::index_t d = 0; d < D; ++d)
+                {
+                    auto y_val = (x[d] - mean) * inv_std;
+                    y_val      = (y_val * ck::type_convert<AccDataType>(gamma(d))) +
+                            ck::type_convert<AccDataType>(beta(d));
+                    output(l, d) = ck::type_convert<OutType>(y_val);
+                }
+            };
+
+            // contiguous blocks of rows per thread, so the row buffer is allocated once per
+            // thread and the prefetched rows are the ones the thread sums next
+            const std::size_t num_thread =
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            const std::size_t rows_per_thread = (L + num_thread - 1) / num_thread;
+
+            auto f_emb_per_thread = [&](std::size_t it) {
+                std::vector<AccDataType> x(D);
+
+                const std::size_t l_end =
+                    std::min((it + 1) * rows_per_thread, static_cast<std::size_t>(L));
+
+                for(std::size_t l = it * rows_per_thread; l < l_end; ++l)
+                {
+                    f_emb_per_row(l, x);
+                }
+            };
+            make_ParallelTensorFunctor(f_emb_per_thread, num_thread)(num_thread);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+
+        private:
+        template <std::size_t NDim, typename T>
+        static auto make_static_views(const std::array<TensorView<const T>, NumEmbeddings>& views)
+        {
+            return make_static_views<NDim>(views, std::make_index_sequence<NumEmbeddings>{});
+        }
+
+        template <std::size_t NDim, typename T, std::size_t... Is>
+        static std::array<StaticTensorView<const T, NDim>, NumEmbeddings>
+        make_static_views(const std::array<TensorView<const T>, NumEmbeddings>& views,
+                          std::index_sequence<Is...>)
+        {
+            return {StaticTensorView<const T, NDim>{views[Is]}...};
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(TensorView<OutType> output,
+                             const EmbTables& emb_tables,
+                             const Indices& indices,
+                             TensorView<const GammaDataType> gamma,
+                             TensorView<const BetaDataType> beta,
+                             ck::index_t NumRows,
+                             ck::index_t EmbeddingDim,
+                             ck::index_t IndexLength,
+                             AccDataType epsilon)
+    {
+        return Argument(output,
+                        emb_tables,
+                        indices,
+                        gamma,
+                        beta,
+                        NumRows,
+                        EmbeddingDim,
+                        IndexLength,
+                        epsilon);
+    }
+
+    // three table interface of ReferenceSparseEmbedding3ForwardLayernorm
+    template <ck::index_t N = NumEmbeddings, typename = std::enable_if_t<N == 3>>
+    static auto MakeArgument(TensorView<OutType> output,
+                             TensorView<const EmbType> emb_a,
+                             TensorView<const EmbType> emb_b,
+                             TensorView<const EmbType> emb_c,
+                             TensorView<const IndexType> index_a,
+                             TensorView<const IndexType> index_b,
+                             TensorView<const IndexType> index_c,
+                             TensorView<const GammaDataType> gamma,
+                             TensorView<const BetaDataType> beta,
+                             ck::index_t NumRows,
+                             ck::index_t EmbeddingDim,
+                             ck::index_t IndexLength,
+                             AccDataType epsilon)
+    {
+        return Argument(output,
+                        EmbTables{emb_a, emb_b, emb_c},
+                        Indices{index_a, index_b, index_c},
+                        gamma,
+                        beta,
+                        NumRows,
+                        EmbeddingDim,
+                        IndexLength,
+                        epsilon);
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSparseEmbeddingForwardLayernorm"
+            << "<" << NumEmbeddings << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
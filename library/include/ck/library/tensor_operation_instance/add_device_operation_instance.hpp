@@ -3,20 +3,112 @@
 
 #pragma once
 
-#include <vector>
+#include <array>
+#include <memory>
+#include <string>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "ck/utility/functional2.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
 
+namespace detail {
+
+template <typename Op, typename = void>
+struct has_device_operation_tile : std::false_type
+{
+};
+
+template <typename Op>
+struct has_device_operation_tile<Op, std::void_t<decltype(Op::GetTile())>> : std::true_type
+{
+};
+
+template <typename NewOpInstance>
+constexpr DeviceOperationTile get_device_operation_tile()
+{
+    if constexpr(has_device_operation_tile<NewOpInstance>::value)
+    {
+        return NewOpInstance::GetTile();
+    }
+    else
+    {
+        return DeviceOperationTile{};
+    }
+}
+
+template <typename Op, typename = void>
+struct has_device_operation_capabilities : std::false_type
+{
+};
+
+template <typename Op>
+struct has_device_operation_capabilities<Op, std::void_t<decltype(Op::GetCapabilities())>>
+    : std::true_type
+{
+};
+
+// GEMM instances report their specialization with the tile
+template <typename NewOpInstance>
+constexpr DeviceOperationCapabilities get_device_operation_capabilities()
+{
+    if constexpr(has_device_operation_capabilities<NewOpInstance>::value)
+    {
+        return NewOpInstance::GetCapabilities();
+    }
+    else
+    {
+        DeviceOperationCapabilities capabilities{};
+
+        capabilities.gemm_spec_ = get_device_operation_tile<NewOpInstance>().gemm_spec_;
+
+        return capabilities;
+    }
+}
+
+template <typename NewOpInstance>
+std::string get_device_operation_type_string()
+{
+    return NewOpInstance{}.GetTypeString();
+}
+
+template <typename BaseOp, typename NewOpInstance>
+std::unique_ptr<BaseOp> make_device_operation_instance()
+{
+    static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
+                  "wrong! NewOpInstance should be derived from BaseOp");
+
+    return std::make_unique<NewOpInstance>();
+}
+
+template <typename BaseOp, typename NewOpInstances, std::size_t... Is>
+constexpr auto make_device_operation_instance_descriptors(std::index_sequence<Is...>)
+{
+    return std::array<DeviceOperationInstanceDescriptor<BaseOp>, sizeof...(Is)>{
+        {{&typeid(std::tuple_element_t<Is, NewOpInstances>),
+          get_device_operation_tile<std::tuple_element_t<Is, NewOpInstances>>(),
+          get_device_operation_capabilities<std::tuple_element_t<Is, NewOpInstances>>(),
+          &get_device_operation_type_string<std::tuple_element_t<Is, NewOpInstances>>,
+          &make_device_operation_instance<BaseOp, std::tuple_element_t<Is, NewOpInstances>>}...}};
+}
+
+} // namespace detail
+
 template <typename BaseOp, typename NewOpInstances>
 void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances,
                                     const NewOpInstances& new_op_instances)
 {
+    // set by FindInstanceById() for factories not on the registry
+    auto* p_makers = detail::device_operation_instance_makers<BaseOp>;
+
     ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
         const auto new_op_instance = std::get<i>(new_op_instances);
 
@@ -26,9 +118,32 @@ void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_ins
                       "wrong! NewOpInstance should be derived from BaseOp");
 
         op_instances.push_back(std::make_unique<NewOpInstance>(new_op_instance));
+
+        if(p_makers != nullptr)
+        {
+            p_makers->emplace(op_instances.back()->GetInstanceId(),
+                              &detail::make_device_operation_instance<BaseOp, NewOpInstance>);
+        }
     });
 }
 
+// descriptors of the instances of an instance tuple, one static table per tuple
+template <typename BaseOp, typename NewOpInstances>
+inline constexpr auto device_operation_instance_descriptors =
+    detail::make_device_operation_instance_descriptors<BaseOp, NewOpInstances>(
+        std::make_index_sequence<std::tuple_size_v<NewOpInstances>>{});
+
+// same as add_device_operation_instances(), but only records how to make the instances
+template <typename NewOpInstances, typename BaseOp>
+void add_device_operation_instance_descriptors(
+    DeviceOperationInstanceDescriptors<BaseOp>& op_descriptors)
+{
+    for(const auto& op_descriptor : device_operation_instance_descriptors<BaseOp, NewOpInstances>)
+    {
+        op_descriptors.push_back(&op_descriptor);
+    }
+}
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
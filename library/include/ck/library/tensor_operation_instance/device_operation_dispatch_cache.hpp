@@ -0,0 +1,404 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Signature of a problem: its lengths, strides and any other value the argument depends on, in an
+// order fixed by the caller. Not the buffer pointers, which every call passes to
+// DeviceOperationDispatchEntry::Run(). Holds up to max_size values in place, so that a lookup
+// does not allocate.
+class DeviceOperationProblemKey
+{
+    public:
+    static constexpr std::size_t max_size = 64;
+
+    DeviceOperationProblemKey() = default;
+
+    DeviceOperationProblemKey(std::initializer_list<int64_t> values)
+    {
+        for(const int64_t value : values)
+        {
+            PushBack(value);
+        }
+    }
+
+    // throws beyond max_size values
+    void PushBack(int64_t value)
+    {
+        if(size_ == max_size)
+        {
+            throw std::runtime_error("wrong! dispatch cache problem key too long");
+        }
+
+        values_[size_++] = value;
+    }
+
+    const int64_t* begin() const { return values_.data(); }
+
+    const int64_t* end() const { return values_.data() + size_; }
+
+    std::size_t size() const { return size_; }
+
+    friend bool operator==(const DeviceOperationProblemKey& lhs,
+                           const DeviceOperationProblemKey& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    private:
+    std::array<int64_t, max_size> values_{};
+    std::size_t size_ = 0;
+};
+
+struct DeviceOperationProblemKeyHash
+{
+    std::size_t operator()(const DeviceOperationProblemKey& key) const
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+
+        for(const int64_t value : key)
+        {
+            hash = (hash ^ static_cast<uint64_t>(value)) * 0x100000001b3ull;
+        }
+
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+// An instance with ready-to-launch arguments and an invoker for one problem
+template <typename DeviceOp>
+struct DeviceOperationDispatchEntry
+{
+    using MakeArgument = std::function<std::unique_ptr<BaseArgument>(DeviceOp&)>;
+
+    DeviceOperationDispatchEntry(std::unique_ptr<DeviceOp> op_ptr,
+                                 std::unique_ptr<BaseArgument> argument_ptr,
+                                 std::unique_ptr<BaseInvoker> invoker_ptr,
+                                 MakeArgument make_argument)
+        : op_ptr_{std::move(op_ptr)},
+          invoker_ptr_{std::move(invoker_ptr)},
+          make_argument_{std::move(make_argument)}
+    {
+        free_argument_ptrs_.push_back(std::move(argument_ptr));
+    }
+
+    // Runs the problem on the given buffers, numbered as in BaseArgument::SetInputPointer() and
+    // SetOutputPointer(). Each call takes an argument no other call is using, made with
+    // make_argument_ if there is none, and rebinds all its buffers; throws if they cannot be
+    // rebound, or if the argument has more buffers than given, which would keep those of a
+    // previous call.
+    float Run(std::initializer_list<const void*> p_inputs,
+              std::initializer_list<void*> p_outputs,
+              const StreamConfig& stream_config = StreamConfig{}) const
+    {
+        std::unique_ptr<BaseArgument> argument_ptr = AcquireArgument();
+
+        std::size_t i = 0;
+        for(const void* p : p_inputs)
+        {
+            if(!argument_ptr->SetInputPointer(i++, p))
+            {
+                throw std::runtime_error("wrong! dispatch cache argument input not rebound");
+            }
+        }
+
+        i = 0;
+        for(void* p : p_outputs)
+        {
+            if(!argument_ptr->SetOutputPointer(i++, p))
+            {
+                throw std::runtime_error("wrong! dispatch cache argument output not rebound");
+            }
+        }
+
+        if(argument_ptr->SetInputPointer(p_inputs.size(), nullptr) ||
+           argument_ptr->SetOutputPointer(p_outputs.size(), nullptr))
+        {
+            throw std::runtime_error("wrong! dispatch cache argument has more buffers than given");
+        }
+
+        const float time = invoker_ptr_->Run(argument_ptr.get(), stream_config);
+
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        free_argument_ptrs_.push_back(std::move(argument_ptr));
+
+        return time;
+    }
+
+    std::unique_ptr<DeviceOp> op_ptr_;
+    std::unique_ptr<BaseInvoker> invoker_ptr_;
+
+    // makes the arguments of concurrent calls, with any buffers
+    MakeArgument make_argument_;
+
+    // number of hits of the cache at the last use of the entry, for LRU eviction
+    mutable std::atomic<uint64_t> last_use_{0};
+
+    private:
+    std::unique_ptr<BaseArgument> AcquireArgument() const
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+
+            if(!free_argument_ptrs_.empty())
+            {
+                auto argument_ptr = std::move(free_argument_ptrs_.back());
+
+                free_argument_ptrs_.pop_back();
+
+                return argument_ptr;
+            }
+        }
+
+        return make_argument_(*op_ptr_);
+    }
+
+    mutable std::mutex mutex_;
+
+    // guarded by mutex_, the arguments not in use by a call
+    mutable std::vector<std::unique_ptr<BaseArgument>> free_argument_ptrs_;
+};
+
+// Picks the first of op_ptrs supporting the argument make_argument(op) makes for it, the same way
+// the examples and ckProfiler pick an instance. Throws if there is none. The entry keeps
+// make_argument to make the arguments of concurrent calls, so it has to capture the problem by
+// value; the buffers it makes the arguments with are only placeholders.
+template <typename DeviceOp, typename MakeArgument>
+std::unique_ptr<DeviceOperationDispatchEntry<DeviceOp>>
+MakeDeviceOperationDispatchEntry(std::vector<std::unique_ptr<DeviceOp>> op_ptrs,
+                                 MakeArgument make_argument)
+{
+    for(auto& op_ptr : op_ptrs)
+    {
+        std::unique_ptr<BaseArgument> argument_ptr = make_argument(*op_ptr);
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            std::unique_ptr<BaseInvoker> invoker_ptr = op_ptr->MakeInvokerPointer();
+
+            return std::make_unique<DeviceOperationDispatchEntry<DeviceOp>>(
+                std::move(op_ptr),
+                std::move(argument_ptr),
+                std::move(invoker_ptr),
+                typename DeviceOperationDispatchEntry<DeviceOp>::MakeArgument{
+                    std::move(make_argument)});
+        }
+    }
+
+    throw std::runtime_error("wrong! no instance supports the problem");
+}
+
+// Memoizes the chosen instance, its argument and its invoker per problem signature, so that a
+// repeated problem skips instance selection and argument construction.
+//
+// Lookups are read-mostly and lock-free: the entries form an immutable snapshot, published
+// through an atomic pointer, so a hit is a few atomic operations on integers and pointers, a hash
+// lookup and the copy of the entry's shared_ptr. Insertions copy the snapshot and evict the least
+// recently used entry beyond the capacity. A replaced snapshot is only freed once no lookup is in
+// progress, which the lookups count. Entries are shared, an evicted entry stays valid for as long
+// as a caller holds it.
+template <typename DeviceOp>
+class DeviceOperationDispatchCache
+{
+    public:
+    using Entry    = DeviceOperationDispatchEntry<DeviceOp>;
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    explicit DeviceOperationDispatchCache(std::size_t capacity)
+        : capacity_{capacity}, snapshot_{new Snapshot{}}
+    {
+        if(capacity == 0)
+        {
+            delete snapshot_.load(std::memory_order_relaxed);
+
+            throw std::runtime_error("wrong! dispatch cache capacity is 0");
+        }
+    }
+
+    DeviceOperationDispatchCache(const DeviceOperationDispatchCache&) = delete;
+    DeviceOperationDispatchCache& operator=(const DeviceOperationDispatchCache&) = delete;
+
+    ~DeviceOperationDispatchCache() { delete snapshot_.load(std::memory_order_relaxed); }
+
+    // nullptr on a miss
+    EntryPtr Find(const DeviceOperationProblemKey& key) const
+    {
+        num_lookups_.fetch_add(1, std::memory_order_seq_cst);
+
+        const Snapshot* snapshot = snapshot_.load(std::memory_order_seq_cst);
+
+        EntryPtr entry;
+
+        if(const auto it = snapshot->entries_.find(key); it != snapshot->entries_.end())
+        {
+            entry = it->second;
+        }
+
+        num_lookups_.fetch_sub(1, std::memory_order_release);
+
+        if(entry == nullptr)
+        {
+            num_misses_.fetch_add(1, std::memory_order_relaxed);
+
+            return nullptr;
+        }
+
+        entry->last_use_.store(num_hits_.fetch_add(1, std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+
+        return entry;
+    }
+
+    // On a miss, inserts the entry make_entry() returns, e.g. made with
+    // MakeDeviceOperationDispatchEntry(). Concurrent misses of the same key make a single entry.
+    // Nothing is inserted if make_entry() throws.
+    template <typename MakeEntry>
+    EntryPtr FindOrInsert(const DeviceOperationProblemKey& key, MakeEntry&& make_entry)
+    {
+        if(EntryPtr entry = Find(key))
+        {
+            return entry;
+        }
+
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        const Snapshot& current = *snapshot_.load(std::memory_order_relaxed);
+
+        // inserted by another thread since
+        if(const auto it = current.entries_.find(key); it != current.entries_.end())
+        {
+            return it->second;
+        }
+
+        EntryPtr entry = make_entry();
+
+        if(entry == nullptr)
+        {
+            throw std::runtime_error("wrong! no dispatch cache entry made");
+        }
+
+        entry->last_use_.store(num_hits_.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+
+        auto snapshot = std::make_unique<Snapshot>(current);
+
+        if(snapshot->entries_.size() >= capacity_)
+        {
+            auto lru = snapshot->entries_.begin();
+
+            for(auto it = snapshot->entries_.begin(); it != snapshot->entries_.end(); ++it)
+            {
+                if(it->second->last_use_.load(std::memory_order_relaxed) <
+                   lru->second->last_use_.load(std::memory_order_relaxed))
+                {
+                    lru = it;
+                }
+            }
+
+            snapshot->entries_.erase(lru);
+
+            ++num_evictions_;
+        }
+
+        snapshot->entries_.emplace(key, entry);
+
+        PublishLocked(std::move(snapshot));
+
+        return entry;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        PublishLocked(std::make_unique<Snapshot>());
+    }
+
+    std::size_t GetCapacity() const { return capacity_; }
+
+    std::size_t GetNumEntries() const
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        return snapshot_.load(std::memory_order_relaxed)->entries_.size();
+    }
+
+    uint64_t GetNumHits() const { return num_hits_.load(std::memory_order_relaxed); }
+
+    uint64_t GetNumMisses() const { return num_misses_.load(std::memory_order_relaxed); }
+
+    uint64_t GetNumEvictions() const
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        return num_evictions_;
+    }
+
+    private:
+    struct Snapshot
+    {
+        std::unordered_map<DeviceOperationProblemKey, EntryPtr, DeviceOperationProblemKeyHash>
+            entries_;
+    };
+
+    // Replaces the snapshot and frees the replaced ones if no lookup is in progress: a lookup
+    // starting after that loads the new snapshot. With mutex_ held.
+    void PublishLocked(std::unique_ptr<const Snapshot> snapshot)
+    {
+        retired_snapshots_.emplace_back(
+            snapshot_.exchange(snapshot.release(), std::memory_order_seq_cst));
+
+        if(num_lookups_.load(std::memory_order_seq_cst) == 0)
+        {
+            retired_snapshots_.clear();
+        }
+    }
+
+    const std::size_t capacity_;
+
+    // serializes the insertions, the lookups only load snapshot_ atomically
+    mutable std::mutex mutex_;
+
+    // owned, replaced under mutex_
+    std::atomic<const Snapshot*> snapshot_;
+
+    // lookups in progress, which may still read replaced snapshots
+    mutable std::atomic<std::size_t> num_lookups_{0};
+
+    // guarded by mutex_, the replaced snapshots not yet freed
+    std::vector<std::unique_ptr<const Snapshot>> retired_snapshots_;
+
+    // guarded by mutex_
+    uint64_t num_evictions_ = 0;
+
+    mutable std::atomic<uint64_t> num_hits_{0};
+    mutable std::atomic<uint64_t> num_misses_{0};
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
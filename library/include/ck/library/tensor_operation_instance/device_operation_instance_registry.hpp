@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_capabilities.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_tile.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Describes one instance of the instance library without constructing it. The descriptors of an
+// instance tuple form a constant-initialized table (see add_device_operation_instance.hpp), so
+// enumerating them neither allocates nor runs a device operation constructor.
+template <typename BaseOp>
+struct DeviceOperationInstanceDescriptor
+{
+    // same as BaseOperator::GetTypeIdName() and GetTypeIdHashCode() of the instance
+    std::string GetTypeIdName() const { return type_->name(); }
+
+    std::string GetTypeIdHashCode() const
+    {
+        std::ostringstream oss;
+
+        oss << std::hex << type_->hash_code();
+
+        return oss.str();
+    }
+
+    // same as BaseOperator::GetInstanceId() of the instance
+    uint64_t GetInstanceId() const { return MakeInstanceId(*type_); }
+
+    const DeviceOperationTile& GetTile() const { return tile_; }
+
+    const DeviceOperationCapabilities& GetCapabilities() const { return capabilities_; }
+
+    // same as BaseOperator::GetTypeString() of the instance, e.g. for listing instances; made
+    // from a temporary instance on the stack, so only call it when the name is needed
+    std::string GetTypeString() const { return get_type_string_(); }
+
+    std::unique_ptr<BaseOp> MakeInstance() const { return make_instance_(); }
+
+    const std::type_info* type_;
+    DeviceOperationTile tile_;
+    DeviceOperationCapabilities capabilities_;
+    std::string (*get_type_string_)();
+    std::unique_ptr<BaseOp> (*make_instance_)();
+};
+
+template <typename BaseOp>
+using DeviceOperationInstanceDescriptors =
+    std::vector<const DeviceOperationInstanceDescriptor<BaseOp>*>;
+
+// Lazy instance enumeration for a DeviceOperationInstanceFactory specialization. The factory only
+// provides
+//
+//   static void AddInstances(DeviceOperationInstanceDescriptors<DeviceOp>& instances);
+//
+// calling the add_device_*_instances functions, which fill a vector of descriptors; instances are
+// only ever constructed from those, so GetInstances() cannot list other instances than
+// GetInstanceDescriptors(). MakeInstance() takes the index of an instance in
+// GetInstanceDescriptors(), which is the same as in GetInstances(); FindInstanceById() takes the
+// build-stable BaseOperator::GetInstanceId().
+template <typename Factory, typename DeviceOp>
+struct DeviceOperationInstanceRegistry
+{
+    // collected once, on first use
+    static const DeviceOperationInstanceDescriptors<DeviceOp>& GetInstanceDescriptors()
+    {
+        static const auto descriptors = [] {
+            DeviceOperationInstanceDescriptors<DeviceOp> descs;
+
+            Factory::AddInstances(descs);
+
+            return descs;
+        }();
+
+        return descriptors;
+    }
+
+    static std::size_t GetNumInstances() { return GetInstanceDescriptors().size(); }
+
+    static std::unique_ptr<DeviceOp> MakeInstance(std::size_t id)
+    {
+        const auto& descs = GetInstanceDescriptors();
+
+        if(id >= descs.size())
+        {
+            throw std::runtime_error("wrong! instance id out of range");
+        }
+
+        return descs[id]->MakeInstance();
+    }
+
+    // nullptr if there is no such instance
+    static std::unique_ptr<DeviceOp> FindInstanceById(uint64_t instance_id)
+    {
+        static const auto index = [] {
+            std::unordered_map<uint64_t, const DeviceOperationInstanceDescriptor<DeviceOp>*> ids;
+
+            // an instance listed twice is the same kernel, keep the first
+            for(const auto* desc : GetInstanceDescriptors())
+            {
+                ids.emplace(desc->GetInstanceId(), desc);
+            }
+
+            return ids;
+        }();
+
+        const auto it = index.find(instance_id);
+
+        return it == index.end() ? nullptr : it->second->MakeInstance();
+    }
+
+    // every instance, constructed now
+    static auto GetInstances()
+    {
+        const auto& descs = GetInstanceDescriptors();
+
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+        op_ptrs.reserve(descs.size());
+
+        for(const auto* desc : descs)
+        {
+            op_ptrs.push_back(desc->MakeInstance());
+        }
+
+        return op_ptrs;
+    }
+};
+
+namespace detail {
+
+template <typename Factory, typename = void>
+struct has_instance_registry : std::false_type
+{
+};
+
+template <typename Factory>
+struct has_instance_registry<Factory, std::void_t<decltype(Factory::GetInstanceDescriptors())>>
+    : std::true_type
+{
+};
+
+template <typename BaseOp>
+using DeviceOperationInstanceMakers = std::unordered_map<uint64_t, std::unique_ptr<BaseOp> (*)()>;
+
+// while set, add_device_operation_instances() also records how to make each instance it adds,
+// by BaseOperator::GetInstanceId()
+template <typename BaseOp>
+inline thread_local DeviceOperationInstanceMakers<BaseOp>* device_operation_instance_makers =
+    nullptr;
+
+} // namespace detail
+
+// The instance of DeviceOperationInstanceFactory<DeviceOp> with the given
+// BaseOperator::GetInstanceId(), nullptr if there is none. A hash lookup for factories on
+// DeviceOperationInstanceRegistry. The others construct their instance list once, on the first
+// lookup, to record how to make each instance; later lookups construct just the one found.
+template <typename DeviceOp>
+std::unique_ptr<DeviceOp> FindInstanceById(uint64_t instance_id)
+{
+    using Factory = DeviceOperationInstanceFactory<DeviceOp>;
+
+    if constexpr(detail::has_instance_registry<Factory>::value)
+    {
+        return Factory::FindInstanceById(instance_id);
+    }
+    else
+    {
+        // the maker of each instance, nullptr for the few not added by
+        // add_device_operation_instances(), which are taken from a new instance list
+        static const auto index = [] {
+            detail::DeviceOperationInstanceMakers<DeviceOp> makers;
+
+            detail::device_operation_instance_makers<DeviceOp> = &makers;
+
+            std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+            try
+            {
+                op_ptrs = Factory::GetInstances();
+            }
+            catch(...)
+            {
+                detail::device_operation_instance_makers<DeviceOp> = nullptr;
+
+                throw;
+            }
+
+            detail::device_operation_instance_makers<DeviceOp> = nullptr;
+
+            std::unordered_map<uint64_t, std::pair<std::unique_ptr<DeviceOp> (*)(), std::size_t>>
+                ids;
+
+            for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+            {
+                const uint64_t id = op_ptrs[i]->GetInstanceId();
+                const auto it     = makers.find(id);
+
+                ids.emplace(id, std::make_pair(it == makers.end() ? nullptr : it->second, i));
+            }
+
+            return ids;
+        }();
+
+        const auto it = index.find(instance_id);
+
+        if(it == index.end())
+        {
+            return nullptr;
+        }
+
+        const auto [make_instance, i] = it->second;
+
+        if(make_instance != nullptr)
+        {
+            return make_instance();
+        }
+
+        auto op_ptrs = Factory::GetInstances();
+
+        return std::move(op_ptrs[i]);
+    }
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
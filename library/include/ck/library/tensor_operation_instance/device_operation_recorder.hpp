@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/workload_trace.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Records the calls of a device operation instance to a workload trace, for ckProfiler replay: it
+// forwards everything to the instance and writes a record on every Run() of an argument it made.
+// Specialized per device operation family.
+template <typename DeviceOp>
+struct DeviceOperationRecorder;
+
+namespace detail {
+
+// ckProfiler data type code of a problem whose tensors are all of DataType, -1 if there is none
+template <typename DataType>
+constexpr int64_t get_profiler_data_type()
+{
+    if constexpr(is_same_v<DataType, float>)
+        return 0;
+    else if constexpr(is_same_v<DataType, half_t>)
+        return 1;
+    else if constexpr(is_same_v<DataType, bhalf_t>)
+        return 2;
+    else if constexpr(is_same_v<DataType, int8_t>)
+        return 3;
+    else
+        return -1;
+}
+
+// parameters of an element-wise operation a record keeps, e.g. the alpha and beta of Bilinear;
+// none for an operation without any, e.g. PassThrough
+template <typename ElementwiseOperation>
+std::vector<double> get_elementwise_op_parameters(const ElementwiseOperation& op)
+{
+    if constexpr(is_same_v<ElementwiseOperation, element_wise::Scale>)
+        return {op.scale_};
+    else if constexpr(is_same_v<ElementwiseOperation, element_wise::Bilinear>)
+        return {op.alpha_, op.beta_};
+    else
+        return {};
+}
+
+} // namespace detail
+
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct DeviceOperationRecorder<DeviceGemm<ALayout,
+                                          BLayout,
+                                          CLayout,
+                                          ADataType,
+                                          BDataType,
+                                          CDataType,
+                                          AElementwiseOperation,
+                                          BElementwiseOperation,
+                                          CElementwiseOperation>>
+    : public DeviceGemm<ALayout,
+                        BLayout,
+                        CLayout,
+                        ADataType,
+                        BDataType,
+                        CDataType,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        CElementwiseOperation>
+{
+    using DeviceOp = DeviceGemm<ALayout,
+                                BLayout,
+                                CLayout,
+                                ADataType,
+                                BDataType,
+                                CDataType,
+                                AElementwiseOperation,
+                                BElementwiseOperation,
+                                CElementwiseOperation>;
+
+    using Row = tensor_layout::gemm::RowMajor;
+
+    // As the arguments of "ckProfiler gemm": one data type for A, B and C, the layouts of A and B
+    // with C row-major. -1 for a data type or layout it does not have.
+    static constexpr int64_t GetProfilerDataType()
+    {
+        if constexpr(is_same_v<ADataType, BDataType> && is_same_v<ADataType, CDataType>)
+            return detail::get_profiler_data_type<ADataType>();
+        else
+            return -1;
+    }
+
+    static constexpr int64_t GetProfilerLayout()
+    {
+        if constexpr(!is_same_v<CLayout, Row>)
+            return -1;
+        else
+            return (is_same_v<ALayout, Row> ? 0 : 2) + (is_same_v<BLayout, Row> ? 0 : 1);
+    }
+
+    struct Argument : public BaseArgument
+    {
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return argument_ptr_->SetInputPointer(i, p);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return argument_ptr_->SetOutputPointer(i, p);
+        }
+
+        std::unique_ptr<BaseArgument> argument_ptr_;
+        utils::WorkloadRecord record_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const BaseArgument* p_arg, const StreamConfig& stream_config = StreamConfig{})
+            override
+        {
+            const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+            const float ave_time = invoker_ptr_->Run(arg.argument_ptr_.get(), stream_config);
+
+            utils::WorkloadRecord record = arg.record_;
+
+            record.ave_time_ms_ = stream_config.time_kernel_ ? ave_time : 0;
+
+            writer_->Write(record);
+
+            return ave_time;
+        }
+
+        std::unique_ptr<BaseInvoker> invoker_ptr_;
+        utils::WorkloadTraceWriter* writer_;
+    };
+
+    DeviceOperationRecorder(std::unique_ptr<DeviceOp> op_ptr, utils::WorkloadTraceWriter& writer)
+        : op_ptr_{std::move(op_ptr)}, writer_{&writer}
+    {
+    }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
+                                                      const void* p_b,
+                                                      void* p_c,
+                                                      index_t M,
+                                                      index_t N,
+                                                      index_t K,
+                                                      index_t StrideA,
+                                                      index_t StrideB,
+                                                      index_t StrideC,
+                                                      AElementwiseOperation a_element_op,
+                                                      BElementwiseOperation b_element_op,
+                                                      CElementwiseOperation c_element_op) override
+    {
+        auto arg_ptr = std::make_unique<Argument>();
+
+        arg_ptr->argument_ptr_ = op_ptr_->MakeArgumentPointer(p_a,
+                                                              p_b,
+                                                              p_c,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              StrideA,
+                                                              StrideB,
+                                                              StrideC,
+                                                              a_element_op,
+                                                              b_element_op,
+                                                              c_element_op);
+
+        auto& record = arg_ptr->record_;
+
+        record.operation_   = "gemm";
+        record.instance_    = op_ptr_->GetTypeString();
+        record.instance_id_ = op_ptr_->GetInstanceId();
+        record.problem_     = {
+            GetProfilerDataType(), GetProfilerLayout(), M, N, K, StrideA, StrideB, StrideC};
+        record.parameters_  = GetParameters(a_element_op, b_element_op, c_element_op);
+
+        return arg_ptr;
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        auto invoker_ptr = std::make_unique<Invoker>();
+
+        invoker_ptr->invoker_ptr_ = op_ptr_->MakeInvokerPointer();
+        invoker_ptr->writer_      = writer_;
+
+        return invoker_ptr;
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return op_ptr_->IsSupportedArgument(GetArgument(p_arg));
+    }
+
+    bool SetElementwiseOps(BaseArgument* p_arg,
+                           AElementwiseOperation a_element_op,
+                           BElementwiseOperation b_element_op,
+                           CElementwiseOperation c_element_op) override
+    {
+        if(!op_ptr_->SetElementwiseOps(
+               GetArgument(p_arg), a_element_op, b_element_op, c_element_op))
+        {
+            return false;
+        }
+
+        dynamic_cast<Argument*>(p_arg)->record_.parameters_ =
+            GetParameters(a_element_op, b_element_op, c_element_op);
+
+        return true;
+    }
+
+    std::size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return op_ptr_->GetWorkSpaceSize(GetArgument(p_arg));
+    }
+
+    void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const override
+    {
+        p_arg->p_workspace_ = p_workspace;
+
+        op_ptr_->SetWorkSpacePointer(GetArgument(p_arg), p_workspace);
+    }
+
+    std::string GetTypeString() const override { return op_ptr_->GetTypeString(); }
+
+    uint64_t GetInstanceId() const override { return op_ptr_->GetInstanceId(); }
+
+    private:
+    // those of A, B and C, in this order
+    static std::vector<double> GetParameters(const AElementwiseOperation& a_element_op,
+                                             const BElementwiseOperation& b_element_op,
+                                             const CElementwiseOperation& c_element_op)
+    {
+        std::vector<double> parameters = detail::get_elementwise_op_parameters(a_element_op);
+
+        for(const double value : detail::get_elementwise_op_parameters(b_element_op))
+        {
+            parameters.push_back(value);
+        }
+
+        for(const double value : detail::get_elementwise_op_parameters(c_element_op))
+        {
+            parameters.push_back(value);
+        }
+
+        return parameters;
+    }
+
+    static BaseArgument* GetArgument(const BaseArgument* p_arg)
+    {
+        return dynamic_cast<const Argument*>(p_arg)->argument_ptr_.get();
+    }
+
+    std::unique_ptr<DeviceOp> op_ptr_;
+    utils::WorkloadTraceWriter* writer_;
+};
+
+// Wraps every instance in a DeviceOperationRecorder writing to the trace CK_WORKLOAD_TRACE names,
+// e.g. after DeviceOperationInstanceFactory<DeviceOp>::GetInstances(). Leaves the instances as
+// they are if it is not set.
+template <typename DeviceOp>
+void RecordDeviceOperationInstances(std::vector<std::unique_ptr<DeviceOp>>& op_ptrs)
+{
+    utils::WorkloadTraceWriter* writer = utils::GetWorkloadTraceWriter();
+
+    if(writer == nullptr)
+    {
+        return;
+    }
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        op_ptr = std::make_unique<DeviceOperationRecorder<DeviceOp>>(std::move(op_ptr), *writer);
+    }
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
@@ -11,6 +13,7 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -19,43 +22,43 @@ namespace instance {
 
 // conv2d forward
 void add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_instances(
-    std::vector<std::unique_ptr<
-        DeviceConvFwd<2, NHWC, KYXC, NHWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceConvFwd<2, NHWC, KYXC, NHWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>&
         instances);
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(
-    std::vector<std::unique_ptr<DeviceConvFwd<2,
-                                              NHWC,
-                                              KYXC,
-                                              NHWK,
-                                              BF16,
-                                              BF16,
-                                              BF16,
-                                              PassThrough,
-                                              PassThrough,
-                                              PassThrough>>>& instances);
+    DeviceOperationInstanceDescriptors<DeviceConvFwd<2,
+                                                     NHWC,
+                                                     KYXC,
+                                                     NHWK,
+                                                     BF16,
+                                                     BF16,
+                                                     BF16,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough>>& instances);
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(
-    std::vector<std::unique_ptr<
-        DeviceConvFwd<2, NHWC, KYXC, NHWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceConvFwd<2, NHWC, KYXC, NHWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>&
         instances);
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(
-    std::vector<std::unique_ptr<
-        DeviceConvFwd<2, NHWC, KYXC, NHWK, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceConvFwd<2, NHWC, KYXC, NHWK, F32, F32, F32, PassThrough, PassThrough, PassThrough>>&
         instances);
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(
-    std::vector<std::unique_ptr<DeviceConvFwd<2,
-                                              NHWC,
-                                              KYXC,
-                                              NHWK,
-                                              int8_t,
-                                              int8_t,
-                                              int8_t,
-                                              PassThrough,
-                                              PassThrough,
-                                              PassThrough>>>& instances);
+    DeviceOperationInstanceDescriptors<DeviceConvFwd<2,
+                                                     NHWC,
+                                                     KYXC,
+                                                     NHWK,
+                                                     int8_t,
+                                                     int8_t,
+                                                     int8_t,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough>>& instances);
 
 template <ck::index_t NumDimSpatial,
           typename InLayout,
@@ -75,6 +78,27 @@ struct DeviceOperationInstanceFactory<
                                                 ck::tensor_operation::element_wise::PassThrough,
                                                 ck::tensor_operation::element_wise::PassThrough,
                                                 ck::tensor_operation::element_wise::PassThrough>>
+    : DeviceOperationInstanceRegistry<
+          DeviceOperationInstanceFactory<DeviceConvFwd<NumDimSpatial,
+                                                       InLayout,
+                                                       WeiLayout,
+                                                       OutLayout,
+                                                       InDataType,
+                                                       WeiDataType,
+                                                       OutDataType,
+                                                       element_wise::PassThrough,
+                                                       element_wise::PassThrough,
+                                                       element_wise::PassThrough>>,
+          DeviceConvFwd<NumDimSpatial,
+                        InLayout,
+                        WeiLayout,
+                        OutLayout,
+                        InDataType,
+                        WeiDataType,
+                        OutDataType,
+                        element_wise::PassThrough,
+                        element_wise::PassThrough,
+                        element_wise::PassThrough>>
 {
     using DeviceOp = DeviceConvFwd<NumDimSpatial,
                                    InLayout,
@@ -87,38 +111,35 @@ struct DeviceOperationInstanceFactory<
                                    ck::tensor_operation::element_wise::PassThrough,
                                    ck::tensor_operation::element_wise::PassThrough>;
 
-    static auto GetInstances()
+    // the instances are constructed from these by DeviceOperationInstanceRegistry
+    static void AddInstances(DeviceOperationInstanceDescriptors<DeviceOp>& op_descs)
     {
-        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
-
         if constexpr(NumDimSpatial == 2 && is_same_v<InLayout, NHWC> &&
                      is_same_v<WeiLayout, KYXC> && is_same_v<OutLayout, NHWK>)
         {
             if constexpr(is_same_v<InDataType, float> && is_same_v<WeiDataType, float> &&
                          is_same_v<OutDataType, float>)
             {
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(op_ptrs);
+                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(op_descs);
             }
             else if constexpr(is_same_v<InDataType, half_t> && is_same_v<WeiDataType, half_t> &&
                               is_same_v<OutDataType, half_t>)
             {
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(op_ptrs);
-                add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_instances(op_ptrs);
+                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(op_descs);
+                add_device_conv2d_fwd_xdl_c_shuffle_nhwc_kyxc_nhwk_f16_instances(op_descs);
             }
             else if constexpr(is_same_v<InDataType, ck::bhalf_t> &&
                               is_same_v<WeiDataType, ck::bhalf_t> &&
                               is_same_v<OutDataType, ck::bhalf_t>)
             {
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(op_ptrs);
+                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(op_descs);
             }
             else if constexpr(is_same_v<InDataType, int8_t> && is_same_v<WeiDataType, int8_t> &&
                               is_same_v<OutDataType, int8_t>)
             {
-                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(op_ptrs);
+                add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(op_descs);
             }
         }
-
-        return op_ptrs;
     }
 };
 
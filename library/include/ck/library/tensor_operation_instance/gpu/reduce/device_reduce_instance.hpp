@@ -77,3 +77,87 @@
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance_threadwise_b16_f32_b16_min.hpp"
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance_threadwise_b16_f32_b16_max.hpp"
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance_threadwise_b16_f32_b16_amax.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// The reduction instances of the instance library for one problem type, on
+// DeviceOperationInstanceRegistry. DeviceReduce does not name its data types, so the instances
+// are listed by this factory rather than by a DeviceOperationInstanceFactory specialization. The
+// multiblock instances accumulate into the output with atomics, and are only listed with
+// UseMultiblockAtomicAdd.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          int Rank,
+          int NumReduceDim,
+          typename ReduceOperation,
+          typename InElementwiseOp,
+          typename AccElementwiseOp,
+          bool PropagateNan,
+          bool OutputIndex,
+          bool UseMultiblockAtomicAdd>
+struct DeviceReduceInstanceFactory
+    : DeviceOperationInstanceRegistry<
+          DeviceReduceInstanceFactory<InDataType,
+                                      AccDataType,
+                                      OutDataType,
+                                      Rank,
+                                      NumReduceDim,
+                                      ReduceOperation,
+                                      InElementwiseOp,
+                                      AccElementwiseOp,
+                                      PropagateNan,
+                                      OutputIndex,
+                                      UseMultiblockAtomicAdd>,
+          DeviceReduce<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>>
+{
+    using DeviceOp = DeviceReduce<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>;
+
+    // the instances are constructed from these by DeviceOperationInstanceRegistry
+    static void AddInstances(DeviceOperationInstanceDescriptors<DeviceOp>& op_descs)
+    {
+        add_device_reduce_instance_threadwise<InDataType,
+                                              AccDataType,
+                                              OutDataType,
+                                              Rank,
+                                              NumReduceDim,
+                                              ReduceOperation,
+                                              InElementwiseOp,
+                                              AccElementwiseOp,
+                                              PropagateNan,
+                                              OutputIndex>(op_descs);
+
+        add_device_reduce_instance_blockwise<InDataType,
+                                             AccDataType,
+                                             OutDataType,
+                                             Rank,
+                                             NumReduceDim,
+                                             ReduceOperation,
+                                             InElementwiseOp,
+                                             AccElementwiseOp,
+                                             PropagateNan,
+                                             OutputIndex>(op_descs);
+
+        if constexpr(UseMultiblockAtomicAdd)
+        {
+            add_device_reduce_instance_multiblock_atomic_add<InDataType,
+                                                             AccDataType,
+                                                             OutDataType,
+                                                             Rank,
+                                                             NumReduceDim,
+                                                             ReduceOperation,
+                                                             InElementwiseOp,
+                                                             AccElementwiseOp,
+                                                             PropagateNan,
+                                                             OutputIndex>(op_descs);
+        }
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -3,9 +3,15 @@
 
 #pragma once
 
+#include <memory>
+#include <tuple>
+#include <vector>
+
 #include "ck/utility/reduction_operator.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -45,6 +51,13 @@ using UnarySqrt   = ck::tensor_operation::element_wise::UnarySqrt;
 using UnaryDivide = ck::tensor_operation::element_wise::UnaryDivide;
 using UnaryAbs    = ck::tensor_operation::element_wise::UnaryAbs;
 
+// Add the descriptor of one reduction instance to a list of descriptors
+template <typename ReduceOpInstance, typename BaseOp>
+void add_device_reduce_instance(DeviceOperationInstanceDescriptors<BaseOp>& device_op_instances)
+{
+    add_device_operation_instance_descriptors<std::tuple<ReduceOpInstance>>(device_op_instances);
+}
+
 #define QUICK_REDUCE_TEST 1
 
 } // namespace instance
@@ -76,8 +76,8 @@ template <typename InDataType,
           bool PropagateNan,
           bool OutputIndex>
 void add_device_reduce_instance_multiblock_atomic_add(
-    std::vector<DeviceReducePtr<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>>&
-        device_op_instances)
+    DeviceOperationInstanceDescriptors<
+        DeviceReduce<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>>& device_op_instances)
 {
     static_for<0,
                std::tuple_size<reduce_configuration_1_instances_multiblock_atomic_add>::value,
@@ -112,7 +112,7 @@ void add_device_reduce_instance_multiblock_atomic_add(
                                                             cfg2::InSrcVectorSize_,
                                                             cfg2::OutDstVectorSize_>;
 
-            device_op_instances.push_back(std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+            add_device_reduce_instance<ReduceOpInstance>(device_op_instances);
         });
     });
 };
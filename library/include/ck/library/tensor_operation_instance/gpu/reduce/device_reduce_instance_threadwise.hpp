@@ -62,8 +62,8 @@ template <typename InDataType,
           bool PropagateNan,
           bool OutputIndex>
 void add_device_reduce_instance_threadwise(
-    std::vector<DeviceReducePtr<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>>&
-        device_op_instances)
+    DeviceOperationInstanceDescriptors<
+        DeviceReduce<Rank, NumReduceDim, InElementwiseOp, AccElementwiseOp>>& device_op_instances)
 {
     using cfg1 = ReductionConfiguration_1<256, 256, 1>;
 
@@ -90,7 +90,7 @@ void add_device_reduce_instance_threadwise(
                                                             cfg2::InSrcVectorSize_,
                                                             cfg2::OutDstVectorSize_>;
 
-            device_op_instances.push_back(std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+            add_device_reduce_instance<ReduceOpInstance>(device_op_instances);
         });
 };
 
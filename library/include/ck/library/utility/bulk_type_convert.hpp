@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "ck/utility/data_type.hpp"
+
+namespace ck {
+namespace utils {
+
+// Host vector extensions usable for bulk conversion, in increasing order of preference
+enum struct HostSimd
+{
+    None,
+    Avx2,   // AVX2 + F16C, 8 lanes
+    Avx512, // AVX-512F, 16 lanes
+};
+
+// Best extension supported by the running CPU. The environment variable CK_HOST_SIMD
+// ("none", "avx2" or "avx512") lowers it, e.g. to compare against the scalar path.
+HostSimd GetHostSimd();
+
+const char* GetHostSimdString(HostSimd simd);
+
+namespace detail {
+
+// Vectorized kernels for one contiguous chunk. Each rounds exactly like ck::type_convert;
+// float -> int8_t truncates like static_cast for values representable in int8_t and saturates
+// otherwise. 'simd' is clamped to what the CPU supports.
+void bulk_type_convert_chunk(const float* p_src, half_t* p_dst, std::size_t n, HostSimd simd);
+void bulk_type_convert_chunk(const half_t* p_src, float* p_dst, std::size_t n, HostSimd simd);
+void bulk_type_convert_chunk(const float* p_src, bhalf_t* p_dst, std::size_t n, HostSimd simd);
+void bulk_type_convert_chunk(const bhalf_t* p_src, float* p_dst, std::size_t n, HostSimd simd);
+void bulk_type_convert_chunk(const float* p_src, int8_t* p_dst, std::size_t n, HostSimd simd);
+void bulk_type_convert_chunk(const int8_t* p_src, float* p_dst, std::size_t n, HostSimd simd);
+
+template <typename Y, typename X, typename = void>
+struct has_bulk_type_convert_chunk : std::false_type
+{
+};
+
+template <typename Y, typename X>
+struct has_bulk_type_convert_chunk<
+    Y,
+    X,
+    std::void_t<decltype(bulk_type_convert_chunk(
+        std::declval<const X*>(), std::declval<Y*>(), std::size_t{}, HostSimd{}))>>
+    : std::true_type
+{
+};
+
+// Split [0, n) into chunks of at least 'min_chunk' elements and run f(begin, end) on each,
+// using up to std::thread::hardware_concurrency() threads
+void parallel_for_chunks(std::size_t n,
+                         std::size_t min_chunk,
+                         const std::function<void(std::size_t, std::size_t)>& f);
+
+} // namespace detail
+
+/**
+ * @brief      Convert n contiguous elements from X to Y.
+ *
+ *             Results are bit-identical to applying ck::type_convert<Y> to every element
+ *             (round to nearest even for fp32 -> bf16 / fp16). fp32 <-> fp16, bf16 and int8
+ *             use SIMD kernels selected at run time; other pairs use ck::type_convert itself.
+ *             Large ranges are split across threads.
+ */
+template <typename Y, typename X>
+void bulk_type_convert(const X* p_src, Y* p_dst, std::size_t n)
+{
+    constexpr std::size_t min_chunk = std::size_t{1} << 16;
+
+    if constexpr(std::is_same_v<X, Y>)
+    {
+        detail::parallel_for_chunks(n, min_chunk, [&](std::size_t begin, std::size_t end) {
+            std::copy(p_src + begin, p_src + end, p_dst + begin);
+        });
+    }
+    else if constexpr(detail::has_bulk_type_convert_chunk<Y, X>::value)
+    {
+        const HostSimd simd = GetHostSimd();
+
+        detail::parallel_for_chunks(n, min_chunk, [&](std::size_t begin, std::size_t end) {
+            detail::bulk_type_convert_chunk(p_src + begin, p_dst + begin, end - begin, simd);
+        });
+    }
+    else
+    {
+        detail::parallel_for_chunks(n, min_chunk, [&](std::size_t begin, std::size_t end) {
+            std::transform(p_src + begin, p_src + end, p_dst + begin, [](X x) {
+                return ck::type_convert<Y>(x);
+            });
+        });
+    }
+}
+
+} // namespace utils
+} // namespace ck
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -15,26 +16,69 @@
 
 #include "ck/ck.hpp"
 #include "ck/utility/data_type.hpp"
+#include "ck/utility/span.hpp"
 #include "ck/utility/type.hpp"
 #include "ck/host_utility/io.hpp"
+#include "ck/host_utility/trace.hpp"
 
+#include "ck/library/utility/bulk_type_convert.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 namespace ck {
 namespace utils {
 
+namespace detail {
+
+template <typename Range>
+struct is_contiguous_range : std::false_type
+{
+};
+
+template <typename T, typename Allocator>
+struct is_contiguous_range<std::vector<T, Allocator>> : std::true_type
+{
+};
+
+template <typename T, std::size_t N>
+struct is_contiguous_range<std::array<T, N>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_contiguous_range<span<T>> : std::true_type
+{
+};
+
+// half_t, bhalf_t, f8_t and bf8_t results are compared in fp32, converted block by block
+inline constexpr std::size_t check_err_block_size = 1024;
+
+template <typename Range>
+void copy_as_float(const Range& range, std::size_t first, std::size_t n, float* p_dst)
+{
+    if constexpr(is_contiguous_range<remove_cvref_t<Range>>::value)
+    {
+        bulk_type_convert(range.data() + first, p_dst, n);
+    }
+    else
+    {
+        std::transform(std::next(std::begin(range), first),
+                       std::next(std::begin(range), first + n),
+                       p_dst,
+                       [](auto value) { return type_convert<float>(value); });
+    }
+}
+
+// Shared by the half_t, bhalf_t, f8_t and bf8_t overloads of check_err below
 template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_floating_point_v<ranges::range_value_t<Range>> &&
-        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-5,
-          double atol            = 3e-6)
+bool check_err_as_float(const Range& out,
+                        const RefRange& ref,
+                        const std::string& msg,
+                        double rtol,
+                        double atol)
 {
+    CK_TRACE_ZONE(zone, "verification", "check_err");
+    zone.AddArg("size", ref.size());
+
     if(out.size() != ref.size())
     {
         std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
@@ -45,11 +89,19 @@ check_err(const Range& out,
     bool res{true};
     int err_count  = 0;
     double err     = 0;
-    double max_err = std::numeric_limits<double>::min();
+    double max_err = std::numeric_limits<float>::min();
+    float out_block[check_err_block_size];
+    float ref_block[check_err_block_size];
     for(std::size_t i = 0; i < ref.size(); ++i)
     {
-        const double o = *std::next(std::begin(out), i);
-        const double r = *std::next(std::begin(ref), i);
+        if(i % check_err_block_size == 0)
+        {
+            const std::size_t n = std::min(check_err_block_size, ref.size() - i);
+            copy_as_float(out, i, n, out_block);
+            copy_as_float(ref, i, n, ref_block);
+        }
+        const double o = out_block[i % check_err_block_size];
+        const double r = ref_block[i % check_err_block_size];
         err            = std::abs(o - r);
         if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
         {
@@ -70,17 +122,23 @@ check_err(const Range& out,
     return res;
 }
 
+} // namespace detail
+
 template <typename Range, typename RefRange>
 typename std::enable_if<
     std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
+        std::is_floating_point_v<ranges::range_value_t<Range>> &&
+        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
     bool>::type
 check_err(const Range& out,
           const RefRange& ref,
           const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double rtol            = 1e-5,
+          double atol            = 3e-6)
 {
+    CK_TRACE_ZONE(zone, "verification", "check_err");
+    zone.AddArg("size", ref.size());
+
     if(out.size() != ref.size())
     {
         std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
@@ -89,14 +147,13 @@ check_err(const Range& out,
     }
 
     bool res{true};
-    int err_count = 0;
-    double err    = 0;
-    // TODO: This is a hack. We should have proper specialization for bhalf_t data type.
-    double max_err = std::numeric_limits<float>::min();
+    int err_count  = 0;
+    double err     = 0;
+    double max_err = std::numeric_limits<double>::min();
     for(std::size_t i = 0; i < ref.size(); ++i)
     {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
+        const double o = *std::next(std::begin(out), i);
+        const double r = *std::next(std::begin(ref), i);
         err            = std::abs(o - r);
         if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
         {
@@ -117,6 +174,20 @@ check_err(const Range& out,
     return res;
 }
 
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-3,
+          double atol            = 1e-3)
+{
+    return detail::check_err_as_float(out, ref, msg, rtol, atol);
+}
+
 template <typename Range, typename RefRange>
 typename std::enable_if<
     std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
@@ -128,39 +199,24 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
+    return detail::check_err_as_float(out, ref, msg, rtol, atol);
+}
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<ranges::range_value_t<Range>>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+// The default tolerances allow one unit in the last place of E4M3 (f8_t) values; E5M2 (bf8_t)
+// results typically need rtol = 0.25
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        (std::is_same_v<ranges::range_value_t<Range>, f8_t> ||
+         std::is_same_v<ranges::range_value_t<Range>, bf8_t>),
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 0.125,
+          double atol            = 1e-3)
+{
+    return detail::check_err_as_float(out, ref, msg, rtol, atol);
 }
 
 template <typename Range, typename RefRange>
@@ -178,6 +234,9 @@ check_err(const Range& out,
           double                 = 0,
           double atol            = 0)
 {
+    CK_TRACE_ZONE(zone, "verification", "check_err");
+    zone.AddArg("size", ref.size());
+
     if(out.size() != ref.size())
     {
         std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
@@ -5,6 +5,9 @@
 
 #include <hip/hip_runtime.h>
 
+#include "ck/library/utility/device_memory_pool.hpp"
+#include "ck/library/utility/device_transfer.hpp"
+
 template <typename T>
 __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
 {
@@ -17,11 +20,26 @@ __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
 struct DeviceMem
 {
     DeviceMem() = delete;
-    DeviceMem(std::size_t mem_size);
+    // used on the null stream
+    DeviceMem(std::size_t mem_size,
+              ck::utils::DeviceMemoryAllocator& allocator =
+                  ck::utils::GetDefaultDeviceMemoryAllocator());
+    // Used on stream, which has to be the stream of the kernels accessing it, e.g. the stream_id_
+    // of their StreamConfig: the default allocator reuses the memory on that stream without
+    // synchronization once it is freed
+    DeviceMem(std::size_t mem_size,
+              hipStream_t stream,
+              ck::utils::DeviceMemoryAllocator& allocator =
+                  ck::utils::GetDefaultDeviceMemoryAllocator());
     void* GetDeviceBuffer() const;
     std::size_t GetBufferSize() const;
     void ToDevice(const void* p) const;
     void FromDevice(void* p) const;
+    // in chunks through pinned staging buffers, e.g. of GetDefaultTransferEngine()
+    void ToDevice(const void* p, ck::utils::TransferEngine& engine) const;
+    void FromDevice(void* p,
+                    ck::utils::TransferEngine& engine,
+                    const ck::utils::TransferEngine::ChunkCallback& f_chunk = nullptr) const;
     void SetZero() const;
     template <typename T>
     void SetValue(T x) const;
@@ -29,6 +47,7 @@ struct DeviceMem
 
     void* mpDeviceBuf;
     std::size_t mMemSize;
+    ck::utils::DeviceMemoryAllocator* mpAllocator;
 };
 
 template <typename T>
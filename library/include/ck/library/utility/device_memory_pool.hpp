@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+namespace ck {
+namespace utils {
+
+// Where DeviceMem gets its memory from. Allocate() throws on failure, a size of 0 gives nullptr.
+class DeviceMemoryAllocator
+{
+    public:
+    virtual ~DeviceMemoryAllocator() = default;
+
+    // the memory is first used on stream
+    virtual void* Allocate(std::size_t size, hipStream_t stream = nullptr) = 0;
+
+    virtual void Free(void* p) = 0;
+};
+
+// hipMalloc() and hipFree()
+class HipMemoryAllocator : public DeviceMemoryAllocator
+{
+    public:
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr) override;
+
+    void Free(void* p) override;
+};
+
+// Host memory, aligned as hipMalloc() aligns, e.g. to test a DeviceMemoryPool without a GPU
+class HostMemoryAllocator : public DeviceMemoryAllocator
+{
+    public:
+    static constexpr std::size_t alignment = 256;
+
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr) override;
+
+    void Free(void* p) override;
+};
+
+struct DeviceMemoryPoolStats
+{
+    // calls of Allocate() with a size other than 0, and those served from the cache
+    std::size_t num_allocations_ = 0;
+    std::size_t num_hits_        = 0;
+
+    std::size_t num_upstream_allocations_ = 0;
+    std::size_t num_upstream_frees_       = 0;
+
+    // of the blocks in use: as requested, and as allocated, rounded up to their size classes
+    std::size_t bytes_requested_ = 0;
+    std::size_t bytes_in_use_    = 0;
+
+    // of the free blocks kept for reuse
+    std::size_t bytes_cached_ = 0;
+
+    std::size_t peak_bytes_in_use_   = 0;
+    std::size_t peak_bytes_reserved_ = 0;
+
+    // allocated from upstream: in use or cached
+    std::size_t GetBytesReserved() const { return bytes_in_use_ + bytes_cached_; }
+
+    double GetHitRate() const
+    {
+        return num_allocations_ == 0 ? 0 : static_cast<double>(num_hits_) / num_allocations_;
+    }
+
+    // the share of the reserved bytes not requested: rounding to size classes and the cache
+    double GetFragmentation() const
+    {
+        const std::size_t bytes_reserved = GetBytesReserved();
+
+        if(bytes_reserved == 0)
+        {
+            return 0;
+        }
+
+        return 1 - static_cast<double>(bytes_requested_) / static_cast<double>(bytes_reserved);
+    }
+};
+
+// Caching allocator on top of another allocator. Sizes are rounded up to size classes; a freed
+// block is kept for the next allocation of its size class on the stream it was allocated for,
+// which stream order makes safe without synchronization, provided the block is only used on that
+// stream: work on other streams has to be finished by the time it is freed. Blocks are only
+// handed to another stream after Trim() gave them back upstream, as hipFree() synchronizes.
+//
+// When the upstream allocator fails, the cache is trimmed and the allocation retried. The pool
+// has to outlive the blocks it allocated. Thread safe.
+class DeviceMemoryPool : public DeviceMemoryAllocator
+{
+    public:
+    // unlimited_bytes_cached keeps every freed block until Trim()
+    static constexpr std::size_t default_max_bytes_cached = std::size_t{1} << 30;
+    static constexpr std::size_t unlimited_bytes_cached   = std::numeric_limits<std::size_t>::max();
+
+    explicit DeviceMemoryPool(std::unique_ptr<DeviceMemoryAllocator> upstream,
+                              std::size_t max_bytes_cached = default_max_bytes_cached);
+
+    DeviceMemoryPool(const DeviceMemoryPool&) = delete;
+    DeviceMemoryPool& operator=(const DeviceMemoryPool&) = delete;
+
+    // frees the cached blocks
+    ~DeviceMemoryPool() override;
+
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr) override;
+
+    // throws for a block not allocated by the pool
+    void Free(void* p) override;
+
+    // Frees cached blocks, the largest first, until at most max_bytes_cached are left
+    void Trim(std::size_t max_bytes_cached = 0);
+
+    DeviceMemoryPoolStats GetStats() const;
+
+    // multiples of a quarter of the power of 2 below size, of at most 2 MiB, from 512 bytes on:
+    // at most 25% and 2 MiB more than size
+    static std::size_t GetSizeClass(std::size_t size);
+
+    private:
+    struct Block
+    {
+        std::size_t size_class_;
+        std::size_t size_;
+        hipStream_t stream_;
+    };
+
+    // with mutex_ held
+    void TrimLocked(std::size_t max_bytes_cached);
+
+    // with mutex_ held
+    void FreeUpstream(void* p);
+
+    const std::unique_ptr<DeviceMemoryAllocator> upstream_;
+    const std::size_t max_bytes_cached_;
+
+    mutable std::mutex mutex_;
+
+    // blocks in use
+    std::unordered_map<void*, Block> blocks_;
+
+    // free blocks, by size class and stream
+    std::map<std::pair<std::size_t, hipStream_t>, std::vector<void*>> free_blocks_;
+
+    DeviceMemoryPoolStats stats_;
+};
+
+// The allocator DeviceMem uses by default: a DeviceMemoryPool on HipMemoryAllocator, unless
+// CK_DEVICE_MEMORY_POOL is 0, for hipMalloc() and hipFree() on every DeviceMem.
+// CK_DEVICE_MEMORY_POOL_MAX_CACHED_MB limits the MiB it caches, 1024 by default, or "unlimited".
+// Never destroyed.
+DeviceMemoryAllocator& GetDefaultDeviceMemoryAllocator();
+
+} // namespace utils
+} // namespace ck
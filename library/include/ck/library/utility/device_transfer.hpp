@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+namespace ck {
+namespace utils {
+
+// How a TransferEngine copies between its staging buffers and the device. Copies are asynchronous
+// and run in the order they were issued.
+class TransferBackend
+{
+    public:
+    static constexpr std::size_t num_fences = 2;
+
+    virtual ~TransferBackend() = default;
+
+    // host memory the device copies from and to fast, e.g. pinned
+    virtual void* AllocateStaging(std::size_t size) = 0;
+
+    virtual void FreeStaging(void* p) = 0;
+
+    virtual void CopyToDeviceAsync(void* p_dst, const void* p_src, std::size_t size) = 0;
+
+    virtual void CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size) = 0;
+
+    // Marks the copies issued so far with fence, which is less than num_fences
+    virtual void Signal(std::size_t fence) = 0;
+
+    // Blocks until the copies marked with fence are done; at once for a fence never signaled
+    virtual void Wait(std::size_t fence) = 0;
+};
+
+// hipMemcpyAsync() on a stream of its own, which is ordered with the null stream, to and from
+// memory of hipHostMalloc()
+class HipTransferBackend : public TransferBackend
+{
+    public:
+    HipTransferBackend();
+
+    HipTransferBackend(const HipTransferBackend&) = delete;
+    HipTransferBackend& operator=(const HipTransferBackend&) = delete;
+
+    ~HipTransferBackend() override;
+
+    void* AllocateStaging(std::size_t size) override;
+
+    void FreeStaging(void* p) override;
+
+    void CopyToDeviceAsync(void* p_dst, const void* p_src, std::size_t size) override;
+
+    void CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size) override;
+
+    void Signal(std::size_t fence) override;
+
+    void Wait(std::size_t fence) override;
+
+    private:
+    hipStream_t stream_ = nullptr;
+    std::array<hipEvent_t, num_fences> events_{};
+};
+
+// std::memcpy() between host buffers, e.g. to test a TransferEngine without a GPU. The copies are
+// deferred to the Wait() for them, as a device would run them later.
+class HostTransferBackend : public TransferBackend
+{
+    public:
+    void* AllocateStaging(std::size_t size) override;
+
+    void FreeStaging(void* p) override;
+
+    void CopyToDeviceAsync(void* p_dst, const void* p_src, std::size_t size) override;
+
+    void CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size) override;
+
+    void Signal(std::size_t fence) override;
+
+    void Wait(std::size_t fence) override;
+
+    private:
+    struct Copy
+    {
+        void* p_dst_;
+        const void* p_src_;
+        std::size_t size_;
+    };
+
+    // copies issued and not yet run, and the number of those issued before them
+    std::vector<Copy> pending_copies_;
+    std::size_t num_copies_run_ = 0;
+
+    // the number of copies issued when each fence was signaled
+    std::array<std::size_t, num_fences> fence_marks_{};
+};
+
+// Host <-> device copies in chunks, staged through two buffers of the backend, which are allocated
+// once and reused: while one chunk is copied between a staging buffer and the device, the host
+// copies the next or previous between the other and the user buffer.
+//
+// FromDevice() can call back for every chunk that arrived, while the next is in flight, e.g. to
+// verify a result chunk by chunk rather than after the whole copy:
+//
+//     engine.FromDevice(out.data(), out_dev.GetDeviceBuffer(), size, [&](auto offset, auto n) {
+//         pass = pass & check_chunk(offset, n);
+//     });
+//
+// Chunks other than the last are of the chunk size, so a chunk size that is a multiple of the
+// element size gives whole elements. The copies are synchronous to the caller. Thread safe, by
+// running one copy at a time; the callback must not use the engine.
+class TransferEngine
+{
+    public:
+    static constexpr std::size_t default_chunk_size = std::size_t{8} << 20;
+
+    // a part of the destination that is complete: offset and size in bytes
+    using ChunkCallback = std::function<void(std::size_t offset, std::size_t size)>;
+
+    explicit TransferEngine(std::unique_ptr<TransferBackend> backend,
+                            std::size_t chunk_size = default_chunk_size);
+
+    TransferEngine(const TransferEngine&) = delete;
+    TransferEngine& operator=(const TransferEngine&) = delete;
+
+    ~TransferEngine();
+
+    void ToDevice(void* p_dst, const void* p_src, std::size_t size);
+
+    void FromDevice(void* p_dst,
+                    const void* p_src,
+                    std::size_t size,
+                    const ChunkCallback& f_chunk = nullptr);
+
+    std::size_t GetChunkSize() const { return chunk_size_; }
+
+    private:
+    // with mutex_ held
+    void AllocateStaging();
+
+    // with mutex_ held: waits for all copies, e.g. before leaving on an exception
+    void Synchronize();
+
+    const std::unique_ptr<TransferBackend> backend_;
+    const std::size_t chunk_size_;
+
+    std::mutex mutex_;
+
+    std::array<void*, TransferBackend::num_fences> staging_buffers_{};
+};
+
+// A TransferEngine on HipTransferBackend, in chunks of CK_TRANSFER_CHUNK_MB if set to a number
+// other than 0, e.g. for DeviceMem::ToDevice() and FromDevice(). Never destroyed.
+TransferEngine& GetDefaultTransferEngine();
+
+} // namespace utils
+} // namespace ck
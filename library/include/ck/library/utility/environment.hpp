@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+
+namespace ck {
+namespace utils {
+
+// The environment variable name as an unsigned number: default_value if it is not set, and
+// nullopt, with a warning, if it is not a number. Never throws, e.g. to be read in static
+// initializers.
+inline std::optional<std::size_t> GetEnvUnsigned(const char* name, std::size_t default_value)
+{
+    const char* str = std::getenv(name);
+
+    if(str == nullptr)
+    {
+        return default_value;
+    }
+
+    char* end = nullptr;
+
+    errno = 0;
+
+    const unsigned long long value = std::strtoull(str, &end, 10);
+
+    // strtoull() takes a sign and leading spaces
+    if(!std::isdigit(static_cast<unsigned char>(*str)) || *end != '\0' || errno == ERANGE)
+    {
+        std::cerr << "warning: ignoring " << name << "=" << str << ", not a number" << std::endl;
+
+        return std::nullopt;
+    }
+
+    return static_cast<std::size_t>(value);
+}
+
+} // namespace utils
+} // namespace ck
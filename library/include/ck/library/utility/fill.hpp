@@ -9,12 +9,49 @@
 #include <random>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "ck/utility/data_type.hpp"
 
+#include "ck/library/utility/bulk_type_convert.hpp"
+
 namespace ck {
 namespace utils {
 
+namespace detail {
+
+// Fill [first, last) with type_convert<T>(gen()). Values are drawn in order, in blocks that are
+// converted with bulk_type_convert, so the result matches per-element conversion.
+template <typename T, typename ForwardIter, typename Generator>
+void generate_converted(ForwardIter first, ForwardIter last, Generator gen)
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        std::generate(first, last, gen);
+    }
+    else
+    {
+        constexpr std::size_t block_size = 4096;
+
+        std::vector<float> values(block_size);
+        std::vector<T> converted(block_size);
+
+        while(first != last)
+        {
+            std::size_t n = 0;
+            for(ForwardIter it = first; n < block_size && it != last; ++it, ++n)
+            {
+                values[n] = gen();
+            }
+
+            bulk_type_convert(values.data(), converted.data(), n);
+            first = std::copy_n(converted.begin(), n, first);
+        }
+    }
+}
+
+} // namespace detail
+
 template <typename T>
 struct FillUniformDistribution
 {
@@ -26,7 +63,7 @@ struct FillUniformDistribution
     {
         std::mt19937 gen(11939);
         std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        detail::generate_converted<T>(first, last, [&dis, &gen]() { return dis(gen); });
     }
 
     template <typename ForwardRange>
@@ -70,8 +107,8 @@ struct FillUniformDistributionIntegerValue
     {
         std::mt19937 gen(11939);
         std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+        detail::generate_converted<T>(
+            first, last, [&dis, &gen]() { return std::round(dis(gen)); });
     }
 
     template <typename ForwardRange>
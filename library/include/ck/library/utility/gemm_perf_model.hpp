@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_operation_tile.hpp"
+
+namespace ck {
+namespace utils {
+
+struct GemmPerfProblem
+{
+    std::size_t M_           = 0;
+    std::size_t N_           = 0;
+    std::size_t K_           = 0;
+    std::size_t batch_count_ = 1;
+
+    // element sizes in bytes
+    std::size_t a_element_bytes_ = 2;
+    std::size_t b_element_bytes_ = 2;
+    std::size_t c_element_bytes_ = 2;
+
+    // ck::tensor_layout::gemm names of the layouts of A, B and C; the estimate sees them only
+    // through the vector widths of the tile, but instances are compared for one layout each
+    std::string a_layout_ = "RowMajor";
+    std::string b_layout_ = "RowMajor";
+    std::string c_layout_ = "RowMajor";
+};
+
+struct GemmPerfDevice
+{
+    std::size_t num_cu_             = 120;
+    std::size_t max_threads_per_cu_ = 2048;
+    std::size_t lds_bytes_per_cu_   = 65536;
+};
+
+// terms of the cost model for one problem and instance
+struct GemmPerfFeatures
+{
+    // every dimension the instance does not pad is a multiple of the tile
+    bool supported_ = false;
+
+    std::size_t grid_size_     = 0;
+    std::size_t blocks_per_cu_ = 0;
+
+    // rounds of resident blocks, ceil(grid_size / (num_cu * blocks_per_cu))
+    std::size_t waves_ = 0;
+
+    // grid_size / (waves * num_cu * blocks_per_cu)
+    double wave_efficiency_ = 0;
+
+    // M * N * K over the padded M * N * K
+    double padding_efficiency_ = 0;
+
+    // flops of the busiest CU, padding included
+    double compute_ = 0;
+
+    // main loop iterations of the busiest CU over the prefetch stages of the pipeline, each
+    // paying a latency not hidden by the others
+    double latency_ = 0;
+
+    // bytes moved from and to global memory: C, and the A and B panels, loaded once by the
+    // blocks resident at the same time, which share them through L2; the C tiles those blocks
+    // cover follow the M01 swizzle of the tile. Accesses narrower than a dword are counted as a
+    // full dword.
+    double memory_ = 0;
+};
+
+struct GemmPerfRecord
+{
+    GemmPerfProblem problem_;
+    GemmPerfDevice device_;
+    tensor_operation::device::DeviceOperationTile tile_;
+
+    // BaseOperator::GetInstanceId(), for reference only
+    std::uint64_t instance_id_ = 0;
+
+    double ave_time_ms_ = 0;
+};
+
+/**
+ * @brief      Analytical estimate of the run time of a GEMM instance, from its tile alone.
+ *
+ *             time = compute_ms * compute + latency_ms * latency + memory_ms * memory + launch_ms
+ *
+ *             with the terms of GemmPerfFeatures. Wave quantization and tile padding enter
+ *             through the busiest CU, occupancy through the number of resident blocks (threads
+ *             and LDS; registers are not known), the pipeline through the latency and the block
+ *             to C tile map through the memory traffic. The default coefficients are the order of
+ *             magnitude of a 120 CU fp16 device; Calibrate() fits them to measured times, so that
+ *             instances can be ranked for a problem without running any of them.
+ */
+struct GemmPerfModel
+{
+    // ms per flop of one CU, per main loop iteration, per byte of global memory traffic and per
+    // launch
+    double compute_ms_ = 6.5e-10;
+    double latency_ms_ = 5e-4;
+    double memory_ms_  = 8e-10;
+    double launch_ms_  = 5e-3;
+
+    static GemmPerfFeatures GetFeatures(const GemmPerfProblem& problem,
+                                        const tensor_operation::device::DeviceOperationTile& tile,
+                                        const GemmPerfDevice& device);
+
+    // infinity if not supported
+    double Estimate(const GemmPerfFeatures& features) const;
+
+    double Estimate(const GemmPerfProblem& problem,
+                    const tensor_operation::device::DeviceOperationTile& tile,
+                    const GemmPerfDevice& device) const
+    {
+        return Estimate(GetFeatures(problem, tile, device));
+    }
+
+    // indices of the supported tiles, fastest estimate first
+    std::vector<std::size_t>
+    Rank(const GemmPerfProblem& problem,
+         const std::vector<tensor_operation::device::DeviceOperationTile>& tiles,
+         const GemmPerfDevice& device) const;
+
+    // non-negative least squares fit of the coefficients to the relative error of the records
+    static GemmPerfModel Calibrate(const std::vector<GemmPerfRecord>& records);
+};
+
+// how well a model picks the fastest instance, over the problems of a set of records; records of
+// the same problem, layouts and device are one problem
+struct GemmPerfRankingStats
+{
+    std::size_t num_problems_ = 0;
+
+    // problems where the pick is the measured fastest instance
+    std::size_t num_best_picked_ = 0;
+
+    // measured time of the pick over the fastest measured time
+    double mean_slowdown_ = 0;
+    double max_slowdown_  = 0;
+};
+
+GemmPerfRankingStats EvaluateRanking(const GemmPerfModel& model,
+                                     const std::vector<GemmPerfRecord>& records);
+
+// records as CSV, one line per record after a header line
+void SaveGemmPerfRecords(const std::string& path, const std::vector<GemmPerfRecord>& records);
+
+// creates the file, with its header line, if it does not exist
+void AppendGemmPerfRecord(const std::string& path, const GemmPerfRecord& record);
+
+std::vector<GemmPerfRecord> LoadGemmPerfRecords(const std::string& path);
+
+} // namespace utils
+} // namespace ck
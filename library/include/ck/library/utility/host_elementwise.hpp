@@ -0,0 +1,548 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ck/utility/span.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/bulk_type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_vector_math.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+// elements converted to fp32 and evaluated at a time, small enough for the stack
+inline constexpr std::size_t host_elementwise_block = 256;
+
+template <typename Op, typename Y, typename... X>
+void host_elementwise_scalar(const Op& op, span<Y> y, span<const X>... xs)
+{
+    for(std::size_t i = 0; i < y.size(); ++i)
+    {
+        op(y[i], xs[i]...);
+    }
+}
+
+// Run f(begin, n) over [0, size) in blocks of host_elementwise_block elements
+template <typename F>
+void for_each_elementwise_block(std::size_t size, F f)
+{
+    for(std::size_t begin = 0; begin < size; begin += host_elementwise_block)
+    {
+        f(begin, std::min(host_elementwise_block, size - begin));
+    }
+}
+
+template <typename X>
+void load_float_block(const X* p_x, float* p_f, std::size_t n, HostSimd simd)
+{
+    if constexpr(std::is_same_v<X, float>)
+    {
+        std::copy(p_x, p_x + n, p_f);
+    }
+    else if constexpr(has_bulk_type_convert_chunk<float, X>::value)
+    {
+        bulk_type_convert_chunk(p_x, p_f, n, simd);
+    }
+    else
+    {
+        std::transform(p_x, p_x + n, p_f, [](X x) { return ck::type_convert<float>(x); });
+    }
+}
+
+template <typename Y>
+void store_float_block(const float* p_f, Y* p_y, std::size_t n, HostSimd simd)
+{
+    if constexpr(std::is_same_v<Y, float>)
+    {
+        std::copy(p_f, p_f + n, p_y);
+    }
+    else if constexpr(has_bulk_type_convert_chunk<Y, float>::value)
+    {
+        bulk_type_convert_chunk(p_f, p_y, n, simd);
+    }
+    else
+    {
+        std::transform(p_f, p_f + n, p_y, [](float f) { return ck::type_convert<Y>(f); });
+    }
+}
+
+// p_x[i] = GetFastGeLU(p_x[i]), with the same operation order as the scalar functors
+inline void fast_gelu_block(float* p_x, std::size_t n, HostSimd simd)
+{
+    float emu[host_elementwise_block];
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const float x = p_x[i];
+
+        emu[i] = -(2.f * x * (0.035677f * x * x + 0.797885f));
+    }
+
+    host_exp(emu, emu, n, simd);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        p_x[i] = p_x[i] * (0.5f + 0.5f * (2.f / (1.f + emu[i]) - 1.f));
+    }
+}
+
+template <typename TensorType>
+using host_tensor_value_t =
+    std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const TensorType&>().data())>>;
+
+// n elements of p_x, 'stride' apart: in place if contiguous, else gathered into 'buf'
+template <typename X>
+span<const X> gather_run(const X* p_x, std::size_t stride, std::size_t n, std::vector<X>& buf)
+{
+    if(stride == 1)
+    {
+        return span<const X>{p_x, n};
+    }
+
+    buf.resize(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        buf[i] = p_x[i * stride];
+    }
+
+    return span<const X>{buf.data(), n};
+}
+
+// Row m of a 2D tensor or view, see gather_run
+template <typename TensorType>
+auto get_row_2d(const TensorType& x_m_n,
+                std::size_t m,
+                std::size_t N,
+                std::vector<host_tensor_value_t<TensorType>>& buf)
+{
+    const auto& strides = x_m_n.mDesc.GetStrides();
+
+    return gather_run(x_m_n.data() + m * strides[0], strides[1], N, buf);
+}
+
+// Loop nest over operands that share the same lengths, outermost dimension first
+struct HostElementwiseLoop
+{
+    std::vector<std::size_t> lengths;
+    std::vector<std::vector<std::size_t>> strides; // [operand][dimension]
+};
+
+// Drop unit dimensions, order the others by decreasing stride of operand 0 (the first output,
+// so writes are as sequential as possible) and merge neighbours that are contiguous in every
+// operand. The result has at least one dimension.
+inline HostElementwiseLoop make_host_elementwise_loop(
+    const std::vector<std::size_t>& lengths, const std::vector<std::vector<std::size_t>>& strides)
+{
+    const std::size_t num_operand = strides.size();
+
+    std::vector<std::size_t> dims;
+    for(std::size_t d = 0; d < lengths.size(); ++d)
+    {
+        if(lengths[d] == 0)
+        {
+            return {{0}, std::vector<std::vector<std::size_t>>(num_operand, {0})};
+        }
+
+        if(lengths[d] != 1)
+        {
+            dims.push_back(d);
+        }
+    }
+
+    if(num_operand > 0)
+    {
+        // ties keep the logical order
+        std::sort(dims.begin(), dims.end(), [&](auto a, auto b) {
+            return strides[0][a] != strides[0][b] ? strides[0][a] > strides[0][b] : a < b;
+        });
+    }
+
+    HostElementwiseLoop loop{{}, std::vector<std::vector<std::size_t>>(num_operand)};
+
+    for(const auto d : dims)
+    {
+        // the innermost dimension so far can absorb d if d walks exactly one step of it
+        bool contiguous = !loop.lengths.empty();
+
+        for(std::size_t k = 0; contiguous && k < num_operand; ++k)
+        {
+            contiguous = loop.strides[k].back() == strides[k][d] * lengths[d];
+        }
+
+        if(contiguous)
+        {
+            loop.lengths.back() *= lengths[d];
+        }
+        else
+        {
+            loop.lengths.push_back(lengths[d]);
+        }
+
+        for(std::size_t k = 0; k < num_operand; ++k)
+        {
+            if(contiguous)
+                loop.strides[k].back() = strides[k][d];
+            else
+                loop.strides[k].push_back(strides[k][d]);
+        }
+    }
+
+    if(loop.lengths.empty())
+    {
+        loop.lengths.push_back(1);
+
+        for(auto& s : loop.strides)
+        {
+            s.push_back(0);
+        }
+    }
+
+    return loop;
+}
+
+template <typename T>
+inline constexpr bool is_fast_gelu_param_type_v =
+    tensor_operation::element_wise::FastGelu::is_valid_param_type_v<T>;
+
+} // namespace detail
+
+//
+// @brief      Host evaluation of an element-wise operator over whole contiguous ranges,
+//             y[i] = op(xs[i]...).
+//
+// @paragraph
+//             The primary template calls the functor element by element. Specializations exist
+//             for operators dominated by exp / erf: they convert a block of inputs to fp32, run
+//             the same arithmetic as the functor with host_exp / host_erf in place of the
+//             <cmath> call and convert the results back. Results then differ from the functor
+//             only by the error of the vector math, a few fp32 ulp, so they round to the same
+//             fp16 / bf16 / int8 value except next to a rounding boundary.
+//
+template <typename Op>
+struct HostElementwise
+{
+    template <typename Y, typename... X>
+    static void Apply(const Op& op, span<Y> y, span<const X>... xs)
+    {
+        detail::host_elementwise_scalar(op, y, xs...);
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::FastGelu>
+{
+    template <typename Y, typename X>
+    static void
+    Apply(const tensor_operation::element_wise::FastGelu& op, span<Y> y, span<const X> x)
+    {
+        if constexpr(detail::is_fast_gelu_param_type_v<Y> && detail::is_fast_gelu_param_type_v<X>)
+        {
+            const HostSimd simd = GetHostSimd();
+
+            detail::for_each_elementwise_block(y.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+
+                detail::load_float_block(x.data() + begin, buf, n, simd);
+                detail::fast_gelu_block(buf, n, simd);
+                detail::store_float_block(buf, y.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, y, x);
+        }
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::AddFastGelu>
+{
+    template <typename E, typename C, typename D>
+    static void Apply(const tensor_operation::element_wise::AddFastGelu& op,
+                      span<E> e,
+                      span<const C> c,
+                      span<const D> d)
+    {
+        if constexpr(detail::is_fast_gelu_param_type_v<E> && detail::is_fast_gelu_param_type_v<C> &&
+                     detail::is_fast_gelu_param_type_v<D>)
+        {
+            const HostSimd simd = GetHostSimd();
+
+            detail::for_each_elementwise_block(e.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+                float buf_d[detail::host_elementwise_block];
+
+                detail::load_float_block(c.data() + begin, buf, n, simd);
+                detail::load_float_block(d.data() + begin, buf_d, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = buf[i] + buf_d[i];
+                }
+
+                detail::fast_gelu_block(buf, n, simd);
+                detail::store_float_block(buf, e.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, e, c, d);
+        }
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::AddAddFastGelu>
+{
+    template <typename E, typename C, typename D0, typename D1>
+    static void Apply(const tensor_operation::element_wise::AddAddFastGelu& op,
+                      span<E> e,
+                      span<const C> c,
+                      span<const D0> d0,
+                      span<const D1> d1)
+    {
+        if constexpr(detail::is_fast_gelu_param_type_v<E> && detail::is_fast_gelu_param_type_v<C> &&
+                     detail::is_fast_gelu_param_type_v<D0> && detail::is_fast_gelu_param_type_v<D1>)
+        {
+            const HostSimd simd = GetHostSimd();
+
+            detail::for_each_elementwise_block(e.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+                float buf_d[detail::host_elementwise_block];
+
+                detail::load_float_block(c.data() + begin, buf, n, simd);
+                detail::load_float_block(d0.data() + begin, buf_d, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = buf[i] + buf_d[i];
+                }
+
+                detail::load_float_block(d1.data() + begin, buf_d, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = buf[i] + buf_d[i];
+                }
+
+                detail::fast_gelu_block(buf, n, simd);
+                detail::store_float_block(buf, e.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, e, c, d0, d1);
+        }
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::Gelu>
+{
+    template <typename Y, typename X>
+    static void Apply(const tensor_operation::element_wise::Gelu& op, span<Y> y, span<const X> x)
+    {
+        // the fp16 functor rounds every intermediate to fp16, here they stay in fp32
+        if constexpr(std::is_same_v<Y, X> &&
+                     (std::is_same_v<X, float> || std::is_same_v<X, half_t>))
+        {
+            const HostSimd simd = GetHostSimd();
+
+            detail::for_each_elementwise_block(y.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+                float erf[detail::host_elementwise_block];
+
+                detail::load_float_block(x.data() + begin, buf, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    erf[i] = 0.70710678118f * buf[i];
+                }
+
+                host_erf(erf, erf, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = 0.5f * buf[i] * (1.f + erf[i]);
+                }
+
+                detail::store_float_block(buf, y.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, y, x);
+        }
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::Sigmoid>
+{
+    template <typename Y, typename X>
+    static void Apply(const tensor_operation::element_wise::Sigmoid& op, span<Y> y, span<const X> x)
+    {
+        if constexpr(std::is_same_v<Y, X> &&
+                     (std::is_same_v<X, float> || std::is_same_v<X, half_t>))
+        {
+            const HostSimd simd = GetHostSimd();
+
+            detail::for_each_elementwise_block(y.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+
+                detail::load_float_block(x.data() + begin, buf, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = -buf[i];
+                }
+
+                host_exp(buf, buf, n, simd);
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    buf[i] = 1.f / (1.f + buf[i]);
+                }
+
+                detail::store_float_block(buf, y.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, y, x);
+        }
+    }
+};
+
+template <>
+struct HostElementwise<tensor_operation::element_wise::Normalize>
+{
+    template <typename T1, typename T2, typename T3>
+    static void Apply(const tensor_operation::element_wise::Normalize& op,
+                      span<T1> y,
+                      span<const T1> x,
+                      span<const T2> mean,
+                      span<const T2> mean_square,
+                      span<const T3> gamma,
+                      span<const T3> beta)
+    {
+        // no transcendental here, converting fp16 in bulk and a loop the compiler can vectorize
+        // is the whole gain
+        if constexpr((std::is_same_v<T1, float> || std::is_same_v<T1, half_t>) &&
+                     std::is_same_v<T2, float> && std::is_same_v<T3, T1>)
+        {
+            const HostSimd simd  = GetHostSimd();
+            const float epsilon = type_convert<float>(op.epsilon_);
+
+            detail::for_each_elementwise_block(y.size(), [&](std::size_t begin, std::size_t n) {
+                float buf[detail::host_elementwise_block];
+                float buf_gamma[detail::host_elementwise_block];
+                float buf_beta[detail::host_elementwise_block];
+
+                detail::load_float_block(x.data() + begin, buf, n, simd);
+                detail::load_float_block(gamma.data() + begin, buf_gamma, n, simd);
+                detail::load_float_block(beta.data() + begin, buf_beta, n, simd);
+
+                const float* p_mean        = mean.data() + begin;
+                const float* p_mean_square = mean_square.data() + begin;
+
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    const float variance = p_mean_square[i] - (p_mean[i] * p_mean[i]);
+
+                    buf[i] = ((buf[i] - p_mean[i]) / std::sqrt(variance + epsilon)) * buf_gamma[i] +
+                             buf_beta[i];
+                }
+
+                detail::store_float_block(buf, y.data() + begin, n, simd);
+            });
+        }
+        else
+        {
+            detail::host_elementwise_scalar(op, y, x, mean, mean_square, gamma, beta);
+        }
+    }
+};
+
+// y[i] = op(xs[i]...) for contiguous ranges of equal size, see HostElementwise
+template <typename Op, typename Y, typename... X>
+void host_elementwise_apply(const Op& op, span<Y> y, span<const X>... xs)
+{
+    if(((xs.size() != y.size()) || ...))
+    {
+        throw std::runtime_error("wrong! host_elementwise_apply: inconsistent sizes");
+    }
+
+    HostElementwise<Op>::Apply(op, y, xs...);
+}
+
+/**
+ * @brief      y(m, n) = op(xs(m, n)...) for 2D host tensors or views, e.g. a GEMM epilogue.
+ *
+ *             Rows are distributed over threads and each row goes through
+ *             host_elementwise_apply. Rows with unit column stride are used in place; others,
+ *             including inputs broadcast along N (column stride 0), are gathered into a row
+ *             buffer first, and the output row is scattered back.
+ */
+template <typename Op, typename YTensor, typename... XTensors>
+void host_elementwise_apply_2d(const Op& op, YTensor&& y_m_n, const XTensors&... xs_m_n)
+{
+    using Y = std::remove_pointer_t<decltype(y_m_n.data())>;
+
+    const auto& y_lengths = y_m_n.mDesc.GetLengths();
+    const auto& y_strides = y_m_n.mDesc.GetStrides();
+
+    if(y_lengths.size() != 2 || ((xs_m_n.mDesc.GetLengths().size() != 2) || ...) ||
+       ((xs_m_n.mDesc.GetLengths()[0] != y_lengths[0]) || ...) ||
+       ((xs_m_n.mDesc.GetLengths()[1] != y_lengths[1]) || ...))
+    {
+        throw std::runtime_error("wrong! host_elementwise_apply_2d: inconsistent lengths");
+    }
+
+    const std::size_t M = y_lengths[0];
+    const std::size_t N = y_lengths[1];
+
+    Y* const p_y = y_m_n.data();
+
+    auto f_row = [&](auto m) {
+        std::tuple<std::vector<detail::host_tensor_value_t<XTensors>>...> bufs;
+
+        Y* const p_y_row = p_y + m * y_strides[0];
+
+        std::vector<Y> y_buf(y_strides[1] == 1 ? 0 : N);
+
+        const span<Y> y_row{y_strides[1] == 1 ? p_y_row : y_buf.data(), N};
+
+        std::apply(
+            [&](auto&... buf) {
+                host_elementwise_apply(op, y_row, detail::get_row_2d(xs_m_n, m, N, buf)...);
+            },
+            bufs);
+
+        if(y_strides[1] != 1)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                p_y_row[n * y_strides[1]] = y_buf[n];
+            }
+        }
+    };
+
+    make_ParallelTensorFunctor(f_row, M)(std::thread::hardware_concurrency());
+}
+
+} // namespace utils
+} // namespace ck
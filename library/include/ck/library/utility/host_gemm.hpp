@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "host_tensor.hpp"
 
 template <typename AType,
@@ -45,3 +49,99 @@ void host_gemm_mk_kn_mn(const Tensor<AType>& a_m_k,
                                c_m_n.mDesc.GetLengths()[0],
                                c_m_n.mDesc.GetLengths()[1])(std::thread::hardware_concurrency());
 }
+
+// Tile sizes of the blocked host GEMM engine. A C tile of accumulators stays in L1 while a
+// KPerBlock x NPerTile panel of B is reused by all MPerTile rows of A.
+inline constexpr std::size_t HostGemmMPerTile  = 16;
+inline constexpr std::size_t HostGemmNPerTile  = 128;
+inline constexpr std::size_t HostGemmKPerBlock = 256;
+
+// Call kernel(m_begin, m_end, n_begin, n_end) for every tile of an M x N output, in parallel
+template <typename TileKernel>
+void host_gemm_for_each_tile(std::size_t M, std::size_t N, TileKernel kernel)
+{
+    const std::size_t num_m_tiles = (M + HostGemmMPerTile - 1) / HostGemmMPerTile;
+    const std::size_t num_n_tiles = (N + HostGemmNPerTile - 1) / HostGemmNPerTile;
+
+    auto f_tile = [&](auto im, auto in) {
+        const std::size_t m_begin = im * HostGemmMPerTile;
+        const std::size_t n_begin = in * HostGemmNPerTile;
+
+        kernel(m_begin,
+               std::min(m_begin + HostGemmMPerTile, M),
+               n_begin,
+               std::min(n_begin + HostGemmNPerTile, N));
+    };
+
+    make_ParallelTensorFunctor(f_tile, num_m_tiles, num_n_tiles)(
+        std::thread::hardware_concurrency());
+}
+
+// Pack a 2D tensor into a dense row-major plane of AccDataType, converting through float
+// like the reference ops do
+template <typename AccDataType, typename T>
+std::vector<AccDataType> host_gemm_pack(const TensorView<const T>& view)
+{
+    std::vector<AccDataType> packed(view.GetElementSize());
+
+    if constexpr(std::is_same_v<AccDataType, float>)
+    {
+        if(view.IsPacked())
+            ck::utils::bulk_type_convert(view.data(), packed.data(), packed.size());
+        else
+            std::transform(view.begin(), view.end(), packed.begin(), [](T x) {
+                return ck::type_convert<float>(x);
+            });
+    }
+    else
+    {
+        std::transform(view.begin(), view.end(), packed.begin(), [](T x) {
+            return static_cast<AccDataType>(ck::type_convert<float>(x));
+        });
+    }
+
+    return packed;
+}
+
+// C = A * B over dense row-major planes (A is M x K, B is K x N, C is M x N). Every element of C
+// is accumulated over k in increasing order, as in the naive reference loop.
+template <typename AccDataType>
+void host_gemm_blocked(const AccDataType* p_a,
+                       const AccDataType* p_b,
+                       AccDataType* p_c,
+                       std::size_t M,
+                       std::size_t N,
+                       std::size_t K)
+{
+    host_gemm_for_each_tile(M, N, [&](auto m_begin, auto m_end, auto n_begin, auto n_end) {
+        AccDataType acc[HostGemmMPerTile][HostGemmNPerTile] = {};
+
+        for(std::size_t k_begin = 0; k_begin < K; k_begin += HostGemmKPerBlock)
+        {
+            const std::size_t k_end = std::min(k_begin + HostGemmKPerBlock, K);
+
+            for(std::size_t m = m_begin; m < m_end; ++m)
+            {
+                AccDataType* acc_m = acc[m - m_begin];
+
+                for(std::size_t k = k_begin; k < k_end; ++k)
+                {
+                    const AccDataType a  = p_a[m * K + k];
+                    const AccDataType* b = p_b + k * N;
+
+                    for(std::size_t n = n_begin; n < n_end; ++n)
+                    {
+                        acc_m[n - n_begin] += a * b[n];
+                    }
+                }
+            }
+        }
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            const AccDataType* acc_m = acc[m - m_begin];
+
+            std::copy(acc_m, acc_m + (n_end - n_begin), p_c + m * N + n_begin);
+        }
+    });
+}
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "ck/library/utility/bulk_type_convert.hpp"
+#include "ck/library/utility/host_gemm.hpp"
+
+namespace ck {
+namespace utils {
+
+// int8 x int8 -> int32 dot product kernels, in increasing order of preference
+enum struct HostInt8Dot
+{
+    Scalar,
+    Avx2,       // vpmaddwd on sign-extended 16-bit lanes
+    AvxVnni,    // AVX-VNNI vpdpbusd, 256 bit
+    Avx512Bw,   // vpmaddwd on sign-extended 16-bit lanes, 512 bit
+    Avx512Vnni, // AVX512-VNNI vpdpbusd, 512 bit
+};
+
+// Best kernel supported by the running CPU within the limit set by GetHostSimd(), so
+// CK_HOST_SIMD=none also selects the scalar int8 kernel
+HostInt8Dot GetHostInt8Dot();
+
+const char* GetHostInt8DotString(HostInt8Dot dot);
+
+// Packed rows are padded with zeros to a multiple of this many int8 values
+inline constexpr std::size_t HostGemmInt8KPack = 64;
+
+namespace detail {
+
+// C[m * ldc + n] = sum_k A[m * lda + k] * B[n * ldb + k] for an M x N block, exact modulo 2^32.
+// K must be a multiple of HostGemmInt8KPack and p_b_sum[n] must hold sum_k B[n * ldb + k] (the
+// VNNI kernels multiply unsigned by signed bytes and correct for the offset A + 128). 'dot' is
+// lowered to what the CPU supports.
+void gemm_s8s8s32_nt(const int8_t* p_a,
+                     std::size_t lda,
+                     const int8_t* p_b,
+                     std::size_t ldb,
+                     const int32_t* p_b_sum,
+                     int32_t* p_c,
+                     std::size_t ldc,
+                     std::size_t M,
+                     std::size_t N,
+                     std::size_t K,
+                     HostInt8Dot dot);
+
+} // namespace detail
+
+inline std::size_t host_gemm_int8_padded_k(std::size_t K)
+{
+    return (K + HostGemmInt8KPack - 1) / HostGemmInt8KPack * HostGemmInt8KPack;
+}
+
+// B operand of host_gemm_s8s8s32: N rows of K values each, padded to ldb, plus row sums
+struct HostGemmInt8PackedB
+{
+    std::size_t N;
+    std::size_t K;
+    std::size_t ldb;
+    std::vector<int8_t> data;
+    std::vector<int32_t> sums;
+};
+
+// Pack B from get_b(n, k), which returns the int8 value of row n, column k
+template <typename GetB>
+HostGemmInt8PackedB host_gemm_int8_pack_b(std::size_t N, std::size_t K, GetB get_b)
+{
+    HostGemmInt8PackedB b{N, K, host_gemm_int8_padded_k(K), {}, {}};
+
+    b.data.assign(N * b.ldb, int8_t{0});
+    b.sums.assign(N, 0);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        int8_t* p_row = b.data.data() + n * b.ldb;
+        int32_t sum   = 0;
+
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            p_row[k] = get_b(n, k);
+            sum += p_row[k];
+        }
+
+        b.sums[n] = sum;
+    }
+
+    return b;
+}
+
+/**
+ * @brief      int8 x int8 -> int32 host GEMM with a fused epilogue.
+ *
+ *             C = A * B^T, where row m of A (K values) is produced on demand by
+ *             load_a_row(m, p_row), so implicit operands such as im2col views of a convolution
+ *             input never need to be materialized. The output is computed in tiles of
+ *             HostGemmMPerTile x HostGemmNPerTile in parallel; each finished tile row is handed
+ *             to epilogue(m, n_begin, n_end, p_c), with p_c[n - n_begin] = C[m, n], while it is
+ *             still in cache. Accumulation is exact modulo 2^32, like int32 accumulation on the
+ *             device.
+ */
+template <typename LoadARow, typename Epilogue>
+void host_gemm_s8s8s32(std::size_t M,
+                       const HostGemmInt8PackedB& b,
+                       LoadARow load_a_row,
+                       Epilogue epilogue,
+                       HostInt8Dot dot = GetHostInt8Dot())
+{
+    const std::size_t N   = b.N;
+    const std::size_t ldk = b.ldb;
+
+    host_gemm_for_each_tile(M, N, [&](auto m_begin, auto m_end, auto n_begin, auto n_end) {
+        std::vector<int8_t> a((m_end - m_begin) * ldk, int8_t{0});
+        int32_t c[HostGemmMPerTile][HostGemmNPerTile];
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            load_a_row(m, a.data() + (m - m_begin) * ldk);
+        }
+
+        detail::gemm_s8s8s32_nt(a.data(),
+                                ldk,
+                                b.data.data() + n_begin * ldk,
+                                ldk,
+                                b.sums.data() + n_begin,
+                                &c[0][0],
+                                HostGemmNPerTile,
+                                m_end - m_begin,
+                                n_end - n_begin,
+                                ldk,
+                                dot);
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            epilogue(m, n_begin, n_end, static_cast<const int32_t*>(c[m - m_begin]));
+        }
+    });
+}
+
+/**
+ * @brief      int8 x int8 -> int32 host GEMM on operands loaded block by block.
+ *
+ *             C = A * B^T like the overload above, but B is never packed as a whole: each tile
+ *             walks K in blocks of HostGemmKPerBlock, and load_a(m, k_begin, k_end, p_row) and
+ *             load_b(n, k_begin, k_end, p_row) fill the rows of the A and B blocks, e.g. by
+ *             unpacking a compressed operand. At most one block of each operand per thread is
+ *             held as int8, at the cost of loading B once per tile row.
+ */
+template <typename LoadA, typename LoadB, typename Epilogue>
+void host_gemm_s8s8s32(std::size_t M,
+                       std::size_t N,
+                       std::size_t K,
+                       LoadA load_a,
+                       LoadB load_b,
+                       Epilogue epilogue,
+                       HostInt8Dot dot = GetHostInt8Dot())
+{
+    static_assert(HostGemmKPerBlock % HostGemmInt8KPack == 0,
+                  "wrong! K block is not a multiple of the int8 K pack");
+
+    host_gemm_for_each_tile(M, N, [&](auto m_begin, auto m_end, auto n_begin, auto n_end) {
+        std::vector<int8_t> a(HostGemmMPerTile * HostGemmKPerBlock);
+        std::vector<int8_t> b(HostGemmNPerTile * HostGemmKPerBlock);
+        int32_t b_sums[HostGemmNPerTile];
+        int32_t c[HostGemmMPerTile][HostGemmNPerTile];
+
+        // unsigned, to accumulate over K blocks modulo 2^32
+        uint32_t acc[HostGemmMPerTile][HostGemmNPerTile] = {};
+
+        for(std::size_t k_begin = 0; k_begin < K; k_begin += HostGemmKPerBlock)
+        {
+            const std::size_t k_end = std::min(k_begin + HostGemmKPerBlock, K);
+            const std::size_t ldk   = host_gemm_int8_padded_k(k_end - k_begin);
+
+            for(std::size_t m = m_begin; m < m_end; ++m)
+            {
+                int8_t* p_row = a.data() + (m - m_begin) * ldk;
+
+                load_a(m, k_begin, k_end, p_row);
+                std::fill(p_row + (k_end - k_begin), p_row + ldk, int8_t{0});
+            }
+
+            for(std::size_t n = n_begin; n < n_end; ++n)
+            {
+                int8_t* p_row = b.data() + (n - n_begin) * ldk;
+
+                load_b(n, k_begin, k_end, p_row);
+                std::fill(p_row + (k_end - k_begin), p_row + ldk, int8_t{0});
+
+                b_sums[n - n_begin] = std::accumulate(p_row, p_row + ldk, int32_t{0});
+            }
+
+            detail::gemm_s8s8s32_nt(a.data(),
+                                    ldk,
+                                    b.data(),
+                                    ldk,
+                                    b_sums,
+                                    &c[0][0],
+                                    HostGemmNPerTile,
+                                    m_end - m_begin,
+                                    n_end - n_begin,
+                                    ldk,
+                                    dot);
+
+            for(std::size_t m = 0; m < m_end - m_begin; ++m)
+            {
+                for(std::size_t n = 0; n < n_end - n_begin; ++n)
+                {
+                    acc[m][n] += static_cast<uint32_t>(c[m][n]);
+                }
+            }
+        }
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            for(std::size_t n = 0; n < n_end - n_begin; ++n)
+            {
+                c[m - m_begin][n] = static_cast<int32_t>(acc[m - m_begin][n]);
+            }
+
+            epilogue(m, n_begin, n_end, static_cast<const int32_t*>(c[m - m_begin]));
+        }
+    });
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/library/utility/bulk_type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+// dst(idx) = src(idx) for elements of 'elem_size' bytes, strides are in elements
+void host_permute_bytes(const void* p_src,
+                        const std::vector<std::size_t>& src_strides,
+                        void* p_dst,
+                        const std::vector<std::size_t>& dst_strides,
+                        const std::vector<std::size_t>& lengths,
+                        std::size_t elem_size,
+                        HostSimd simd);
+
+} // namespace detail
+
+//
+// @brief      Copy src into dst, dst(idx) = src(idx), for tensors or views with the same lengths
+//             and arbitrary strides, e.g. an NCHW tensor into an NHWC tensor viewed as NCHW.
+//
+// @paragraph
+//             Dimensions are collapsed as in ReferenceElementwise. When the innermost runs are
+//             contiguous in both views rows are copied with memcpy, otherwise the plane spanned by
+//             the fastest dimension of dst and the fastest dimension of src is transposed in
+//             cache-sized tiles, 8x8 / 16x16 register transposes when both are unit-stride. Tiles
+//             of the remaining (batch) dimensions are distributed over threads.
+//
+template <typename SrcTensor, typename DstTensor>
+void host_permute(const SrcTensor& src, DstTensor&& dst, HostSimd simd = GetHostSimd())
+{
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(dst.data())>>;
+
+    using SrcT = std::remove_cv_t<std::remove_pointer_t<decltype(src.data())>>;
+
+    static_assert(std::is_same_v<SrcT, T>, "wrong! host_permute copies without type conversion");
+    static_assert(std::is_trivially_copyable_v<T>, "wrong! host_permute copies raw bytes");
+
+    const auto& lengths = dst.mDesc.GetLengths();
+
+    if(src.mDesc.GetLengths() != lengths)
+    {
+        throw std::runtime_error("wrong! host_permute: src and dst lengths differ");
+    }
+
+    const auto& src_strides = src.mDesc.GetStrides();
+    const auto& dst_strides = dst.mDesc.GetStrides();
+
+    detail::host_permute_bytes(src.data(),
+                               std::vector<std::size_t>(src_strides.begin(), src_strides.end()),
+                               dst.data(),
+                               std::vector<std::size_t>(dst_strides.begin(), dst_strides.end()),
+                               std::vector<std::size_t>(lengths.begin(), lengths.end()),
+                               sizeof(T),
+                               simd);
+}
+
+} // namespace utils
+} // namespace ck
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <thread>
 #include <utility>
@@ -13,8 +15,10 @@
 
 #include "ck/utility/data_type.hpp"
 #include "ck/utility/span.hpp"
+#include "ck/host_utility/trace.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/bulk_type_convert.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 template <typename Range>
@@ -130,7 +134,7 @@ struct HostTensorDescriptor
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
-    std::size_t GetOffsetFromMultiIndex(std::vector<std::size_t> iss) const
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
     {
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
@@ -158,6 +162,117 @@ HostTensorDescriptor transpose_host_tensor_descriptor_given_new2old(const HostTe
     return HostTensorDescriptor(new_lengths, new_strides);
 }
 
+/**
+ * @brief      HostTensorDescriptor with the rank fixed at compile time.
+ *
+ *             Lengths and strides live in std::array, so computing an offset is NDim
+ *             multiply-adds that the compiler fully unrolls, with no heap access. Converts
+ *             implicitly to and from HostTensorDescriptor; the latter throws on rank mismatch.
+ */
+template <std::size_t NDim>
+struct StaticHostTensorDescriptor
+{
+    using Array = std::array<std::size_t, NDim>;
+
+    StaticHostTensorDescriptor() = default;
+
+    template <typename X, typename = std::enable_if_t<std::is_convertible_v<X, std::size_t>>>
+    StaticHostTensorDescriptor(const std::initializer_list<X>& lens)
+        : StaticHostTensorDescriptor(HostTensorDescriptor(lens))
+    {
+    }
+
+    template <typename X,
+              typename Y,
+              typename = std::enable_if_t<std::is_convertible_v<X, std::size_t> &&
+                                          std::is_convertible_v<Y, std::size_t>>>
+    StaticHostTensorDescriptor(const std::initializer_list<X>& lens,
+                               const std::initializer_list<Y>& strides)
+        : StaticHostTensorDescriptor(HostTensorDescriptor(lens, strides))
+    {
+    }
+
+    StaticHostTensorDescriptor(const Array& lens, const Array& strides)
+        : mLens(lens), mStrides(strides)
+    {
+    }
+
+    StaticHostTensorDescriptor(const HostTensorDescriptor& desc)
+    {
+        if(desc.GetNumOfDimension() != NDim || desc.GetStrides().size() != NDim)
+        {
+            throw std::runtime_error("StaticHostTensorDescriptor: rank mismatch");
+        }
+
+        std::copy(desc.GetLengths().begin(), desc.GetLengths().end(), mLens.begin());
+        std::copy(desc.GetStrides().begin(), desc.GetStrides().end(), mStrides.begin());
+    }
+
+    operator HostTensorDescriptor() const { return HostTensorDescriptor(mLens, mStrides); }
+
+    static constexpr std::size_t GetNumOfDimension() { return NDim; }
+
+    std::size_t GetElementSize() const
+    {
+        return std::accumulate(
+            mLens.begin(), mLens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    }
+
+    std::size_t GetElementSpaceSize() const
+    {
+        std::size_t space = 1;
+        for(std::size_t i = 0; i < NDim; ++i)
+        {
+            if(mLens[i] == 0)
+                continue;
+
+            space += (mLens[i] - 1) * mStrides[i];
+        }
+        return space;
+    }
+
+    const Array& GetLengths() const { return mLens; }
+    const Array& GetStrides() const { return mStrides; }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        static_assert(sizeof...(Is) == NDim, "wrong! number of indices does not match rank");
+
+        return GetOffsetFromMultiIndex(Array{static_cast<std::size_t>(is)...});
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const Array& iss) const
+    {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < NDim; ++i)
+        {
+            offset += iss[i] * mStrides[i];
+        }
+        return offset;
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
+    {
+        assert(iss.size() == NDim);
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < NDim; ++i)
+        {
+            offset += iss[i] * mStrides[i];
+        }
+        return offset;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const StaticHostTensorDescriptor& desc)
+    {
+        return os << HostTensorDescriptor(desc);
+    }
+
+    private:
+    Array mLens{};
+    Array mStrides{};
+};
+
 struct joinable_thread : std::thread
 {
     template <typename... Xs>
@@ -270,8 +385,7 @@ struct Tensor
     {
         Tensor<OutT> ret(mDesc);
 
-        ck::ranges::transform(
-            mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
+        ck::utils::bulk_type_convert(mData.data(), ret.mData.data(), mData.size());
 
         return ret;
     }
@@ -353,6 +467,10 @@ struct Tensor
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
+        CK_TRACE_ZONE(zone, "tensor", "GenerateTensorValue");
+        zone.AddArg("size", mData.size());
+        zone.AddArg("num_thread", num_thread);
+
         switch(mDesc.GetNumOfDimension())
         {
         case 1: {
@@ -423,12 +541,12 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    T& operator()(std::vector<std::size_t> idx)
+    T& operator()(const std::vector<std::size_t>& idx)
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
 
-    const T& operator()(std::vector<std::size_t> idx) const
+    const T& operator()(const std::vector<std::size_t>& idx) const
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
@@ -470,3 +588,527 @@ struct Tensor
     Descriptor mDesc;
     Data mData;
 };
+
+/**
+ * @brief      Non-owning, strided view over host memory.
+ *
+ *             A view pairs a HostTensorDescriptor with an external pointer, so it can alias the
+ *             storage of a Tensor, a pinned/mapped buffer, or any other host allocation. Slicing,
+ *             permuting, broadcasting (stride 0) and reshaping only produce new descriptors and
+ *             never copy elements. Iteration (begin()/end()) walks the elements in logical
+ *             row-major order of the view, which makes a view a valid range for check_err().
+ */
+template <typename T>
+struct TensorView
+{
+    using Descriptor   = HostTensorDescriptor;
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+
+    TensorView(const Descriptor& desc, T* p_data) : mDesc(desc), mpData(p_data) {}
+
+    TensorView(Tensor<value_type>& tensor) : mDesc(tensor.mDesc), mpData(tensor.data()) {}
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    TensorView(const Tensor<value_type>& tensor) : mDesc(tensor.mDesc), mpData(tensor.data())
+    {
+    }
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    TensorView(const TensorView<value_type>& view) : mDesc(view.mDesc), mpData(view.data())
+    {
+    }
+
+    TensorView()                  = delete;
+    TensorView(const TensorView&) = default;
+    TensorView(TensorView&&)      = default;
+
+    TensorView& operator=(const TensorView&) = default;
+    TensorView& operator=(TensorView&&) = default;
+
+    ~TensorView() = default;
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    // true if the view covers a dense row-major block of memory
+    bool IsPacked() const
+    {
+        std::size_t expected = 1;
+        for(std::size_t i = GetNumOfDimension(); i-- > 0;)
+        {
+            if(GetLengths()[i] != 1 && GetStrides()[i] != expected)
+                return false;
+
+            expected *= GetLengths()[i];
+        }
+        return true;
+    }
+
+    // restrict dimension 'dim' to [begin, end) with the given step
+    TensorView
+    Slice(std::size_t dim, std::size_t begin, std::size_t end, std::size_t step = 1) const
+    {
+        if(dim >= GetNumOfDimension() || begin > end || end > GetLengths()[dim] || step == 0)
+        {
+            throw std::runtime_error("TensorView::Slice: invalid slice");
+        }
+
+        auto lengths = GetLengths();
+        auto strides = GetStrides();
+
+        lengths[dim] = (end - begin + step - 1) / step;
+        strides[dim] *= step;
+
+        return TensorView{Descriptor(lengths, strides), mpData + begin * GetStrides()[dim]};
+    }
+
+    // fix dimension 'dim' at index 'idx' and drop it, reducing the rank by one
+    TensorView Select(std::size_t dim, std::size_t idx) const
+    {
+        if(dim >= GetNumOfDimension() || idx >= GetLengths()[dim])
+        {
+            throw std::runtime_error("TensorView::Select: invalid index");
+        }
+
+        auto lengths = GetLengths();
+        auto strides = GetStrides();
+
+        lengths.erase(lengths.begin() + dim);
+        strides.erase(strides.begin() + dim);
+
+        return TensorView{Descriptor(lengths, strides), mpData + idx * GetStrides()[dim]};
+    }
+
+    template <typename New2Old>
+    TensorView Permute(const New2Old& new2old) const
+    {
+        if(std::size(new2old) != GetNumOfDimension())
+        {
+            throw std::runtime_error("TensorView::Permute: rank mismatch");
+        }
+
+        return TensorView{transpose_host_tensor_descriptor_given_new2old(mDesc, new2old), mpData};
+    }
+
+    TensorView Permute(std::initializer_list<std::size_t> new2old) const
+    {
+        return Permute(std::vector<std::size_t>(new2old));
+    }
+
+    // NumPy-style broadcast: dimensions are right-aligned, size-1 (or missing leading)
+    // dimensions are expanded with stride 0
+    template <typename Lengths>
+    TensorView Broadcast(const Lengths& new_lengths) const
+    {
+        const std::vector<std::size_t> lengths(std::begin(new_lengths), std::end(new_lengths));
+        const std::size_t rank = GetNumOfDimension();
+
+        if(lengths.size() < rank)
+        {
+            throw std::runtime_error("TensorView::Broadcast: cannot reduce rank");
+        }
+
+        std::vector<std::size_t> strides(lengths.size(), 0);
+        const std::size_t offset = lengths.size() - rank;
+
+        for(std::size_t i = 0; i < rank; ++i)
+        {
+            const std::size_t len = GetLengths()[i];
+
+            if(len == lengths[offset + i])
+                strides[offset + i] = GetStrides()[i];
+            else if(len != 1)
+                throw std::runtime_error("TensorView::Broadcast: incompatible lengths");
+        }
+
+        return TensorView{Descriptor(lengths, strides), mpData};
+    }
+
+    TensorView Broadcast(std::initializer_list<std::size_t> new_lengths) const
+    {
+        return Broadcast(std::vector<std::size_t>(new_lengths));
+    }
+
+    // Reinterpret the view with new lengths without moving data. Every group of old
+    // dimensions merged or split must be contiguous with respect to each other, otherwise
+    // a copy would be required and this throws.
+    template <typename Lengths>
+    TensorView Reshape(const Lengths& new_lengths) const
+    {
+        const std::vector<std::size_t> lengths(std::begin(new_lengths), std::end(new_lengths));
+
+        const std::size_t new_size = std::accumulate(
+            lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+        if(new_size != GetElementSize())
+        {
+            throw std::runtime_error("TensorView::Reshape: element count mismatch");
+        }
+
+        // drop size-1 dimensions, they never constrain the layout
+        std::vector<std::size_t> old_lens;
+        std::vector<std::size_t> old_strides;
+        for(std::size_t i = 0; i < GetNumOfDimension(); ++i)
+        {
+            if(GetLengths()[i] != 1)
+            {
+                old_lens.push_back(GetLengths()[i]);
+                old_strides.push_back(GetStrides()[i]);
+            }
+        }
+
+        std::vector<std::size_t> strides(lengths.size(), 0);
+
+        // walk the old and new shapes from the innermost dimension, matching up chunks with
+        // the same number of elements
+        std::size_t io = old_lens.size();
+        std::size_t in = lengths.size();
+
+        while(in > 0)
+        {
+            if(lengths[in - 1] == 1)
+            {
+                strides[in - 1] = 1;
+                --in;
+                continue;
+            }
+
+            if(io == 0)
+            {
+                throw std::runtime_error("TensorView::Reshape: incompatible lengths");
+            }
+
+            // old chunk [io_begin, io) must be contiguous
+            std::size_t old_chunk = old_lens[io - 1];
+            std::size_t new_chunk = lengths[in - 1];
+            std::size_t io_begin  = io - 1;
+            std::size_t in_begin  = in - 1;
+
+            while(old_chunk != new_chunk)
+            {
+                if(old_chunk < new_chunk)
+                {
+                    if(io_begin == 0 ||
+                       old_strides[io_begin - 1] != old_strides[io_begin] * old_lens[io_begin])
+                    {
+                        throw std::runtime_error(
+                            "TensorView::Reshape: view is not contiguous, copy required");
+                    }
+                    --io_begin;
+                    old_chunk *= old_lens[io_begin];
+                }
+                else
+                {
+                    if(in_begin == 0)
+                    {
+                        throw std::runtime_error("TensorView::Reshape: incompatible lengths");
+                    }
+                    --in_begin;
+                    new_chunk *= lengths[in_begin];
+                }
+            }
+
+            std::size_t stride = old_strides[io - 1];
+            for(std::size_t i = in; i-- > in_begin;)
+            {
+                strides[i] = stride;
+                stride *= lengths[i];
+            }
+
+            io = io_begin;
+            in = in_begin;
+        }
+
+        return TensorView{Descriptor(lengths, strides), mpData};
+    }
+
+    TensorView Reshape(std::initializer_list<std::size_t> new_lengths) const
+    {
+        return Reshape(std::vector<std::size_t>(new_lengths));
+    }
+
+    template <typename F>
+    void ForEach_impl(F&& f, std::vector<size_t>& idx, size_t rank) const
+    {
+        if(rank == mDesc.GetNumOfDimension())
+        {
+            f(*this, idx);
+            return;
+        }
+        // else
+        for(size_t i = 0; i < mDesc.GetLengths()[rank]; i++)
+        {
+            idx[rank] = i;
+            ForEach_impl(std::forward<F>(f), idx, rank + 1);
+        }
+    }
+
+    template <typename F>
+    void ForEach(F&& f) const
+    {
+        std::vector<size_t> idx(mDesc.GetNumOfDimension(), 0);
+        ForEach_impl(std::forward<F>(f), idx, size_t(0));
+    }
+
+    template <typename... Is>
+    T& operator()(Is... is) const
+    {
+        return mpData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(const std::vector<std::size_t>& idx) const
+    {
+        return mpData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    // offset of the i-th element in logical row-major order
+    std::size_t GetOffsetFromLinearIndex(std::size_t i) const
+    {
+        std::size_t offset = 0;
+        for(std::size_t idim = GetNumOfDimension(); idim-- > 0;)
+        {
+            const std::size_t len = GetLengths()[idim];
+
+            offset += (i % len) * GetStrides()[idim];
+            i /= len;
+        }
+        return offset;
+    }
+
+    class iterator
+    {
+        public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_cv_t<T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        iterator() = default;
+        iterator(std::shared_ptr<const TensorView> view, difference_type i)
+            : view_(std::move(view)), i_(i)
+        {
+        }
+
+        reference operator*() const { return view_->mpData[view_->GetOffsetFromLinearIndex(i_)]; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        iterator& operator++() { return ++i_, *this; }
+        iterator& operator--() { return --i_, *this; }
+        iterator operator++(int) { return iterator{view_, i_++}; }
+        iterator operator--(int) { return iterator{view_, i_--}; }
+        iterator& operator+=(difference_type n) { return i_ += n, *this; }
+        iterator& operator-=(difference_type n) { return i_ -= n, *this; }
+
+        friend iterator operator+(iterator it, difference_type n) { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const iterator& a, const iterator& b)
+        {
+            return a.i_ - b.i_;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) { return a.i_ == b.i_; }
+        friend bool operator!=(const iterator& a, const iterator& b) { return a.i_ != b.i_; }
+        friend bool operator<(const iterator& a, const iterator& b) { return a.i_ < b.i_; }
+        friend bool operator>(const iterator& a, const iterator& b) { return a.i_ > b.i_; }
+        friend bool operator<=(const iterator& a, const iterator& b) { return a.i_ <= b.i_; }
+        friend bool operator>=(const iterator& a, const iterator& b) { return a.i_ >= b.i_; }
+
+        private:
+        // a copy of the view, which may be a temporary, shared by the iterators made from it
+        std::shared_ptr<const TensorView> view_;
+        difference_type i_ = 0;
+    };
+
+    using const_iterator = iterator;
+
+    iterator begin() const { return iterator{std::make_shared<const TensorView>(*this), 0}; }
+
+    iterator end() const
+    {
+        return iterator{std::make_shared<const TensorView>(*this),
+                        static_cast<std::ptrdiff_t>(size())};
+    }
+
+    T* data() const { return mpData; }
+
+    std::size_t size() const { return GetElementSize(); }
+
+    Descriptor mDesc;
+    T* mpData;
+};
+
+template <typename T>
+TensorView<T> make_tensor_view(const HostTensorDescriptor& desc, T* p_data)
+{
+    return TensorView<T>{desc, p_data};
+}
+
+template <typename T>
+TensorView<T> make_tensor_view(Tensor<T>& tensor)
+{
+    return TensorView<T>{tensor};
+}
+
+template <typename T>
+TensorView<const T> make_tensor_view(const Tensor<T>& tensor)
+{
+    return TensorView<const T>{tensor};
+}
+
+/**
+ * @brief      Non-owning view with the rank fixed at compile time.
+ *
+ *             Built from a Tensor or TensorView once, e.g. at the top of a reference op's Run(),
+ *             so the inner loops index through StaticHostTensorDescriptor.
+ */
+template <typename T, std::size_t NDim>
+struct StaticTensorView
+{
+    using Descriptor   = StaticHostTensorDescriptor<NDim>;
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+
+    StaticTensorView(const Descriptor& desc, T* p_data) : mDesc(desc), mpData(p_data) {}
+
+    StaticTensorView(const TensorView<T>& view) : mDesc(view.mDesc), mpData(view.data()) {}
+
+    StaticTensorView(Tensor<value_type>& tensor) : mDesc(tensor.mDesc), mpData(tensor.data()) {}
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    StaticTensorView(const Tensor<value_type>& tensor)
+        : mDesc(tensor.mDesc), mpData(tensor.data())
+    {
+    }
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    StaticTensorView(const StaticTensorView<value_type, NDim>& view)
+        : mDesc(view.mDesc), mpData(view.data())
+    {
+    }
+
+    operator TensorView<T>() const { return TensorView<T>{mDesc, mpData}; }
+
+    const auto& GetLengths() const { return mDesc.GetLengths(); }
+
+    const auto& GetStrides() const { return mDesc.GetStrides(); }
+
+    static constexpr std::size_t GetNumOfDimension() { return NDim; }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    template <typename... Is>
+    T& operator()(Is... is) const
+    {
+        return mpData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(const std::array<std::size_t, NDim>& idx) const
+    {
+        return mpData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    T* data() const { return mpData; }
+
+    Descriptor mDesc;
+    T* mpData;
+};
+
+/**
+ * @brief      Owning tensor with the rank fixed at compile time.
+ *
+ *             Same storage as Tensor<T>. Converts to TensorView / StaticTensorView without a
+ *             copy, so it can be passed to any reference op. Conversion to and from Tensor<T>
+ *             copies the data and is explicit (constructor / ToTensor()).
+ */
+template <typename T, std::size_t NDim>
+struct StaticTensor
+{
+    using Descriptor = StaticHostTensorDescriptor<NDim>;
+    using Data       = std::vector<T>;
+
+    template <typename X>
+    StaticTensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.GetElementSpaceSize())
+    {
+    }
+
+    template <typename X, typename Y>
+    StaticTensor(std::initializer_list<X> lens, std::initializer_list<Y> strides)
+        : mDesc(lens, strides), mData(mDesc.GetElementSpaceSize())
+    {
+    }
+
+    StaticTensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
+
+    explicit StaticTensor(const Tensor<T>& tensor) : mDesc(tensor.mDesc), mData(tensor.mData) {}
+
+    // copy into a dynamic-rank tensor
+    Tensor<T> ToTensor() const
+    {
+        Tensor<T> tensor(HostTensorDescriptor{mDesc});
+        tensor.mData = mData;
+        return tensor;
+    }
+
+    operator TensorView<T>() { return TensorView<T>{mDesc, mData.data()}; }
+
+    operator TensorView<const T>() const { return TensorView<const T>{mDesc, mData.data()}; }
+
+    operator StaticTensorView<T, NDim>() { return {mDesc, mData.data()}; }
+
+    operator StaticTensorView<const T, NDim>() const { return {mDesc, mData.data()}; }
+
+    const auto& GetLengths() const { return mDesc.GetLengths(); }
+
+    const auto& GetStrides() const { return mDesc.GetStrides(); }
+
+    static constexpr std::size_t GetNumOfDimension() { return NDim; }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return sizeof(T) * GetElementSpaceSize(); }
+
+    void SetZero() { ck::ranges::fill<T>(mData, 0); }
+
+    template <typename... Is>
+    T& operator()(Is... is)
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    typename Data::iterator begin() { return mData.begin(); }
+
+    typename Data::iterator end() { return mData.end(); }
+
+    typename Data::pointer data() { return mData.data(); }
+
+    typename Data::const_iterator begin() const { return mData.begin(); }
+
+    typename Data::const_iterator end() const { return mData.end(); }
+
+    typename Data::const_pointer data() const { return mData.data(); }
+
+    typename Data::size_type size() const { return mData.size(); }
+
+    Descriptor mDesc;
+    Data mData;
+};
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+
+#include "ck/library/utility/bulk_type_convert.hpp"
+
+namespace ck {
+namespace utils {
+
+// Vectorized fp32 transcendental functions for host references, p_y[i] = f(p_x[i]).
+//
+// With AVX2 + FMA the functions are evaluated with polynomials, 8 lanes at a time; otherwise
+// the <cmath> function is used. p_x and p_y may be the same buffer. Polynomial accuracy,
+// measured against the double precision functions over the whole fp32 range:
+//   host_exp:  relative error below 2e-7; results below FLT_MIN flush to zero.
+//   host_erf:  absolute error below 2e-7.
+//   host_tanh: relative error below 2e-7.
+void host_exp(const float* p_x, float* p_y, std::size_t n, HostSimd simd = GetHostSimd());
+
+void host_erf(const float* p_x, float* p_y, std::size_t n, HostSimd simd = GetHostSimd());
+
+void host_tanh(const float* p_x, float* p_y, std::size_t n, HostSimd simd = GetHostSimd());
+
+} // namespace utils
+} // namespace ck
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
@@ -18,6 +19,8 @@
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+#include "ck/library/utility/workspace_arena.hpp"
 
 namespace ck {
 namespace utils {
@@ -83,10 +86,18 @@ class OpInstanceRunEngine
 
     OpInstanceRunEngine() = delete;
 
+    /**
+     * @param      ref_cache_key  Identifies the reference op and its parameters (e.g.
+     *                            ReferenceCacheKey::Make<RefOp>().Add(element_ops...)). When
+     *                            given and the reference cache is enabled, input and output
+     *                            tensors are added to the key and a cached reference output is
+     *                            reused instead of running reference_op.
+     */
     template <typename ReferenceOp = std::function<void()>>
     OpInstanceRunEngine(const OpInstanceT& op_instance,
-                        const ReferenceOp& reference_op = ReferenceOp{},
-                        bool do_verification            = true)
+                        const ReferenceOp& reference_op                = ReferenceOp{},
+                        bool do_verification                           = true,
+                        std::optional<ReferenceCacheKey> ref_cache_key = std::nullopt)
         : op_instance_{op_instance}
     {
         in_tensors_ = op_instance_.GetInputTensors();
@@ -99,7 +110,26 @@ class OpInstanceRunEngine
             if(do_verification)
             {
                 ref_output_ = op_instance_.GetOutputTensor();
-                CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+
+                auto run_reference = [&]() {
+                    CallRefOpUnpackArgs(reference_op, std::make_index_sequence<kNInArgs_>{});
+                };
+
+                if(ref_cache_key)
+                {
+                    auto make_ref_key = [&]() {
+                        std::apply([&](const auto&... ts) { ref_cache_key->AddAll(*ts...); },
+                                   in_tensors_);
+
+                        return ref_cache_key->Add(ref_output_->mDesc);
+                    };
+
+                    run_reference_cached(make_ref_key, *ref_output_, run_reference);
+                }
+                else
+                {
+                    run_reference();
+                }
             }
         }
         AllocateDeviceInputTensors(std::make_index_sequence<kNInArgs_>{});
@@ -121,6 +151,9 @@ class OpInstanceRunEngine
                 op_ptr.get(), in_device_buffers_, out_device_buffer_);
             if(op_ptr->IsSupportedArgument(argument.get()))
             {
+                workspace_arena_.Reset();
+                workspace_arena_.Reserve(*op_ptr, argument.get());
+
                 std::cout << "Testing instance: " << op_ptr->GetTypeString() << std::endl;
                 invoker->Run(argument.get());
                 out_device_buffer_->FromDevice(out_tensor_->mData.data());
@@ -160,6 +193,9 @@ class OpInstanceRunEngine
                 op_ptr.get(), in_device_buffers_, out_device_buffer_);
             if(op_ptr->IsSupportedArgument(argument.get()))
             {
+                workspace_arena_.Reset();
+                workspace_arena_.Reserve(*op_ptr, argument.get());
+
                 std::string op_name = op_ptr->GetTypeString();
                 float avg_time = invoker->Run(argument.get(), StreamConfig{nullptr, time_kernel});
 
@@ -238,6 +274,9 @@ class OpInstanceRunEngine
     DeviceBuffers in_device_buffers_;
     DeviceMemPtr out_device_buffer_;
 
+    // of the instance being run, reused by the next
+    WorkspaceArena workspace_arena_;
+
     template <typename T>
     bool CheckErr(const std::vector<T>& dev_out, const std::vector<T>& ref_out) const
     {
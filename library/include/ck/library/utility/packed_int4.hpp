@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "ck/library/utility/bulk_type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Packed int4 layout: element i lives in byte i / 2, even elements in the low nibble, odd
+// elements in the high nibble; a trailing odd element leaves the high nibble zero
+
+namespace detail {
+
+// 'n' is a number of int4 elements; p_dst / p_src point to (n + 1) / 2 bytes
+void pack_int4_chunk(const int8_t* p_src, uint8_t* p_dst, std::size_t n, HostSimd simd);
+void unpack_int4_chunk(const uint8_t* p_src, int8_t* p_dst, std::size_t n, HostSimd simd);
+
+} // namespace detail
+
+inline std::size_t packed_int4_bytes(std::size_t n) { return (n + 1) / 2; }
+
+// Pack n int8 values into (n + 1) / 2 bytes. Each value keeps its low 4 bits, i.e. values in
+// [-8, 7] round-trip and others wrap like a conversion to ck::int4_t.
+void pack_int4(const int8_t* p_src, uint8_t* p_dst, std::size_t n);
+
+// Unpack n sign-extended int4 values
+void unpack_int4(const uint8_t* p_src, int8_t* p_dst, std::size_t n);
+
+inline int8_t get_packed_int4(const uint8_t* p_data, std::size_t i)
+{
+    const uint8_t nibble = (i % 2 == 0) ? (p_data[i / 2] & 0x0f) : (p_data[i / 2] >> 4);
+
+    return static_cast<int8_t>((nibble ^ 0x08) - 0x08);
+}
+
+inline void set_packed_int4(uint8_t* p_data, std::size_t i, int8_t value)
+{
+    const uint8_t nibble = static_cast<uint8_t>(value) & 0x0f;
+    uint8_t& byte        = p_data[i / 2];
+
+    byte = (i % 2 == 0) ? ((byte & 0xf0) | nibble) : ((byte & 0x0f) | (nibble << 4));
+}
+
+} // namespace utils
+} // namespace ck
+
+// Proxy for one element of a PackedInt4Tensor, reads and writes int8_t values
+class PackedInt4Reference
+{
+    public:
+    PackedInt4Reference(uint8_t* p_data, std::size_t i) : p_data_(p_data), i_(i) {}
+
+    operator int8_t() const { return ck::utils::get_packed_int4(p_data_, i_); }
+
+    PackedInt4Reference& operator=(int8_t value)
+    {
+        ck::utils::set_packed_int4(p_data_, i_, value);
+        return *this;
+    }
+
+    PackedInt4Reference& operator=(const PackedInt4Reference& other)
+    {
+        return *this = static_cast<int8_t>(other);
+    }
+
+    private:
+    uint8_t* p_data_;
+    std::size_t i_;
+};
+
+/**
+ * @brief      Host tensor of signed 4-bit integers stored two per byte.
+ *
+ *             The descriptor is in units of elements, exactly as for Tensor<T>; the storage
+ *             holds GetElementSpaceSize() nibbles in the packed int4 layout, so strided and
+ *             broadcast descriptors work unchanged. Elements are accessed as int8_t through a
+ *             proxy. Conversion from and to Tensor<T> uses the bulk pack / unpack routines when
+ *             T is int8_t.
+ */
+struct PackedInt4Tensor
+{
+    using Descriptor = HostTensorDescriptor;
+    using Data       = std::vector<uint8_t>;
+
+    explicit PackedInt4Tensor(const Descriptor& desc)
+        : mDesc(desc), mData(ck::utils::packed_int4_bytes(desc.GetElementSpaceSize()))
+    {
+    }
+
+    template <typename X>
+    explicit PackedInt4Tensor(const std::vector<X>& lens) : PackedInt4Tensor(Descriptor(lens))
+    {
+    }
+
+    template <typename X>
+    PackedInt4Tensor(std::initializer_list<X> lens) : PackedInt4Tensor(Descriptor(lens))
+    {
+    }
+
+    // pack the element space of 'tensor', values keep their low 4 bits
+    template <typename T>
+    explicit PackedInt4Tensor(const Tensor<T>& tensor) : PackedInt4Tensor(tensor.mDesc)
+    {
+        if constexpr(std::is_same_v<T, int8_t>)
+        {
+            ck::utils::pack_int4(tensor.data(), mData.data(), tensor.mData.size());
+        }
+        else
+        {
+            for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+            {
+                ck::utils::set_packed_int4(mData.data(), i, static_cast<int8_t>(tensor.mData[i]));
+            }
+        }
+    }
+
+    // unpack to a Tensor with the same descriptor
+    template <typename T = int8_t>
+    Tensor<T> Unpack() const
+    {
+        Tensor<T> tensor(mDesc);
+
+        if constexpr(std::is_same_v<T, int8_t>)
+        {
+            ck::utils::unpack_int4(mData.data(), tensor.data(), tensor.mData.size());
+        }
+        else
+        {
+            for(std::size_t i = 0; i < tensor.mData.size(); ++i)
+            {
+                tensor.mData[i] = static_cast<T>(ck::utils::get_packed_int4(mData.data(), i));
+            }
+        }
+
+        return tensor;
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    // storage size, e.g. for DeviceMem
+    std::size_t GetElementSpaceSizeInBytes() const { return mData.size(); }
+
+    template <typename... Is>
+    PackedInt4Reference operator()(Is... is)
+    {
+        return PackedInt4Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(is...)};
+    }
+
+    template <typename... Is>
+    int8_t operator()(Is... is) const
+    {
+        return ck::utils::get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(is...));
+    }
+
+    PackedInt4Reference operator()(const std::vector<std::size_t>& idx)
+    {
+        return PackedInt4Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(idx)};
+    }
+
+    int8_t operator()(const std::vector<std::size_t>& idx) const
+    {
+        return ck::utils::get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(idx));
+    }
+
+    uint8_t* data() { return mData.data(); }
+
+    const uint8_t* data() const { return mData.data(); }
+
+    Descriptor mDesc;
+    Data mData;
+};
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "ck/host_utility/trace.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/tensor_io.hpp"
+
+namespace ck {
+namespace utils {
+
+// 64-bit hash of a byte range, processed a word at a time
+std::uint64_t HashBytes(const void* p, std::size_t size, std::uint64_t seed);
+
+/**
+ * @brief      Content address of a reference result.
+ *
+ *             The key hashes everything the reference output depends on: the reference op type
+ *             (whose mangled name carries the data types, layouts and element-op types), the
+ *             element-op parameters, the tensor descriptors and the input data. Inputs are
+ *             hashed by content rather than by generator and seed, since the host generators
+ *             draw from process-wide std::rand() state; hashing is O(inputs) while the
+ *             reference is typically O(flops).
+ */
+class ReferenceCacheKey
+{
+    public:
+    ReferenceCacheKey() = default;
+
+    explicit ReferenceCacheKey(const std::string& op_name) { Add(op_name); }
+
+    template <typename Op>
+    static ReferenceCacheKey Make()
+    {
+        return ReferenceCacheKey{typeid(Op).name()};
+    }
+
+    ReferenceCacheKey& AddBytes(const void* p, std::size_t size)
+    {
+        h0_ = HashBytes(p, size, h0_);
+        h1_ = HashBytes(p, size, h1_ ^ size);
+        return *this;
+    }
+
+    ReferenceCacheKey& Add(const std::string& str)
+    {
+        AddSize(str.size());
+        return AddBytes(str.data(), str.size());
+    }
+
+    ReferenceCacheKey& Add(const char* str) { return Add(std::string(str)); }
+
+    // Scalars and parameter structs, e.g. element-wise operations. Empty structs, e.g.
+    // PassThrough, add nothing: their type is part of the op type. Other structs are hashed by
+    // their bytes, so they must not have padding or floating-point members, whose bytes are
+    // indeterminate or not unique; add the members of those, e.g. Add(scale.scale_).
+    template <typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    ReferenceCacheKey& Add(const T& value)
+    {
+        if constexpr(std::is_empty_v<T>)
+        {
+            return *this;
+        }
+        else if constexpr(std::is_floating_point_v<T>)
+        {
+            // long double has padding
+            const double x = value;
+
+            return AddBytes(&x, sizeof(x));
+        }
+        else
+        {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                              std::has_unique_object_representations_v<T>,
+                          "wrong! bytes of T do not identify its value, add its members instead");
+
+            return AddBytes(&value, sizeof(T));
+        }
+    }
+
+    template <typename T>
+    ReferenceCacheKey& Add(const std::vector<T>& values)
+    {
+        AddSize(values.size());
+        for(const auto& v : values)
+        {
+            Add(v);
+        }
+        return *this;
+    }
+
+    ReferenceCacheKey& Add(const HostTensorDescriptor& desc)
+    {
+        Add(desc.GetLengths());
+        return Add(desc.GetStrides());
+    }
+
+    template <typename T>
+    ReferenceCacheKey& Add(const TensorView<T>& view)
+    {
+        Add(std::string(typeid(T).name()));
+        Add(view.mDesc);
+        return AddBytes(view.data(), sizeof(T) * view.GetElementSpaceSize());
+    }
+
+    template <typename T>
+    ReferenceCacheKey& Add(const Tensor<T>& tensor)
+    {
+        return Add(TensorView<const T>{tensor});
+    }
+
+    template <typename T>
+    ReferenceCacheKey& AddType()
+    {
+        return Add(std::string(typeid(T).name()));
+    }
+
+    template <typename... Xs>
+    ReferenceCacheKey& AddAll(const Xs&... xs)
+    {
+        (Add(xs), ...);
+        return *this;
+    }
+
+    // 32 hex digits, used as file name
+    std::string ToString() const;
+
+    friend bool operator==(const ReferenceCacheKey& a, const ReferenceCacheKey& b)
+    {
+        return a.h0_ == b.h0_ && a.h1_ == b.h1_;
+    }
+
+    private:
+    void AddSize(std::size_t size) { AddBytes(&size, sizeof(size)); }
+
+    std::uint64_t h0_ = 0x6a09e667f3bcc908ull;
+    std::uint64_t h1_ = 0xbb67ae8584caa73bull;
+};
+
+/**
+ * @brief      On-disk, content-addressed cache of reference outputs.
+ *
+ *             Each entry is a .npy file holding the raw element space of the output tensor,
+ *             named after its key, and is memory-mapped on lookup. Lookups refresh the entry's
+ *             modification time; stores evict the least recently used entries until the
+ *             directory fits the size limit. Entries are written to a temporary file and renamed,
+ *             so concurrent profiler processes may share a directory.
+ */
+class ReferenceCache
+{
+    public:
+    ReferenceCache(const std::string& dir, std::size_t max_bytes);
+
+    // Cache configured by the environment: CK_REFERENCE_CACHE_DIR enables it and
+    // CK_REFERENCE_CACHE_MAX_MB (default 4096) limits its size. nullptr when disabled.
+    static ReferenceCache* GetDefault();
+
+    template <typename T>
+    bool Load(const ReferenceCacheKey& key, Tensor<T>& out) const
+    {
+        if constexpr(is_tensor_file_data_type_v<T>)
+        {
+            const std::string path = GetPath(key);
+
+            if(!Touch(path))
+                return false;
+
+            try
+            {
+                const auto cached = LoadNpy<T>(path);
+
+                if(cached.size() != out.mData.size())
+                    return false;
+
+                std::copy(cached.data(), cached.data() + cached.size(), out.mData.begin());
+                return true;
+            }
+            catch(const std::runtime_error&)
+            {
+                // truncated or foreign file, treat as a miss; Store() replaces it
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template <typename T>
+    void Store(const ReferenceCacheKey& key, const Tensor<T>& out)
+    {
+        if constexpr(is_tensor_file_data_type_v<T>)
+        {
+            const std::string path = GetPath(key);
+            const std::string tmp  = MakeTempPath(path);
+
+            {
+                auto file = CreateNpy<T>(tmp, {out.mData.size()});
+                std::copy(out.mData.begin(), out.mData.end(), file.data());
+            }
+
+            Commit(tmp, path);
+            Trim();
+        }
+    }
+
+    // evict least recently used entries until the total size is at most max_bytes
+    void Trim(std::size_t max_bytes) const;
+    void Trim() const { Trim(max_bytes_); }
+
+    std::size_t GetSizeInBytes() const;
+
+    const std::string& GetDirectory() const { return dir_; }
+
+    private:
+    std::string GetPath(const ReferenceCacheKey& key) const;
+    static std::string MakeTempPath(const std::string& path);
+    static void Commit(const std::string& tmp, const std::string& path);
+    // refresh the LRU time stamp; false if the entry does not exist
+    static bool Touch(const std::string& path);
+
+    std::string dir_;
+    std::size_t max_bytes_;
+};
+
+// Fill 'out' from the cache, or by calling 'run_reference' and caching the result. Returns
+// true on a cache hit. 'make_key' is the ReferenceCacheKey or, better, a function returning it,
+// which is only called when there is a cache, as hashing the inputs is a pass over them.
+template <typename T, typename MakeKey, typename F>
+bool run_reference_cached(MakeKey&& make_key,
+                          Tensor<T>& out,
+                          F&& run_reference,
+                          ReferenceCache* cache = ReferenceCache::GetDefault())
+{
+    CK_TRACE_ZONE(zone, "reference", "run_reference_cached");
+
+    if(cache == nullptr)
+    {
+        run_reference();
+
+        return false;
+    }
+
+    const ReferenceCacheKey key = [&]() -> ReferenceCacheKey {
+        if constexpr(std::is_invocable_v<MakeKey>)
+        {
+            return make_key();
+        }
+        else
+        {
+            return make_key;
+        }
+    }();
+
+    if(cache->Load(key, out))
+    {
+        zone.AddArg("cache_hit", 1);
+
+        return true;
+    }
+
+    zone.AddArg("cache_hit", 0);
+
+    run_reference();
+
+    cache->Store(key, out);
+
+    return false;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,432 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+enum struct TensorFileDataType
+{
+    F32,
+    F16,
+    BF16,
+    I8,
+    I32,
+};
+
+template <typename T>
+struct tensor_file_data_type;
+
+template <>
+struct tensor_file_data_type<float>
+{
+    static constexpr auto value = TensorFileDataType::F32;
+};
+
+template <>
+struct tensor_file_data_type<half_t>
+{
+    static constexpr auto value = TensorFileDataType::F16;
+};
+
+template <>
+struct tensor_file_data_type<bhalf_t>
+{
+    static constexpr auto value = TensorFileDataType::BF16;
+};
+
+template <>
+struct tensor_file_data_type<int8_t>
+{
+    static constexpr auto value = TensorFileDataType::I8;
+};
+
+template <>
+struct tensor_file_data_type<int32_t>
+{
+    static constexpr auto value = TensorFileDataType::I32;
+};
+
+template <typename T>
+inline constexpr TensorFileDataType tensor_file_data_type_v =
+    tensor_file_data_type<std::remove_cv_t<T>>::value;
+
+template <typename T, typename = void>
+struct is_tensor_file_data_type : std::false_type
+{
+};
+
+template <typename T>
+struct is_tensor_file_data_type<T, std::void_t<decltype(tensor_file_data_type<T>::value)>>
+    : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_tensor_file_data_type_v =
+    is_tensor_file_data_type<std::remove_cv_t<T>>::value;
+
+std::size_t GetTensorFileDataTypeSize(TensorFileDataType type);
+
+std::string GetTensorFileDataTypeString(TensorFileDataType type);
+
+/**
+ * @brief      RAII wrapper of a memory-mapped file.
+ *
+ *             Open() maps an existing file read-only. Create() creates (or truncates) a file of
+ *             the given size and maps it shared and writable, so stores into the mapping are
+ *             written back to the file by the OS without an intermediate host buffer.
+ */
+class MappedFile
+{
+    public:
+    static std::shared_ptr<MappedFile> Open(const std::string& path);
+    static std::shared_ptr<MappedFile> Create(const std::string& path, std::size_t size);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    const std::byte* data() const { return p_data_; }
+    std::byte* data() { return p_data_; }
+
+    std::size_t size() const { return size_; }
+
+    bool IsWritable() const { return writable_; }
+
+    // synchronously write back dirty pages of a writable mapping
+    void Flush();
+
+    private:
+    MappedFile(std::byte* p_data, std::size_t size, bool writable)
+        : p_data_(p_data), size_(size), writable_(writable)
+    {
+    }
+
+    std::byte* p_data_;
+    std::size_t size_;
+    bool writable_;
+};
+
+/**
+ * @brief      A TensorView whose storage is a memory-mapped file.
+ *
+ *             The view keeps the mapping alive. Copies of the underlying TensorView (e.g. when
+ *             passed to a reference op) do not, so the MappedTensor must outlive them. Data the
+ *             file does not align for T is read into a copy, which the view keeps alive instead.
+ */
+template <typename T>
+struct MappedTensor : public TensorView<T>
+{
+    MappedTensor(std::shared_ptr<MappedFile> file,
+                 const HostTensorDescriptor& desc,
+                 T* p_data,
+                 std::shared_ptr<const void> copy = nullptr)
+        : TensorView<T>(desc, p_data), file_(std::move(file)), copy_(std::move(copy))
+    {
+    }
+
+    const std::shared_ptr<MappedFile>& GetFile() const { return file_; }
+
+    // whether the view is of a copy rather than of the mapping
+    bool IsCopy() const { return copy_ != nullptr; }
+
+    private:
+    std::shared_ptr<MappedFile> file_;
+    std::shared_ptr<const void> copy_;
+};
+
+struct TensorFileEntry
+{
+    TensorFileDataType type;
+    std::vector<std::size_t> lengths;
+    std::size_t begin; // byte offset of the first element, from the start of the file
+    std::size_t end;   // byte offset one past the last element, from the start of the file
+};
+
+namespace detail {
+
+template <typename T>
+HostTensorDescriptor make_mapped_tensor_descriptor(const TensorFileEntry& entry,
+                                                   bool column_major = false)
+{
+    if(entry.type != tensor_file_data_type_v<T>)
+    {
+        throw std::runtime_error("tensor file: data type mismatch, stored " +
+                                 GetTensorFileDataTypeString(entry.type) + ", requested " +
+                                 GetTensorFileDataTypeString(tensor_file_data_type_v<T>));
+    }
+
+    HostTensorDescriptor desc(entry.lengths);
+
+    if(column_major)
+    {
+        std::vector<std::size_t> strides(entry.lengths.size(), 1);
+        for(std::size_t i = 1; i < strides.size(); ++i)
+        {
+            strides[i] = strides[i - 1] * entry.lengths[i - 1];
+        }
+        desc = HostTensorDescriptor(entry.lengths, strides);
+    }
+
+    if(entry.end - entry.begin != sizeof(T) * desc.GetElementSpaceSize() &&
+       desc.GetElementSize() != 0)
+    {
+        throw std::runtime_error("tensor file: byte size does not match shape");
+    }
+
+    return desc;
+}
+
+template <typename T>
+bool is_aligned_for(const std::byte* p)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignof(T) == 0;
+}
+
+// Read side: a view of the mapping, or of a copy where the offset in the file does not align the
+// data for T, e.g. in .safetensors files, which pack tensors of all types without padding
+template <typename T>
+MappedTensor<const T> make_mapped_tensor(const std::shared_ptr<MappedFile>& file,
+                                         const TensorFileEntry& entry,
+                                         bool column_major = false)
+{
+    const auto desc          = make_mapped_tensor_descriptor<T>(entry, column_major);
+    const std::byte* p_entry = file->data() + entry.begin;
+
+    if(is_aligned_for<T>(p_entry))
+    {
+        return MappedTensor<const T>{file, desc, reinterpret_cast<const T*>(p_entry)};
+    }
+
+    auto copy = std::make_shared<std::vector<std::remove_cv_t<T>>>(desc.GetElementSpaceSize());
+
+    std::memcpy(copy->data(), p_entry, entry.end - entry.begin);
+
+    return MappedTensor<const T>{file, desc, copy->data(), copy};
+}
+
+template <typename T>
+void write_tensor_view(std::ostream& os, const TensorView<const T>& view)
+{
+    // stream in fixed size chunks, in logical order, so strided or broadcast views never need
+    // a packed copy of the whole tensor
+    constexpr std::size_t chunk_elements = (std::size_t{1} << 20) / sizeof(T);
+
+    if(view.IsPacked())
+    {
+        os.write(reinterpret_cast<const char*>(view.data()), sizeof(T) * view.size());
+        return;
+    }
+
+    std::vector<std::remove_cv_t<T>> buffer;
+    buffer.reserve(std::min(chunk_elements, view.size()));
+
+    for(auto it = view.begin(); it != view.end();)
+    {
+        buffer.clear();
+        for(; it != view.end() && buffer.size() < chunk_elements; ++it)
+        {
+            buffer.push_back(*it);
+        }
+        os.write(reinterpret_cast<const char*>(buffer.data()), sizeof(T) * buffer.size());
+    }
+}
+
+} // namespace detail
+
+// NumPy .npy (format version 1.0 - 3.0), little-endian only. bf16 is stored with descr '|V2', as
+// numpy writes 2-byte void; '<V2' is read too.
+struct NpyHeader
+{
+    TensorFileEntry entry;
+    bool fortran_order;
+};
+
+NpyHeader ParseNpyHeader(const std::byte* p_data, std::size_t size);
+
+std::string MakeNpyHeader(TensorFileDataType type, const std::vector<std::size_t>& lengths);
+
+// map an .npy file read-only, zero copy; Fortran order files become column-major views
+template <typename T>
+MappedTensor<const T> LoadNpy(const std::string& path)
+{
+    auto file         = MappedFile::Open(path);
+    const auto header = ParseNpyHeader(file->data(), file->size());
+
+    return detail::make_mapped_tensor<T>(file, header.entry, header.fortran_order);
+}
+
+// create an .npy file of the given shape and map it writable; results can be written (or
+// copied from device) straight into the returned view
+template <typename T>
+MappedTensor<T> CreateNpy(const std::string& path, const std::vector<std::size_t>& lengths)
+{
+    const std::string header = MakeNpyHeader(tensor_file_data_type_v<T>, lengths);
+
+    const std::size_t num_elements = std::accumulate(
+        lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+    auto file = MappedFile::Create(path, header.size() + sizeof(T) * num_elements);
+    std::copy(header.begin(), header.end(), reinterpret_cast<char*>(file->data()));
+
+    T* p_data = reinterpret_cast<T*>(file->data() + header.size());
+
+    return MappedTensor<T>{std::move(file), HostTensorDescriptor(lengths), p_data};
+}
+
+// write a (possibly strided) view as a packed row-major .npy file
+template <typename T>
+void SaveNpy(const std::string& path, const TensorView<const T>& view)
+{
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if(!os)
+    {
+        throw std::runtime_error("SaveNpy: cannot open " + path);
+    }
+
+    const std::string header = MakeNpyHeader(tensor_file_data_type_v<T>, view.GetLengths());
+    os.write(header.data(), header.size());
+    detail::write_tensor_view(os, view);
+
+    if(!os)
+    {
+        throw std::runtime_error("SaveNpy: write failed for " + path);
+    }
+}
+
+template <typename T>
+void SaveNpy(const std::string& path, const Tensor<T>& tensor)
+{
+    SaveNpy(path, TensorView<const T>{tensor});
+}
+
+// HuggingFace .safetensors, read side. The whole file is mapped once and every tensor is a
+// zero-copy view into it.
+class SafeTensorsFile
+{
+    public:
+    explicit SafeTensorsFile(const std::string& path);
+
+    std::vector<std::string> GetNames() const;
+
+    bool Contains(const std::string& name) const { return entries_.count(name) != 0; }
+
+    const TensorFileEntry& GetEntry(const std::string& name) const;
+
+    const std::map<std::string, std::string>& GetMetadata() const { return metadata_; }
+
+    template <typename T>
+    MappedTensor<const T> Get(const std::string& name) const
+    {
+        return detail::make_mapped_tensor<T>(file_, GetEntry(name));
+    }
+
+    private:
+    std::shared_ptr<MappedFile> file_;
+    std::map<std::string, TensorFileEntry> entries_;
+    std::map<std::string, std::string> metadata_;
+};
+
+// HuggingFace .safetensors, write side. All tensors are declared up front so the header can
+// be written first; the file is then mapped writable and each tensor is exposed as a view that
+// outputs are streamed into directly.
+class SafeTensorsWriter
+{
+    public:
+    struct TensorDesc
+    {
+        std::string name;
+        TensorFileDataType type;
+        std::vector<std::size_t> lengths;
+    };
+
+    SafeTensorsWriter(const std::string& path,
+                      const std::vector<TensorDesc>& tensors,
+                      const std::map<std::string, std::string>& metadata = {});
+
+    // a writable view of the mapping; throws for a tensor the file does not align for T, which
+    // Write() copies into instead
+    template <typename T>
+    MappedTensor<T> Get(const std::string& name)
+    {
+        const auto& entry = GetEntry(name);
+        const auto desc   = detail::make_mapped_tensor_descriptor<T>(entry);
+
+        std::byte* p_entry = file_->data() + entry.begin;
+
+        if(!detail::is_aligned_for<T>(p_entry))
+        {
+            throw std::runtime_error("SafeTensorsWriter::Get: tensor not aligned, use Write for " +
+                                     name);
+        }
+
+        return MappedTensor<T>{file_, desc, reinterpret_cast<T*>(p_entry)};
+    }
+
+    // copy a (possibly strided) view into the named tensor, in logical order
+    template <typename T>
+    void Write(const std::string& name, const TensorView<const T>& src)
+    {
+        const auto& entry = GetEntry(name);
+        const auto desc   = detail::make_mapped_tensor_descriptor<T>(entry);
+
+        if(desc.GetLengths() != src.GetLengths())
+        {
+            throw std::runtime_error("SafeTensorsWriter::Write: shape mismatch for " + name);
+        }
+
+        // byte-wise, as the tensor may not be aligned for T
+        std::byte* p_dst = file_->data() + entry.begin;
+
+        if(src.IsPacked())
+        {
+            std::memcpy(p_dst, src.data(), sizeof(T) * src.size());
+            return;
+        }
+
+        for(auto it = src.begin(); it != src.end(); ++it, p_dst += sizeof(T))
+        {
+            const std::remove_cv_t<T> x = *it;
+
+            std::memcpy(p_dst, &x, sizeof(T));
+        }
+    }
+
+    template <typename T>
+    void Write(const std::string& name, const Tensor<T>& src)
+    {
+        Write(name, TensorView<const T>{src});
+    }
+
+    void Flush() { file_->Flush(); }
+
+    private:
+    const TensorFileEntry& GetEntry(const std::string& name) const;
+
+    std::shared_ptr<MappedFile> file_;
+    std::map<std::string, TensorFileEntry> entries_;
+};
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// One device operation call of an application
+struct WorkloadRecord
+{
+    // ckProfiler operation the call is replayed with, e.g. "gemm"
+    std::string operation_;
+
+    // the problem, as the arguments of the ckProfiler operation that are not run options, e.g.
+    // data type, layout, M, N, K, StrideA, StrideB and StrideC for "gemm"
+    std::vector<int64_t> problem_;
+
+    // parameters of the element-wise operations, e.g. alpha and beta
+    std::vector<double> parameters_;
+
+    // BaseOperator::GetTypeString() and GetInstanceId() of the instance called
+    std::string instance_;
+    uint64_t instance_id_ = 0;
+
+    // as returned by the invoker, 0 if the kernel was not timed
+    double ave_time_ms_ = 0;
+};
+
+// Compact binary encoding of records. A trace is a sequence of segments, each a header followed by
+// records; strings, e.g. the instance type strings, are written once per segment and referred to
+// by index. Integers are LEB128 varints, signed ones zigzag encoded.
+class WorkloadTraceEncoder
+{
+    public:
+    // starts a segment
+    WorkloadTraceEncoder();
+
+    void Encode(const WorkloadRecord& record);
+
+    // the bytes encoded since the last call
+    std::string Flush();
+
+    // the number of bytes Flush() would return
+    std::size_t GetNumBytes() const { return bytes_.size(); }
+
+    private:
+    uint64_t GetStringIndex(const std::string& str);
+
+    std::string bytes_;
+    std::unordered_map<std::string, uint64_t> string_indices_;
+};
+
+std::string EncodeWorkloadTrace(const std::vector<WorkloadRecord>& records);
+
+// throws on a malformed trace
+std::vector<WorkloadRecord> DecodeWorkloadTrace(const std::string& bytes);
+
+std::vector<WorkloadRecord> LoadWorkloadTrace(const std::string& path);
+
+// Appends records to a trace file, as a new segment; thread safe. Records are buffered, and
+// written once max_buffered_bytes of them are, on Flush() and on destruction, which is at exit for
+// the writer of CK_WORKLOAD_TRACE.
+class WorkloadTraceWriter
+{
+    public:
+    static constexpr std::size_t max_buffered_bytes = 1 << 20;
+
+    explicit WorkloadTraceWriter(const std::string& path);
+
+    ~WorkloadTraceWriter();
+
+    void Write(const WorkloadRecord& record);
+
+    // writes the buffered records to the file
+    void Flush();
+
+    private:
+    void FlushLocked();
+
+    std::mutex mutex_;
+    std::ofstream file_;
+    WorkloadTraceEncoder encoder_;
+};
+
+// the writer of the trace file CK_WORKLOAD_TRACE names, nullptr if it is not set
+WorkloadTraceWriter* GetWorkloadTraceWriter();
+
+// the calls of a trace with the same problem
+struct WorkloadReplayItem
+{
+    // the first call
+    WorkloadRecord record_;
+
+    std::size_t num_calls_ = 0;
+    double total_time_ms_  = 0;
+
+    // instances called, in order of first call
+    std::vector<uint64_t> instance_ids_;
+};
+
+// one item per operation, problem and parameters, the most total time first, then the most calls
+std::vector<WorkloadReplayItem> PlanWorkloadReplay(const std::vector<WorkloadRecord>& records);
+
+struct WorkloadReplayOptions
+{
+    // every instance, instead of the instances called
+    bool all_instances_   = false;
+    bool do_verification_ = false;
+    int init_method_      = 1;
+    bool do_log_          = false;
+    bool time_kernel_     = true;
+};
+
+// ckProfiler command lines, from the program name on, re-running the items. The operations follow
+// the convention of "gemm": data type and layout, the run options, the rest of the problem and an
+// optional instance ID.
+std::vector<std::vector<std::string>>
+MakeWorkloadReplayCommands(const std::vector<WorkloadReplayItem>& items,
+                           const WorkloadReplayOptions& options);
+
+} // namespace utils
+} // namespace ck
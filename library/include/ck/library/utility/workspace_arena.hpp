@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/device_memory_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+// Workspace of the device operations of a sequence, e.g. the instances a profiler runs one after
+// another, or the operations of a pipeline that are live at the same time. The regions reserved
+// since the last Reset() are aligned and disjoint; Reset() ends the sequence, and the next one
+// reuses the memory.
+//
+// The regions are carved out of one buffer. A sequence that does not fit gets blocks of its own
+// for the rest, and its Reset() grows the buffer to the total it reserved, so that once the
+// largest sequence has been seen, no more memory is allocated.
+//
+//     WorkspaceArena workspace_arena;
+//
+//     for(auto& op_ptr : op_ptrs)
+//     {
+//         auto argument_ptr = op_ptr->MakeArgumentPointer(...);
+//
+//         workspace_arena.Reset();
+//         workspace_arena.Reserve(*op_ptr, argument_ptr.get());
+//         ...
+//     }
+//
+// The memory is reused in stream order: operations of consecutive sequences have to run on the
+// stream of the arena, or be synchronized before Reset(). Not thread safe.
+class WorkspaceArena
+{
+    public:
+    static constexpr std::size_t alignment = 256;
+
+    explicit WorkspaceArena(DeviceMemoryAllocator& allocator = GetDefaultDeviceMemoryAllocator(),
+                            hipStream_t stream               = nullptr);
+
+    WorkspaceArena(const WorkspaceArena&) = delete;
+    WorkspaceArena& operator=(const WorkspaceArena&) = delete;
+
+    ~WorkspaceArena();
+
+    // A region of size bytes, live until Reset(); nullptr for a size of 0
+    void* Reserve(std::size_t size);
+
+    // Reserves the workspace op needs for the argument and sets it as its workspace
+    void* Reserve(const tensor_operation::device::BaseOperator& op,
+                  tensor_operation::device::BaseArgument* p_arg);
+
+    // Ends the sequence, growing the buffer if the sequence did not fit. Never shrinks.
+    void Reset();
+
+    // of the buffer, which is allocated by the first Reserve()
+    std::size_t GetCapacity() const { return capacity_; }
+
+    // since the last Reset(), with the alignment
+    std::size_t GetBytesReserved() const { return bytes_reserved_; }
+
+    // from the allocator, in the lifetime of the arena
+    std::size_t GetNumAllocations() const { return num_allocations_; }
+
+    static std::size_t GetAlignedSize(std::size_t size)
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    private:
+    void* Allocate(std::size_t size);
+
+    // the buffer and the blocks of the sequence that did not fit
+    void FreeAll();
+
+    DeviceMemoryAllocator& allocator_;
+    const hipStream_t stream_;
+
+    void* p_buffer_       = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t offset_   = 0;
+
+    std::vector<void*> overflow_blocks_;
+
+    std::size_t bytes_reserved_  = 0;
+    std::size_t num_allocations_ = 0;
+};
+
+} // namespace utils
+} // namespace ck
@@ -103,23 +103,23 @@ using device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances = std::tuple
     >;
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances(
-    std::vector<std::unique_ptr<DeviceConvFwd<2,
-                                              NHWC,
-                                              KYXC,
-                                              NHWK,
-                                              BF16,
-                                              BF16,
-                                              BF16,
-                                              PassThrough,
-                                              PassThrough,
-                                              PassThrough>>>& instances)
+    DeviceOperationInstanceDescriptors<DeviceConvFwd<2,
+                                                     NHWC,
+                                                     KYXC,
+                                                     NHWK,
+                                                     BF16,
+                                                     BF16,
+                                                     BF16,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_bf16_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
+    add_device_operation_instance_descriptors<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_bf16_instances>(
+        instances);
+    add_device_operation_instance_descriptors<
+        device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_bf16_instances>(instances);
+    add_device_operation_instance_descriptors<
+        device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances>(instances);
 }
 
 } // namespace instance
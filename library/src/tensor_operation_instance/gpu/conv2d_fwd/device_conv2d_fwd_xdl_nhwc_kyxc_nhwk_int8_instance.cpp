@@ -100,23 +100,23 @@ using device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_int8_instances = std::tuple
     >;
 
 void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(
-    std::vector<std::unique_ptr<DeviceConvFwd<2,
-                                              NHWC,
-                                              KYXC,
-                                              NHWK,
-                                              int8_t,
-                                              int8_t,
-                                              int8_t,
-                                              PassThrough,
-                                              PassThrough,
-                                              PassThrough>>>& instances)
+    DeviceOperationInstanceDescriptors<DeviceConvFwd<2,
+                                                     NHWC,
+                                                     KYXC,
+                                                     NHWK,
+                                                     int8_t,
+                                                     int8_t,
+                                                     int8_t,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_int8_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_int8_instances{});
+    add_device_operation_instance_descriptors<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances>(
+        instances);
+    add_device_operation_instance_descriptors<
+        device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_int8_instances>(instances);
+    add_device_operation_instance_descriptors<
+        device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_int8_instances>(instances);
 }
 
 } // namespace instance
@@ -39,11 +39,12 @@ using device_gemm_dl_f32_f32_f32_km_kn_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_f32_f32_f32_km_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_dl_f32_f32_f32_km_kn_mn_instances{});
+    add_device_operation_instance_descriptors<device_gemm_dl_f32_f32_f32_km_kn_mn_instances>(
+        instances);
 }
 
 } // namespace instance
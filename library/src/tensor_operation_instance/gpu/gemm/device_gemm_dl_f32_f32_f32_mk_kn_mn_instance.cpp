@@ -40,11 +40,12 @@ using device_gemm_dl_f32_f32_f32_mk_kn_mn_instances =
         >;
 
 void add_device_gemm_dl_f32_f32_f32_mk_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Row, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_dl_f32_f32_f32_mk_kn_mn_instances{});
+    add_device_operation_instance_descriptors<device_gemm_dl_f32_f32_f32_mk_kn_mn_instances>(
+        instances);
 }
 
 } // namespace instance
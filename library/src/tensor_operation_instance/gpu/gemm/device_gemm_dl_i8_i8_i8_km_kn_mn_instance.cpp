@@ -36,11 +36,12 @@ using device_gemm_dl_i8_i8_i8_km_kn_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_i8_i8_i8_km_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Col, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_dl_i8_i8_i8_km_kn_mn_instances{});
+    add_device_operation_instance_descriptors<device_gemm_dl_i8_i8_i8_km_kn_mn_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -122,13 +122,14 @@ using device_gemm_xdl_f16_f16_f16_mk_kn_mn_irregular_tile_instances = std::tuple
     >;
 
 void add_device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances{});
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_f16_f16_f16_mk_kn_mn_irregular_tile_instances{});
+    add_device_operation_instance_descriptors<device_gemm_xdl_f16_f16_f16_mk_kn_mn_instances>(
+        instances);
+    add_device_operation_instance_descriptors<
+        device_gemm_xdl_f16_f16_f16_mk_kn_mn_irregular_tile_instances>(instances);
 }
 
 } // namespace instance
@@ -43,11 +43,12 @@ using device_gemm_xdl_f64_f64_f64_km_kn_mn_instances =
         >;
 
 void add_device_gemm_xdl_f64_f64_f64_km_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Row, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Col, Row, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f64_f64_f64_km_kn_mn_instances{});
+    add_device_operation_instance_descriptors<device_gemm_xdl_f64_f64_f64_km_kn_mn_instances>(
+        instances);
 }
 
 } // namespace instance
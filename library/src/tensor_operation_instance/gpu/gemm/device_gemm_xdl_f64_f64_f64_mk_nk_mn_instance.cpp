@@ -48,11 +48,12 @@ using device_gemm_xdl_f64_f64_f64_mk_nk_mn_instances =
         >;
 
 void add_device_gemm_xdl_f64_f64_f64_mk_nk_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Col, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceDescriptors<
+        DeviceGemm<Row, Col, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f64_f64_f64_mk_nk_mn_instances{});
+    add_device_operation_instance_descriptors<device_gemm_xdl_f64_f64_f64_mk_nk_mn_instances>(
+        instances);
 }
 
 } // namespace instance
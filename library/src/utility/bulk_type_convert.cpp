@@ -0,0 +1,399 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ck/library/utility/bulk_type_convert.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_BULK_TYPE_CONVERT_X86 1
+#include <immintrin.h>
+#else
+#define CK_BULK_TYPE_CONVERT_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+HostSimd GetSupportedHostSimd()
+{
+#if CK_BULK_TYPE_CONVERT_X86
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f"))
+        return HostSimd::Avx512;
+
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c"))
+        return HostSimd::Avx2;
+#endif
+    return HostSimd::None;
+}
+
+HostSimd ClampHostSimd(HostSimd simd)
+{
+    static const HostSimd supported = GetSupportedHostSimd();
+
+    return std::min(simd, supported);
+}
+
+template <typename Y, typename X>
+void convert_scalar(const X* p_src, Y* p_dst, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        p_dst[i] = ck::type_convert<Y>(p_src[i]);
+    }
+}
+
+// float -> int8_t for values representable in int8_t; saturates otherwise, like the SIMD paths
+int8_t float_to_int8_saturate(float x)
+{
+    if(!(x > -129.f)) // also NaN
+        return int8_t{-128};
+    if(!(x < 128.f))
+        return int8_t{127};
+    return static_cast<int8_t>(x);
+}
+
+#if CK_BULK_TYPE_CONVERT_X86
+
+// Same bit manipulation as ck::type_convert<bhalf_t, float>: round to nearest even unless the
+// value is Inf/NaN, in which case a NaN keeps a non-zero mantissa
+__attribute__((target("avx2"))) __m256i float_to_bhalf_bits_avx2(__m256 v)
+{
+    const __m256i u        = _mm256_castps_si256(v);
+    const __m256i exponent = _mm256_set1_epi32(0x7f800000);
+
+    const __m256i lsb     = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7fff), lsb));
+
+    const __m256i is_inf_nan =
+        _mm256_cmpeq_epi32(_mm256_and_si256(u, exponent), exponent);
+    const __m256i has_low_bits = _mm256_xor_si256(
+        _mm256_cmpeq_epi32(_mm256_and_si256(u, _mm256_set1_epi32(0xffff)),
+                           _mm256_setzero_si256()),
+        _mm256_set1_epi32(-1));
+    const __m256i nan_fixed =
+        _mm256_or_si256(u, _mm256_and_si256(has_low_bits, _mm256_set1_epi32(0x10000)));
+
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, nan_fixed, is_inf_nan), 16);
+}
+
+__attribute__((target("avx2,f16c"))) std::size_t
+convert_avx2(const float* p_src, half_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(p_src + i),
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i), h);
+    }
+    return i;
+}
+
+__attribute__((target("avx2,f16c"))) std::size_t
+convert_avx2(const half_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+        _mm256_storeu_ps(p_dst + i, _mm256_cvtph_ps(h));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) std::size_t
+convert_avx2(const float* p_src, bhalf_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m256i lo = float_to_bhalf_bits_avx2(_mm256_loadu_ps(p_src + i));
+        const __m256i hi = float_to_bhalf_bits_avx2(_mm256_loadu_ps(p_src + i + 8));
+        // packus works per 128-bit lane, restore element order afterwards
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), packed);
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) std::size_t
+convert_avx2(const bhalf_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m256i u = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i)));
+        _mm256_storeu_ps(p_dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(u, 16)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) std::size_t
+convert_avx2(const float* p_src, int8_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 32 <= n; i += 32)
+    {
+        __m256i v[4];
+        for(int j = 0; j < 4; ++j)
+        {
+            // clamp first so NaN and out of range values saturate like the scalar tail
+            const __m256 x = _mm256_min_ps(
+                _mm256_max_ps(_mm256_loadu_ps(p_src + i + 8 * j), _mm256_set1_ps(-128.f)),
+                _mm256_set1_ps(127.f));
+            v[j] = _mm256_cvttps_epi32(x);
+        }
+        const __m256i w01 = _mm256_packs_epi32(v[0], v[1]);
+        const __m256i w23 = _mm256_packs_epi32(v[2], v[3]);
+        const __m256i b   = _mm256_packs_epi16(w01, w23);
+        const __m256i packed =
+            _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), packed);
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) std::size_t
+convert_avx2(const int8_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m256i u =
+            _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_src + i)));
+        _mm256_storeu_ps(p_dst + i, _mm256_cvtepi32_ps(u));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) __m512i float_to_bhalf_bits_avx512(__m512 v)
+{
+    const __m512i u        = _mm512_castps_si512(v);
+    const __m512i exponent = _mm512_set1_epi32(0x7f800000);
+
+    const __m512i lsb     = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1));
+    const __m512i rounded = _mm512_add_epi32(u, _mm512_add_epi32(_mm512_set1_epi32(0x7fff), lsb));
+
+    const __mmask16 is_inf_nan =
+        _mm512_cmpeq_epi32_mask(_mm512_and_si512(u, exponent), exponent);
+    const __mmask16 has_low_bits = _mm512_test_epi32_mask(u, _mm512_set1_epi32(0xffff));
+    const __m512i nan_fixed =
+        _mm512_mask_or_epi32(u, has_low_bits, u, _mm512_set1_epi32(0x10000));
+
+    return _mm512_srli_epi32(_mm512_mask_blend_epi32(is_inf_nan, rounded, nan_fixed), 16);
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const float* p_src, half_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(p_src + i),
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), h);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const half_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+        _mm512_storeu_ps(p_dst + i, _mm512_cvtph_ps(h));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const float* p_src, bhalf_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m512i u = float_to_bhalf_bits_avx512(_mm512_loadu_ps(p_src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), _mm512_cvtepi32_epi16(u));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const bhalf_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m512i u = _mm512_cvtepu16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i)));
+        _mm512_storeu_ps(p_dst + i, _mm512_castsi512_ps(_mm512_slli_epi32(u, 16)));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const float* p_src, int8_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m512 x = _mm512_min_ps(
+            _mm512_max_ps(_mm512_loadu_ps(p_src + i), _mm512_set1_ps(-128.f)),
+            _mm512_set1_ps(127.f));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i),
+                         _mm512_cvtsepi32_epi8(_mm512_cvttps_epi32(x)));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+convert_avx512(const int8_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m512i u =
+            _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i)));
+        _mm512_storeu_ps(p_dst + i, _mm512_cvtepi32_ps(u));
+    }
+    return i;
+}
+
+#endif // CK_BULK_TYPE_CONVERT_X86
+
+// run the widest enabled kernel on the bulk of the range and finish the tail with 'tail'
+template <typename Y, typename X, typename Tail>
+void convert_dispatch(const X* p_src, Y* p_dst, std::size_t n, HostSimd simd, Tail tail)
+{
+    std::size_t i = 0;
+
+#if CK_BULK_TYPE_CONVERT_X86
+    switch(ClampHostSimd(simd))
+    {
+    case HostSimd::Avx512: i = convert_avx512(p_src, p_dst, n); break;
+    case HostSimd::Avx2: i = convert_avx2(p_src, p_dst, n); break;
+    case HostSimd::None: break;
+    }
+#else
+    (void)simd;
+#endif
+
+    tail(p_src + i, p_dst + i, n - i);
+}
+
+} // namespace
+
+HostSimd GetHostSimd()
+{
+    static const HostSimd simd = [] {
+        HostSimd requested = HostSimd::Avx512;
+
+        if(const char* str = std::getenv("CK_HOST_SIMD"))
+        {
+            const std::string s = str;
+
+            if(s == "none")
+                requested = HostSimd::None;
+            else if(s == "avx2")
+                requested = HostSimd::Avx2;
+        }
+
+        return ClampHostSimd(requested);
+    }();
+
+    return simd;
+}
+
+const char* GetHostSimdString(HostSimd simd)
+{
+    switch(simd)
+    {
+    case HostSimd::None: return "none";
+    case HostSimd::Avx2: return "avx2";
+    case HostSimd::Avx512: return "avx512";
+    }
+    return "unknown";
+}
+
+namespace detail {
+
+void bulk_type_convert_chunk(const float* p_src, half_t* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, convert_scalar<half_t, float>);
+}
+
+void bulk_type_convert_chunk(const half_t* p_src, float* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, convert_scalar<float, half_t>);
+}
+
+void bulk_type_convert_chunk(const float* p_src, bhalf_t* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, convert_scalar<bhalf_t, float>);
+}
+
+void bulk_type_convert_chunk(const bhalf_t* p_src, float* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, convert_scalar<float, bhalf_t>);
+}
+
+void bulk_type_convert_chunk(const float* p_src, int8_t* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, [](const float* src, int8_t* dst, std::size_t m) {
+        std::transform(src, src + m, dst, float_to_int8_saturate);
+    });
+}
+
+void bulk_type_convert_chunk(const int8_t* p_src, float* p_dst, std::size_t n, HostSimd simd)
+{
+    convert_dispatch(p_src, p_dst, n, simd, convert_scalar<float, int8_t>);
+}
+
+void parallel_for_chunks(std::size_t n,
+                         std::size_t min_chunk,
+                         const std::function<void(std::size_t, std::size_t)>& f)
+{
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t num_threads =
+        std::min(max_threads, std::max(std::size_t{1}, n / std::max(std::size_t{1}, min_chunk)));
+
+    if(num_threads == 1)
+    {
+        f(0, n);
+        return;
+    }
+
+    // chunk boundaries are multiples of 64 elements so the SIMD kernels see no partial vectors
+    // except at the very end
+    const std::size_t chunk = ((n + num_threads - 1) / num_threads + 63) / 64 * 64;
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+
+    for(std::size_t begin = 0; begin < n; begin += chunk)
+    {
+        threads.emplace_back(f, begin, std::min(begin + chunk, n));
+    }
+
+    for(auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+} // namespace detail
+
+} // namespace utils
+} // namespace ck
@@ -2,12 +2,20 @@
 // Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
 
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/trace.hpp"
 
 #include "ck/library/utility/device_memory.hpp"
 
-DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
+DeviceMem::DeviceMem(std::size_t mem_size, ck::utils::DeviceMemoryAllocator& allocator)
+    : DeviceMem(mem_size, nullptr, allocator)
+{
+}
+
+DeviceMem::DeviceMem(std::size_t mem_size,
+                     hipStream_t stream,
+                     ck::utils::DeviceMemoryAllocator& allocator)
+    : mpDeviceBuf(allocator.Allocate(mem_size, stream)), mMemSize(mem_size), mpAllocator(&allocator)
 {
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
 }
 
 void* DeviceMem::GetDeviceBuffer() const { return mpDeviceBuf; }
@@ -16,14 +24,32 @@ std::size_t DeviceMem::GetBufferSize() const { return mMemSize; }
 
 void DeviceMem::ToDevice(const void* p) const
 {
+    CK_TRACE_ZONE(zone, "memory", "ToDevice");
+    zone.AddArg("bytes", mMemSize);
+
     hip_check_error(hipMemcpy(mpDeviceBuf, const_cast<void*>(p), mMemSize, hipMemcpyHostToDevice));
 }
 
 void DeviceMem::FromDevice(void* p) const
 {
+    CK_TRACE_ZONE(zone, "memory", "FromDevice");
+    zone.AddArg("bytes", mMemSize);
+
     hip_check_error(hipMemcpy(p, mpDeviceBuf, mMemSize, hipMemcpyDeviceToHost));
 }
 
+void DeviceMem::ToDevice(const void* p, ck::utils::TransferEngine& engine) const
+{
+    engine.ToDevice(mpDeviceBuf, p, mMemSize);
+}
+
+void DeviceMem::FromDevice(void* p,
+                           ck::utils::TransferEngine& engine,
+                           const ck::utils::TransferEngine::ChunkCallback& f_chunk) const
+{
+    engine.FromDevice(p, mpDeviceBuf, mMemSize, f_chunk);
+}
+
 void DeviceMem::SetZero() const { hip_check_error(hipMemset(mpDeviceBuf, 0, mMemSize)); }
 
-DeviceMem::~DeviceMem() { hip_check_error(hipFree(mpDeviceBuf)); }
+DeviceMem::~DeviceMem() { mpAllocator->Free(mpDeviceBuf); }
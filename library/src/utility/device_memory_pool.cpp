@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/trace.hpp"
+
+#include "ck/library/utility/device_memory_pool.hpp"
+#include "ck/library/utility/environment.hpp"
+
+namespace ck {
+namespace utils {
+
+void* HipMemoryAllocator::Allocate(std::size_t size, hipStream_t)
+{
+    void* p = nullptr;
+
+    if(size > 0)
+    {
+        hip_check_error(hipMalloc(&p, size));
+    }
+
+    return p;
+}
+
+void HipMemoryAllocator::Free(void* p)
+{
+    if(p != nullptr)
+    {
+        hip_check_error(hipFree(p));
+    }
+}
+
+void* HostMemoryAllocator::Allocate(std::size_t size, hipStream_t)
+{
+    return size == 0 ? nullptr : ::operator new(size, std::align_val_t{alignment});
+}
+
+void HostMemoryAllocator::Free(void* p) { ::operator delete(p, std::align_val_t{alignment}); }
+
+DeviceMemoryPool::DeviceMemoryPool(std::unique_ptr<DeviceMemoryAllocator> upstream,
+                                   std::size_t max_bytes_cached)
+    : upstream_{std::move(upstream)}, max_bytes_cached_{max_bytes_cached}
+{
+    if(upstream_ == nullptr)
+    {
+        throw std::runtime_error("wrong! device memory pool without upstream allocator");
+    }
+}
+
+DeviceMemoryPool::~DeviceMemoryPool() { TrimLocked(0); }
+
+std::size_t DeviceMemoryPool::GetSizeClass(std::size_t size)
+{
+    constexpr std::size_t min_size_class = 512;
+    constexpr std::size_t max_step       = std::size_t{2} << 20;
+
+    if(size <= min_size_class)
+    {
+        return min_size_class;
+    }
+
+    std::size_t power = min_size_class;
+
+    while(power <= size / 2)
+    {
+        power *= 2;
+    }
+
+    const std::size_t step = std::min(power / 4, max_step);
+
+    return (size + step - 1) / step * step;
+}
+
+void* DeviceMemoryPool::Allocate(std::size_t size, hipStream_t stream)
+{
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    const std::size_t size_class = GetSizeClass(size);
+
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    void* p = nullptr;
+
+    if(auto it = free_blocks_.find({size_class, stream}); it != free_blocks_.end())
+    {
+        p = it->second.back();
+
+        it->second.pop_back();
+
+        if(it->second.empty())
+        {
+            free_blocks_.erase(it);
+        }
+
+        stats_.bytes_cached_ -= size_class;
+        stats_.num_hits_ += 1;
+    }
+    else
+    {
+        try
+        {
+            p = upstream_->Allocate(size_class, stream);
+        }
+        catch(const std::exception&)
+        {
+            if(stats_.bytes_cached_ == 0)
+            {
+                throw;
+            }
+
+            TrimLocked(0);
+
+            p = upstream_->Allocate(size_class, stream);
+        }
+
+        stats_.num_upstream_allocations_ += 1;
+    }
+
+    blocks_.emplace(p, Block{size_class, size, stream});
+
+    stats_.num_allocations_ += 1;
+    stats_.bytes_requested_ += size;
+    stats_.bytes_in_use_ += size_class;
+
+    stats_.peak_bytes_in_use_   = std::max(stats_.peak_bytes_in_use_, stats_.bytes_in_use_);
+    stats_.peak_bytes_reserved_ = std::max(stats_.peak_bytes_reserved_, stats_.GetBytesReserved());
+
+    CK_TRACE_COUNTER("memory", "pool_bytes_in_use", stats_.bytes_in_use_);
+
+    return p;
+}
+
+void DeviceMemoryPool::Free(void* p)
+{
+    if(p == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    const auto it = blocks_.find(p);
+
+    if(it == blocks_.end())
+    {
+        throw std::runtime_error("wrong! freeing memory not allocated by the device memory pool");
+    }
+
+    const Block block = it->second;
+
+    blocks_.erase(it);
+
+    stats_.bytes_requested_ -= block.size_;
+    stats_.bytes_in_use_ -= block.size_class_;
+
+    // bytes_cached_ never exceeds max_bytes_cached_
+    if(block.size_class_ > max_bytes_cached_ - stats_.bytes_cached_)
+    {
+        FreeUpstream(p);
+    }
+    else
+    {
+        free_blocks_[{block.size_class_, block.stream_}].push_back(p);
+
+        stats_.bytes_cached_ += block.size_class_;
+    }
+
+    CK_TRACE_COUNTER("memory", "pool_bytes_in_use", stats_.bytes_in_use_);
+}
+
+void DeviceMemoryPool::Trim(std::size_t max_bytes_cached)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    TrimLocked(max_bytes_cached);
+}
+
+void DeviceMemoryPool::TrimLocked(std::size_t max_bytes_cached)
+{
+    while(stats_.bytes_cached_ > max_bytes_cached)
+    {
+        const auto it = std::prev(free_blocks_.end());
+
+        stats_.bytes_cached_ -= it->first.first;
+
+        FreeUpstream(it->second.back());
+
+        it->second.pop_back();
+
+        if(it->second.empty())
+        {
+            free_blocks_.erase(it);
+        }
+    }
+}
+
+void DeviceMemoryPool::FreeUpstream(void* p)
+{
+    upstream_->Free(p);
+
+    stats_.num_upstream_frees_ += 1;
+}
+
+DeviceMemoryPoolStats DeviceMemoryPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    return stats_;
+}
+
+DeviceMemoryAllocator& GetDefaultDeviceMemoryAllocator()
+{
+    static DeviceMemoryAllocator* allocator = []() -> DeviceMemoryAllocator* {
+        if(const char* str = std::getenv("CK_DEVICE_MEMORY_POOL"); str != nullptr && *str == '0')
+        {
+            return new HipMemoryAllocator;
+        }
+
+        std::size_t max_bytes_cached = DeviceMemoryPool::default_max_bytes_cached;
+
+        if(const char* str = std::getenv("CK_DEVICE_MEMORY_POOL_MAX_CACHED_MB");
+           str != nullptr && std::string_view{str} == "unlimited")
+        {
+            max_bytes_cached = DeviceMemoryPool::unlimited_bytes_cached;
+        }
+        else if(const auto max_mb_cached = GetEnvUnsigned("CK_DEVICE_MEMORY_POOL_MAX_CACHED_MB",
+                                                          max_bytes_cached >> 20))
+        {
+            max_bytes_cached =
+                std::min(*max_mb_cached, DeviceMemoryPool::unlimited_bytes_cached >> 20) << 20;
+        }
+
+        return new DeviceMemoryPool(std::make_unique<HipMemoryAllocator>(), max_bytes_cached);
+    }();
+
+    return *allocator;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/trace.hpp"
+
+#include "ck/library/utility/device_transfer.hpp"
+#include "ck/library/utility/environment.hpp"
+
+namespace ck {
+namespace utils {
+
+HipTransferBackend::HipTransferBackend()
+{
+    hip_check_error(hipStreamCreate(&stream_));
+
+    for(auto& event : events_)
+    {
+        hip_check_error(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+    }
+}
+
+HipTransferBackend::~HipTransferBackend()
+{
+    // nothing to report an error to
+    static_cast<void>(hipStreamSynchronize(stream_));
+
+    for(auto& event : events_)
+    {
+        static_cast<void>(hipEventDestroy(event));
+    }
+
+    static_cast<void>(hipStreamDestroy(stream_));
+}
+
+void* HipTransferBackend::AllocateStaging(std::size_t size)
+{
+    void* p = nullptr;
+
+    hip_check_error(hipHostMalloc(&p, size, hipHostMallocDefault));
+
+    return p;
+}
+
+void HipTransferBackend::FreeStaging(void* p) { hip_check_error(hipHostFree(p)); }
+
+void HipTransferBackend::CopyToDeviceAsync(void* p_dst, const void* p_src, std::size_t size)
+{
+    hip_check_error(hipMemcpyAsync(p_dst, p_src, size, hipMemcpyHostToDevice, stream_));
+}
+
+void HipTransferBackend::CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size)
+{
+    hip_check_error(hipMemcpyAsync(p_dst, p_src, size, hipMemcpyDeviceToHost, stream_));
+}
+
+void HipTransferBackend::Signal(std::size_t fence)
+{
+    hip_check_error(hipEventRecord(events_.at(fence), stream_));
+}
+
+void HipTransferBackend::Wait(std::size_t fence)
+{
+    hip_check_error(hipEventSynchronize(events_.at(fence)));
+}
+
+void* HostTransferBackend::AllocateStaging(std::size_t size) { return ::operator new(size); }
+
+void HostTransferBackend::FreeStaging(void* p) { ::operator delete(p); }
+
+void HostTransferBackend::CopyToDeviceAsync(void* p_dst, const void* p_src, std::size_t size)
+{
+    pending_copies_.push_back({p_dst, p_src, size});
+}
+
+void HostTransferBackend::CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size)
+{
+    pending_copies_.push_back({p_dst, p_src, size});
+}
+
+void HostTransferBackend::Signal(std::size_t fence)
+{
+    fence_marks_.at(fence) = num_copies_run_ + pending_copies_.size();
+}
+
+void HostTransferBackend::Wait(std::size_t fence)
+{
+    const std::size_t mark = fence_marks_.at(fence);
+
+    std::size_t i = 0;
+
+    for(; num_copies_run_ + i < mark; ++i)
+    {
+        const Copy& copy = pending_copies_[i];
+
+        std::memcpy(copy.p_dst_, copy.p_src_, copy.size_);
+    }
+
+    pending_copies_.erase(pending_copies_.begin(), pending_copies_.begin() + i);
+
+    num_copies_run_ += i;
+}
+
+TransferEngine::TransferEngine(std::unique_ptr<TransferBackend> backend, std::size_t chunk_size)
+    : backend_{std::move(backend)}, chunk_size_{chunk_size}
+{
+    if(backend_ == nullptr)
+    {
+        throw std::runtime_error("wrong! transfer engine without backend");
+    }
+
+    if(chunk_size_ == 0)
+    {
+        throw std::runtime_error("wrong! transfer chunk size of 0");
+    }
+}
+
+TransferEngine::~TransferEngine()
+{
+    Synchronize();
+
+    for(void* p : staging_buffers_)
+    {
+        if(p != nullptr)
+        {
+            backend_->FreeStaging(p);
+        }
+    }
+}
+
+void TransferEngine::ToDevice(void* p_dst, const void* p_src, std::size_t size)
+{
+    CK_TRACE_ZONE(zone, "memory", "ChunkedToDevice");
+    zone.AddArg("bytes", size);
+    zone.AddArg("chunk_size", chunk_size_);
+
+    if(size == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    AllocateStaging();
+
+    try
+    {
+        for(std::size_t offset = 0, i = 0; offset < size; offset += chunk_size_, ++i)
+        {
+            const std::size_t fence = i % TransferBackend::num_fences;
+            const std::size_t n     = std::min(chunk_size_, size - offset);
+
+            // the staging buffer is free once the chunk before the previous is on the device
+            backend_->Wait(fence);
+
+            std::memcpy(staging_buffers_[fence], static_cast<const char*>(p_src) + offset, n);
+
+            backend_->CopyToDeviceAsync(
+                static_cast<char*>(p_dst) + offset, staging_buffers_[fence], n);
+            backend_->Signal(fence);
+        }
+    }
+    catch(...)
+    {
+        Synchronize();
+
+        throw;
+    }
+
+    Synchronize();
+}
+
+void TransferEngine::FromDevice(void* p_dst,
+                                const void* p_src,
+                                std::size_t size,
+                                const ChunkCallback& f_chunk)
+{
+    CK_TRACE_ZONE(zone, "memory", "ChunkedFromDevice");
+    zone.AddArg("bytes", size);
+    zone.AddArg("chunk_size", chunk_size_);
+
+    if(size == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    AllocateStaging();
+
+    const std::size_t num_chunks = (size + chunk_size_ - 1) / chunk_size_;
+
+    auto f_issue = [&](std::size_t i) {
+        const std::size_t fence  = i % TransferBackend::num_fences;
+        const std::size_t offset = i * chunk_size_;
+
+        backend_->CopyFromDeviceAsync(staging_buffers_[fence],
+                                      static_cast<const char*>(p_src) + offset,
+                                      std::min(chunk_size_, size - offset));
+        backend_->Signal(fence);
+    };
+
+    try
+    {
+        f_issue(0);
+
+        for(std::size_t i = 0; i < num_chunks; ++i)
+        {
+            // into the other staging buffer, which the host is done with
+            if(i + 1 < num_chunks)
+            {
+                f_issue(i + 1);
+            }
+
+            const std::size_t fence  = i % TransferBackend::num_fences;
+            const std::size_t offset = i * chunk_size_;
+            const std::size_t n      = std::min(chunk_size_, size - offset);
+
+            backend_->Wait(fence);
+
+            std::memcpy(static_cast<char*>(p_dst) + offset, staging_buffers_[fence], n);
+
+            if(f_chunk)
+            {
+                f_chunk(offset, n);
+            }
+        }
+    }
+    catch(...)
+    {
+        Synchronize();
+
+        throw;
+    }
+}
+
+void TransferEngine::AllocateStaging()
+{
+    for(void*& p : staging_buffers_)
+    {
+        if(p == nullptr)
+        {
+            p = backend_->AllocateStaging(chunk_size_);
+        }
+    }
+}
+
+void TransferEngine::Synchronize()
+{
+    for(std::size_t fence = 0; fence < TransferBackend::num_fences; ++fence)
+    {
+        backend_->Wait(fence);
+    }
+}
+
+TransferEngine& GetDefaultTransferEngine()
+{
+    static TransferEngine* engine = []() -> TransferEngine* {
+        std::size_t chunk_size = TransferEngine::default_chunk_size;
+
+        // 0, for which the engine throws, is ignored as a malformed size is
+        if(const auto chunk_mb = GetEnvUnsigned("CK_TRANSFER_CHUNK_MB", chunk_size >> 20);
+           chunk_mb.has_value() && *chunk_mb > 0)
+        {
+            chunk_size = std::min(*chunk_mb, std::numeric_limits<std::size_t>::max() >> 20) << 20;
+        }
+
+        return new TransferEngine(std::make_unique<HipTransferBackend>(), chunk_size);
+    }();
+
+    return *engine;
+}
+
+} // namespace utils
+} // namespace ck
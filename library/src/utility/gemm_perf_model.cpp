@@ -0,0 +1,665 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ck/library/utility/gemm_perf_model.hpp"
+
+namespace ck {
+namespace utils {
+
+using tensor_operation::device::DeviceOperationTile;
+using tensor_operation::device::GemmSpecialization;
+
+namespace {
+
+constexpr std::size_t num_coefficients = 4;
+
+// accesses narrower than this many bytes cost as much as one of this width
+constexpr std::size_t min_efficient_access_bytes = 4;
+
+bool pads_m(GemmSpecialization s)
+{
+    return s == GemmSpecialization::MPadding || s == GemmSpecialization::MNPadding ||
+           s == GemmSpecialization::MKPadding || s == GemmSpecialization::MNKPadding ||
+           s == GemmSpecialization::MOPadding || s == GemmSpecialization::MNOPadding ||
+           s == GemmSpecialization::MKOPadding || s == GemmSpecialization::MNKOPadding;
+}
+
+bool pads_n(GemmSpecialization s)
+{
+    return s == GemmSpecialization::NPadding || s == GemmSpecialization::MNPadding ||
+           s == GemmSpecialization::NKPadding || s == GemmSpecialization::MNKPadding ||
+           s == GemmSpecialization::NOPadding || s == GemmSpecialization::MNOPadding ||
+           s == GemmSpecialization::NKOPadding || s == GemmSpecialization::MNKOPadding;
+}
+
+bool pads_k(GemmSpecialization s)
+{
+    return s == GemmSpecialization::KPadding || s == GemmSpecialization::MKPadding ||
+           s == GemmSpecialization::NKPadding || s == GemmSpecialization::MNKPadding ||
+           s == GemmSpecialization::KOPadding || s == GemmSpecialization::MKOPadding ||
+           s == GemmSpecialization::NKOPadding || s == GemmSpecialization::MNKOPadding;
+}
+
+std::size_t integer_divide_ceil(std::size_t x, std::size_t y) { return (x + y - 1) / y; }
+
+// bytes moved per element, for accesses of the given width
+double effective_element_bytes(std::size_t element_bytes, index_t scalar_per_vector)
+{
+    if(scalar_per_vector <= 0)
+    {
+        return element_bytes;
+    }
+
+    const std::size_t access_bytes = element_bytes * scalar_per_vector;
+
+    return access_bytes >= min_efficient_access_bytes
+               ? element_bytes
+               : static_cast<double>(min_efficient_access_bytes) / scalar_per_vector;
+}
+
+std::array<double, num_coefficients> get_terms(const GemmPerfFeatures& features)
+{
+    return {features.compute_, features.latency_, features.memory_, 1.};
+}
+
+// solves the n x n system a x = b in place, false if it is (numerically) singular
+bool solve(std::vector<std::vector<double>>& a, std::vector<double>& b)
+{
+    const std::size_t n = b.size();
+
+    double max_diagonal = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        max_diagonal = std::max(max_diagonal, std::abs(a[i][i]));
+    }
+
+    for(std::size_t col = 0; col < n; ++col)
+    {
+        std::size_t pivot = col;
+        for(std::size_t row = col + 1; row < n; ++row)
+        {
+            if(std::abs(a[row][col]) > std::abs(a[pivot][col]))
+            {
+                pivot = row;
+            }
+        }
+
+        if(std::abs(a[pivot][col]) <= 1e-12 * max_diagonal)
+        {
+            return false;
+        }
+
+        std::swap(a[col], a[pivot]);
+        std::swap(b[col], b[pivot]);
+
+        for(std::size_t row = col + 1; row < n; ++row)
+        {
+            const double factor = a[row][col] / a[col][col];
+
+            for(std::size_t k = col; k < n; ++k)
+            {
+                a[row][k] -= factor * a[col][k];
+            }
+
+            b[row] -= factor * b[col];
+        }
+    }
+
+    for(std::size_t col = n; col-- > 0;)
+    {
+        for(std::size_t k = col + 1; k < n; ++k)
+        {
+            b[col] -= a[col][k] * b[k];
+        }
+
+        b[col] /= a[col][col];
+    }
+
+    return true;
+}
+
+std::string to_string(GemmSpecialization s)
+{
+    return tensor_operation::device::getGemmSpecializationString(s);
+}
+
+GemmSpecialization parse_gemm_specialization(const std::string& str)
+{
+    for(int s = static_cast<int>(GemmSpecialization::Default);
+        s <= static_cast<int>(GemmSpecialization::MNKOPadding);
+        ++s)
+    {
+        if(to_string(static_cast<GemmSpecialization>(s)) == str)
+        {
+            return static_cast<GemmSpecialization>(s);
+        }
+    }
+
+    throw std::runtime_error("wrong! unknown GemmSpecialization " + str);
+}
+
+constexpr const char* csv_header =
+    "M,N,K,batch_count,a_element_bytes,b_element_bytes,c_element_bytes,a_layout,b_layout,"
+    "c_layout,num_cu,max_threads_per_cu,lds_bytes_per_cu,block_size,m_per_block,n_per_block,"
+    "k_per_block,gemm_spec,lds_bytes,a_scalar_per_vector,b_scalar_per_vector,"
+    "c_scalar_per_vector,pipeline_version,num_prefetch_stages,m01,instance_id,ave_time_ms";
+
+constexpr std::size_t num_csv_fields = 27;
+
+void write_record(std::ostream& os, const GemmPerfRecord& r)
+{
+    const auto& p = r.problem_;
+    const auto& d = r.device_;
+    const auto& t = r.tile_;
+
+    os << p.M_ << ',' << p.N_ << ',' << p.K_ << ',' << p.batch_count_ << ',' << p.a_element_bytes_
+       << ',' << p.b_element_bytes_ << ',' << p.c_element_bytes_ << ',' << p.a_layout_ << ','
+       << p.b_layout_ << ',' << p.c_layout_ << ',' << d.num_cu_ << ',' << d.max_threads_per_cu_
+       << ',' << d.lds_bytes_per_cu_ << ',' << t.block_size_ << ',' << t.m_per_block_ << ','
+       << t.n_per_block_ << ',' << t.k_per_block_ << ',' << to_string(t.gemm_spec_) << ','
+       << t.lds_bytes_ << ',' << t.a_scalar_per_vector_ << ',' << t.b_scalar_per_vector_ << ','
+       << t.c_scalar_per_vector_ << ',' << t.pipeline_version_ << ',' << t.num_prefetch_stages_
+       << ',' << t.m01_ << ',' << r.instance_id_ << ','
+       << std::setprecision(std::numeric_limits<double>::max_digits10) << r.ave_time_ms_ << '\n';
+}
+
+GemmPerfRecord parse_record(const std::string& line)
+{
+    std::vector<std::string> fields;
+
+    std::istringstream is(line);
+    for(std::string field; std::getline(is, field, ',');)
+    {
+        fields.push_back(field);
+    }
+
+    if(fields.size() != num_csv_fields)
+    {
+        throw std::runtime_error("wrong! GEMM perf record should have " +
+                                 std::to_string(num_csv_fields) + " fields: " + line);
+    }
+
+    std::size_t i = 0;
+
+    auto f_size  = [&]() -> std::size_t { return std::stoull(fields[i++]); };
+    auto f_index = [&]() -> index_t { return std::stoi(fields[i++]); };
+
+    GemmPerfRecord r;
+
+    r.problem_.M_               = f_size();
+    r.problem_.N_               = f_size();
+    r.problem_.K_               = f_size();
+    r.problem_.batch_count_     = f_size();
+    r.problem_.a_element_bytes_ = f_size();
+    r.problem_.b_element_bytes_ = f_size();
+    r.problem_.c_element_bytes_ = f_size();
+    r.problem_.a_layout_        = fields[i++];
+    r.problem_.b_layout_        = fields[i++];
+    r.problem_.c_layout_        = fields[i++];
+
+    r.device_.num_cu_             = f_size();
+    r.device_.max_threads_per_cu_ = f_size();
+    r.device_.lds_bytes_per_cu_   = f_size();
+
+    r.tile_.block_size_          = f_index();
+    r.tile_.m_per_block_         = f_index();
+    r.tile_.n_per_block_         = f_index();
+    r.tile_.k_per_block_         = f_index();
+    r.tile_.gemm_spec_           = parse_gemm_specialization(fields[i++]);
+    r.tile_.lds_bytes_           = f_index();
+    r.tile_.a_scalar_per_vector_ = f_index();
+    r.tile_.b_scalar_per_vector_ = f_index();
+    r.tile_.c_scalar_per_vector_ = f_index();
+    r.tile_.pipeline_version_    = f_index();
+    r.tile_.num_prefetch_stages_ = f_index();
+    r.tile_.m01_                 = f_index();
+
+    r.instance_id_ = f_size();
+    r.ave_time_ms_ = std::stod(fields[i++]);
+
+    return r;
+}
+
+} // namespace
+
+GemmPerfFeatures GemmPerfModel::GetFeatures(const GemmPerfProblem& problem,
+                                            const DeviceOperationTile& tile,
+                                            const GemmPerfDevice& device)
+{
+    GemmPerfFeatures features;
+
+    if(tile.block_size_ <= 0 || tile.m_per_block_ <= 0 || tile.n_per_block_ <= 0 ||
+       tile.k_per_block_ <= 0)
+    {
+        return features;
+    }
+
+    const std::size_t m_per_block = tile.m_per_block_;
+    const std::size_t n_per_block = tile.n_per_block_;
+    const std::size_t k_per_block = tile.k_per_block_;
+
+    bool supported = true;
+
+    auto f_pad = [&](std::size_t length, std::size_t per_block, bool pad) {
+        if(length % per_block != 0 && !pad)
+        {
+            supported = false;
+        }
+
+        return integer_divide_ceil(length, per_block) * per_block;
+    };
+
+    const std::size_t M = f_pad(problem.M_, m_per_block, pads_m(tile.gemm_spec_));
+    const std::size_t N = f_pad(problem.N_, n_per_block, pads_n(tile.gemm_spec_));
+    const std::size_t K = f_pad(problem.K_, k_per_block, pads_k(tile.gemm_spec_));
+
+    // resident blocks per CU
+    std::size_t blocks_per_cu = device.max_threads_per_cu_ / tile.block_size_;
+
+    if(tile.lds_bytes_ > 0)
+    {
+        blocks_per_cu = std::min<std::size_t>(blocks_per_cu,
+                                              device.lds_bytes_per_cu_ / tile.lds_bytes_);
+    }
+
+    if(!supported || blocks_per_cu == 0 || device.num_cu_ == 0)
+    {
+        return features;
+    }
+
+    const std::size_t grid_size =
+        problem.batch_count_ * (M / m_per_block) * (N / n_per_block);
+
+    const std::size_t concurrent_blocks = device.num_cu_ * blocks_per_cu;
+    const std::size_t waves             = integer_divide_ceil(grid_size, concurrent_blocks);
+
+    const double useful = static_cast<double>(problem.M_) * problem.N_ * problem.K_;
+    const double padded = static_cast<double>(M) * N * K;
+
+    features.supported_     = true;
+    features.grid_size_     = grid_size;
+    features.blocks_per_cu_ = blocks_per_cu;
+    features.waves_         = waves;
+
+    features.wave_efficiency_ =
+        waves > 0 ? static_cast<double>(grid_size) / (waves * concurrent_blocks) : 1.;
+    features.padding_efficiency_ = padded > 0 ? useful / padded : 1.;
+
+    features.compute_ = static_cast<double>(waves) * blocks_per_cu * 2. * m_per_block *
+                        n_per_block * K;
+    // the pipeline overlaps the loads of the K blocks it prefetches with the compute of the
+    // current one
+    const std::size_t num_prefetch_stages = std::max<index_t>(tile.num_prefetch_stages_, 1);
+
+    features.latency_ =
+        static_cast<double>(waves) * (K / k_per_block) / static_cast<double>(num_prefetch_stages);
+
+    // rows and columns of C tiles of one batch covered by the blocks resident at the same time,
+    // which launch in the order of the block to C tile map: M01 rows at a time, column by column
+    const std::size_t m_blocks = M / m_per_block;
+    const std::size_t n_blocks = N / n_per_block;
+    const std::size_t m01 = std::min<std::size_t>(std::max<index_t>(tile.m01_, 1), m_blocks);
+
+    const std::size_t resident_blocks = std::min(concurrent_blocks, m_blocks * n_blocks);
+
+    std::size_t resident_rows    = 0;
+    std::size_t resident_columns = 0;
+
+    if(resident_blocks <= m01 * n_blocks)
+    {
+        resident_rows    = std::min(resident_blocks, m01);
+        resident_columns = integer_divide_ceil(resident_blocks, m01);
+    }
+    else
+    {
+        resident_rows =
+            std::min(m_blocks, integer_divide_ceil(resident_blocks, m01 * n_blocks) * m01);
+        resident_columns = n_blocks;
+    }
+
+    // A and B panels loaded from global memory
+    const double a_panels =
+        static_cast<double>(grid_size) * resident_rows / static_cast<double>(resident_blocks);
+    const double b_panels =
+        static_cast<double>(grid_size) * resident_columns / static_cast<double>(resident_blocks);
+
+    const double a_bytes =
+        effective_element_bytes(problem.a_element_bytes_, tile.a_scalar_per_vector_);
+    const double b_bytes =
+        effective_element_bytes(problem.b_element_bytes_, tile.b_scalar_per_vector_);
+    const double c_bytes =
+        effective_element_bytes(problem.c_element_bytes_, tile.c_scalar_per_vector_);
+
+    features.memory_ = static_cast<double>(K) *
+                           (a_panels * m_per_block * a_bytes + b_panels * n_per_block * b_bytes) +
+                       static_cast<double>(problem.batch_count_) * problem.M_ * problem.N_ *
+                           c_bytes;
+
+    return features;
+}
+
+double GemmPerfModel::Estimate(const GemmPerfFeatures& features) const
+{
+    if(!features.supported_)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const std::array<double, num_coefficients> coefficients = {
+        compute_ms_, latency_ms_, memory_ms_, launch_ms_};
+
+    const auto terms = get_terms(features);
+
+    return std::inner_product(terms.begin(), terms.end(), coefficients.begin(), 0.);
+}
+
+std::vector<std::size_t> GemmPerfModel::Rank(const GemmPerfProblem& problem,
+                                             const std::vector<DeviceOperationTile>& tiles,
+                                             const GemmPerfDevice& device) const
+{
+    std::vector<double> estimates(tiles.size());
+    std::vector<std::size_t> ranking;
+
+    for(std::size_t i = 0; i < tiles.size(); ++i)
+    {
+        estimates[i] = Estimate(problem, tiles[i], device);
+
+        if(std::isfinite(estimates[i]))
+        {
+            ranking.push_back(i);
+        }
+    }
+
+    std::stable_sort(ranking.begin(), ranking.end(), [&](std::size_t a, std::size_t b) {
+        return estimates[a] < estimates[b];
+    });
+
+    return ranking;
+}
+
+GemmPerfModel GemmPerfModel::Calibrate(const std::vector<GemmPerfRecord>& records)
+{
+    // rows of the relative error: terms / time . coefficients = 1
+    std::vector<std::array<double, num_coefficients>> rows;
+
+    for(const auto& record : records)
+    {
+        const auto features = GetFeatures(record.problem_, record.tile_, record.device_);
+
+        if(!features.supported_ || !(record.ave_time_ms_ > 0))
+        {
+            continue;
+        }
+
+        auto row = get_terms(features);
+
+        for(auto& x : row)
+        {
+            x /= record.ave_time_ms_;
+        }
+
+        rows.push_back(row);
+    }
+
+    if(rows.empty())
+    {
+        throw std::runtime_error("wrong! no record to calibrate the GEMM perf model with");
+    }
+
+    // columns scaled to unit RMS, the terms differ by many orders of magnitude
+    std::array<double, num_coefficients> scale{};
+
+    for(const auto& row : rows)
+    {
+        for(std::size_t j = 0; j < num_coefficients; ++j)
+        {
+            scale[j] += row[j] * row[j];
+        }
+    }
+
+    std::vector<std::size_t> free;
+
+    for(std::size_t j = 0; j < num_coefficients; ++j)
+    {
+        scale[j] = std::sqrt(scale[j] / rows.size());
+
+        if(scale[j] > 0)
+        {
+            free.push_back(j);
+        }
+    }
+
+    // least squares over the free coefficients; a coefficient that comes out negative, or that
+    // the records cannot tell apart from the others, is fixed at zero
+    std::array<double, num_coefficients> coefficients{};
+
+    while(!free.empty())
+    {
+        const std::size_t n = free.size();
+
+        std::vector<std::vector<double>> ata(n, std::vector<double>(n, 0));
+        std::vector<double> atb(n, 0);
+
+        for(const auto& row : rows)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                const double xi = row[free[i]] / scale[free[i]];
+
+                for(std::size_t k = 0; k < n; ++k)
+                {
+                    ata[i][k] += xi * row[free[k]] / scale[free[k]];
+                }
+
+                atb[i] += xi;
+            }
+        }
+
+        std::vector<std::vector<double>> ata_copy = ata;
+
+        if(!solve(ata_copy, atb))
+        {
+            // drop the column closest to a combination of the others, i.e. the smallest diagonal
+            std::size_t weakest = 0;
+            for(std::size_t i = 1; i < n; ++i)
+            {
+                if(ata[i][i] < ata[weakest][weakest])
+                {
+                    weakest = i;
+                }
+            }
+
+            free.erase(free.begin() + weakest);
+            continue;
+        }
+
+        const auto most_negative = std::min_element(atb.begin(), atb.end()) - atb.begin();
+
+        if(atb[most_negative] < 0)
+        {
+            free.erase(free.begin() + most_negative);
+            continue;
+        }
+
+        coefficients = {};
+
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            coefficients[free[i]] = atb[i] / scale[free[i]];
+        }
+
+        break;
+    }
+
+    GemmPerfModel model;
+
+    model.compute_ms_ = coefficients[0];
+    model.latency_ms_ = coefficients[1];
+    model.memory_ms_  = coefficients[2];
+    model.launch_ms_  = coefficients[3];
+
+    return model;
+}
+
+GemmPerfRankingStats EvaluateRanking(const GemmPerfModel& model,
+                                     const std::vector<GemmPerfRecord>& records)
+{
+    using Key = std::tuple<std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::size_t,
+                           std::string,
+                           std::string,
+                           std::string>;
+
+    std::map<Key, std::vector<const GemmPerfRecord*>> problems;
+
+    for(const auto& r : records)
+    {
+        const auto& p = r.problem_;
+        const auto& d = r.device_;
+
+        problems[Key{p.M_,
+                     p.N_,
+                     p.K_,
+                     p.batch_count_,
+                     p.a_element_bytes_,
+                     p.b_element_bytes_,
+                     p.c_element_bytes_,
+                     d.num_cu_,
+                     d.max_threads_per_cu_,
+                     d.lds_bytes_per_cu_,
+                     p.a_layout_,
+                     p.b_layout_,
+                     p.c_layout_}]
+            .push_back(&r);
+    }
+
+    GemmPerfRankingStats stats;
+
+    for(const auto& [key, candidates] : problems)
+    {
+        const GemmPerfRecord* fastest = nullptr;
+        const GemmPerfRecord* picked  = nullptr;
+
+        double picked_estimate = std::numeric_limits<double>::infinity();
+
+        for(const auto* r : candidates)
+        {
+            if(fastest == nullptr || r->ave_time_ms_ < fastest->ave_time_ms_)
+            {
+                fastest = r;
+            }
+
+            const double estimate = model.Estimate(r->problem_, r->tile_, r->device_);
+
+            if(estimate < picked_estimate)
+            {
+                picked          = r;
+                picked_estimate = estimate;
+            }
+        }
+
+        if(picked == nullptr || !(fastest->ave_time_ms_ > 0))
+        {
+            continue;
+        }
+
+        const double slowdown = picked->ave_time_ms_ / fastest->ave_time_ms_;
+
+        stats.num_problems_ += 1;
+        stats.num_best_picked_ += picked->ave_time_ms_ == fastest->ave_time_ms_;
+        stats.mean_slowdown_ += slowdown;
+        stats.max_slowdown_ = std::max(stats.max_slowdown_, slowdown);
+    }
+
+    if(stats.num_problems_ > 0)
+    {
+        stats.mean_slowdown_ /= stats.num_problems_;
+    }
+
+    return stats;
+}
+
+void SaveGemmPerfRecords(const std::string& path, const std::vector<GemmPerfRecord>& records)
+{
+    std::ofstream os(path);
+
+    if(!os)
+    {
+        throw std::runtime_error("wrong! cannot write " + path);
+    }
+
+    os << csv_header << '\n';
+
+    for(const auto& record : records)
+    {
+        write_record(os, record);
+    }
+}
+
+void AppendGemmPerfRecord(const std::string& path, const GemmPerfRecord& record)
+{
+    const bool exists = std::ifstream(path).good();
+
+    std::ofstream os(path, std::ios::app);
+
+    if(!os)
+    {
+        throw std::runtime_error("wrong! cannot write " + path);
+    }
+
+    if(!exists)
+    {
+        os << csv_header << '\n';
+    }
+
+    write_record(os, record);
+}
+
+std::vector<GemmPerfRecord> LoadGemmPerfRecords(const std::string& path)
+{
+    std::ifstream is(path);
+
+    if(!is)
+    {
+        throw std::runtime_error("wrong! cannot read " + path);
+    }
+
+    std::vector<GemmPerfRecord> records;
+
+    for(std::string line; std::getline(is, line);)
+    {
+        if(line.empty() || line == csv_header)
+        {
+            continue;
+        }
+
+        records.push_back(parse_record(line));
+    }
+
+    return records;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ck/library/utility/host_gemm_int8.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_HOST_GEMM_INT8_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define CK_HOST_GEMM_INT8_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+bool IsSupported(HostInt8Dot dot)
+{
+#if CK_HOST_GEMM_INT8_X86
+    __builtin_cpu_init();
+
+    switch(dot)
+    {
+    case HostInt8Dot::Scalar: return true;
+    case HostInt8Dot::Avx2: return __builtin_cpu_supports("avx2");
+    case HostInt8Dot::AvxVnni: {
+        // CPUID.(EAX=7, ECX=1):EAX[4], not known to every compiler's __builtin_cpu_supports
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __builtin_cpu_supports("avx2") && __get_cpuid_count(7, 1, &eax, &ebx, &ecx, &edx) &&
+               (eax & (1u << 4)) != 0;
+    }
+    case HostInt8Dot::Avx512Bw:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+    case HostInt8Dot::Avx512Vnni:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+               __builtin_cpu_supports("avx512vnni");
+    }
+    return false;
+#else
+    return dot == HostInt8Dot::Scalar;
+#endif
+}
+
+HostInt8Dot ClampHostInt8Dot(HostInt8Dot dot)
+{
+    while(dot != HostInt8Dot::Scalar && !IsSupported(dot))
+    {
+        dot = static_cast<HostInt8Dot>(static_cast<int>(dot) - 1);
+    }
+    return dot;
+}
+
+// wrapping int32 arithmetic, so results are exact modulo 2^32 like on the device
+int32_t wrap_add(int32_t a, int32_t b)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+}
+
+// the VNNI kernels compute sum_k (a + 128) * b
+int32_t remove_a_offset(int32_t sum, int32_t b_sum)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(sum) - 128u * static_cast<uint32_t>(b_sum));
+}
+
+void gemm_scalar(const int8_t* p_a,
+                 std::size_t lda,
+                 const int8_t* p_b,
+                 std::size_t ldb,
+                 int32_t* p_c,
+                 std::size_t ldc,
+                 std::size_t M,
+                 std::size_t N,
+                 std::size_t K)
+{
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int32_t acc = 0;
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                acc = wrap_add(acc, int32_t{p_a[m * lda + k]} * int32_t{p_b[n * ldb + k]});
+            }
+            p_c[m * ldc + n] = acc;
+        }
+    }
+}
+
+#if CK_HOST_GEMM_INT8_X86
+
+// Every kernel computes one row of A against NCols rows of B at a time, so each A vector is
+// loaded (and, for the non-VNNI kernels, sign-extended) once per NCols dot products
+
+__attribute__((target("avx2"))) int32_t hsum_avx2(__m256i v)
+{
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+}
+
+template <std::size_t NCols>
+__attribute__((target("avx2"))) void
+dot_avx2(const int8_t* p_a, const int8_t* p_b, std::size_t ldb, int32_t* p_c, std::size_t K)
+{
+    __m256i acc[NCols];
+    for(std::size_t j = 0; j < NCols; ++j)
+        acc[j] = _mm256_setzero_si256();
+
+    for(std::size_t k = 0; k < K; k += 32)
+    {
+        const __m256i a    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_a + k));
+        const __m256i a_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(a));
+        const __m256i a_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(a, 1));
+
+        for(std::size_t j = 0; j < NCols; ++j)
+        {
+            const __m256i b =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_b + j * ldb + k));
+            const __m256i b_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(b));
+            const __m256i b_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b, 1));
+
+            acc[j] = _mm256_add_epi32(acc[j], _mm256_madd_epi16(a_lo, b_lo));
+            acc[j] = _mm256_add_epi32(acc[j], _mm256_madd_epi16(a_hi, b_hi));
+        }
+    }
+
+    for(std::size_t j = 0; j < NCols; ++j)
+        p_c[j] = hsum_avx2(acc[j]);
+}
+
+template <std::size_t NCols>
+__attribute__((target("avx2,avxvnni"))) void dot_avx_vnni(const int8_t* p_a,
+                                                           const int8_t* p_b,
+                                                           std::size_t ldb,
+                                                           const int32_t* p_b_sum,
+                                                           int32_t* p_c,
+                                                           std::size_t K)
+{
+    const __m256i offset = _mm256_set1_epi8(static_cast<char>(0x80));
+
+    __m256i acc[NCols];
+    for(std::size_t j = 0; j < NCols; ++j)
+        acc[j] = _mm256_setzero_si256();
+
+    for(std::size_t k = 0; k < K; k += 32)
+    {
+        // a + 128 as unsigned bytes
+        const __m256i a = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_a + k)), offset);
+
+        for(std::size_t j = 0; j < NCols; ++j)
+        {
+            const __m256i b =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_b + j * ldb + k));
+
+            acc[j] = _mm256_dpbusd_avx_epi32(acc[j], a, b);
+        }
+    }
+
+    for(std::size_t j = 0; j < NCols; ++j)
+        p_c[j] = remove_a_offset(hsum_avx2(acc[j]), p_b_sum[j]);
+}
+
+template <std::size_t NCols>
+__attribute__((target("avx512f,avx512bw"))) void
+dot_avx512_bw(const int8_t* p_a, const int8_t* p_b, std::size_t ldb, int32_t* p_c, std::size_t K)
+{
+    __m512i acc[NCols];
+    for(std::size_t j = 0; j < NCols; ++j)
+        acc[j] = _mm512_setzero_si512();
+
+    for(std::size_t k = 0; k < K; k += 64)
+    {
+        const __m512i a    = _mm512_loadu_si512(p_a + k);
+        const __m512i a_lo = _mm512_cvtepi8_epi16(_mm512_castsi512_si256(a));
+        const __m512i a_hi = _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(a, 1));
+
+        for(std::size_t j = 0; j < NCols; ++j)
+        {
+            const __m512i b    = _mm512_loadu_si512(p_b + j * ldb + k);
+            const __m512i b_lo = _mm512_cvtepi8_epi16(_mm512_castsi512_si256(b));
+            const __m512i b_hi = _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(b, 1));
+
+            acc[j] = _mm512_add_epi32(acc[j], _mm512_madd_epi16(a_lo, b_lo));
+            acc[j] = _mm512_add_epi32(acc[j], _mm512_madd_epi16(a_hi, b_hi));
+        }
+    }
+
+    for(std::size_t j = 0; j < NCols; ++j)
+        p_c[j] = _mm512_reduce_add_epi32(acc[j]);
+}
+
+template <std::size_t NCols>
+__attribute__((target("avx512f,avx512bw,avx512vnni"))) void dot_avx512_vnni(const int8_t* p_a,
+                                                                             const int8_t* p_b,
+                                                                             std::size_t ldb,
+                                                                             const int32_t* p_b_sum,
+                                                                             int32_t* p_c,
+                                                                             std::size_t K)
+{
+    const __m512i offset = _mm512_set1_epi8(static_cast<char>(0x80));
+
+    __m512i acc[NCols];
+    for(std::size_t j = 0; j < NCols; ++j)
+        acc[j] = _mm512_setzero_si512();
+
+    for(std::size_t k = 0; k < K; k += 64)
+    {
+        // a + 128 as unsigned bytes
+        const __m512i a = _mm512_xor_si512(_mm512_loadu_si512(p_a + k), offset);
+
+        for(std::size_t j = 0; j < NCols; ++j)
+        {
+            const __m512i b = _mm512_loadu_si512(p_b + j * ldb + k);
+
+            acc[j] = _mm512_dpbusd_epi32(acc[j], a, b);
+        }
+    }
+
+    for(std::size_t j = 0; j < NCols; ++j)
+        p_c[j] = remove_a_offset(_mm512_reduce_add_epi32(acc[j]), p_b_sum[j]);
+}
+
+// run dot(p_a_row, p_b_cols, ldb, p_b_sum, p_c_row, K) over an M x N block, 4 columns at a time
+template <typename Dot4, typename Dot1>
+void gemm_blocked(const int8_t* p_a,
+                  std::size_t lda,
+                  const int8_t* p_b,
+                  std::size_t ldb,
+                  const int32_t* p_b_sum,
+                  int32_t* p_c,
+                  std::size_t ldc,
+                  std::size_t M,
+                  std::size_t N,
+                  std::size_t K,
+                  Dot4 dot4,
+                  Dot1 dot1)
+{
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        const int8_t* p_a_row = p_a + m * lda;
+        int32_t* p_c_row      = p_c + m * ldc;
+
+        std::size_t n = 0;
+        for(; n + 4 <= N; n += 4)
+        {
+            dot4(p_a_row, p_b + n * ldb, ldb, p_b_sum + n, p_c_row + n, K);
+        }
+        for(; n < N; ++n)
+        {
+            dot1(p_a_row, p_b + n * ldb, ldb, p_b_sum + n, p_c_row + n, K);
+        }
+    }
+}
+
+#endif // CK_HOST_GEMM_INT8_X86
+
+} // namespace
+
+HostInt8Dot GetHostInt8Dot()
+{
+    static const HostInt8Dot dot = [] {
+        switch(GetHostSimd())
+        {
+        case HostSimd::Avx512: return ClampHostInt8Dot(HostInt8Dot::Avx512Vnni);
+        case HostSimd::Avx2: return ClampHostInt8Dot(HostInt8Dot::AvxVnni);
+        case HostSimd::None: break;
+        }
+        return HostInt8Dot::Scalar;
+    }();
+
+    return dot;
+}
+
+const char* GetHostInt8DotString(HostInt8Dot dot)
+{
+    switch(dot)
+    {
+    case HostInt8Dot::Scalar: return "scalar";
+    case HostInt8Dot::Avx2: return "avx2";
+    case HostInt8Dot::AvxVnni: return "avx_vnni";
+    case HostInt8Dot::Avx512Bw: return "avx512bw";
+    case HostInt8Dot::Avx512Vnni: return "avx512_vnni";
+    }
+    return "unknown";
+}
+
+namespace detail {
+
+void gemm_s8s8s32_nt(const int8_t* p_a,
+                     std::size_t lda,
+                     const int8_t* p_b,
+                     std::size_t ldb,
+                     const int32_t* p_b_sum,
+                     int32_t* p_c,
+                     std::size_t ldc,
+                     std::size_t M,
+                     std::size_t N,
+                     std::size_t K,
+                     HostInt8Dot dot)
+{
+#if CK_HOST_GEMM_INT8_X86
+    // the kernels differ in signature only by the B sums, which the madd kernels do not need
+    auto madd = [](auto kernel) {
+        return [=](const int8_t* a, const int8_t* b, std::size_t ld, const int32_t*, int32_t* c,
+                   std::size_t k) { kernel(a, b, ld, c, k); };
+    };
+
+    switch(ClampHostInt8Dot(dot))
+    {
+    case HostInt8Dot::Avx512Vnni:
+        gemm_blocked(
+            p_a, lda, p_b, ldb, p_b_sum, p_c, ldc, M, N, K, dot_avx512_vnni<4>, dot_avx512_vnni<1>);
+        return;
+    case HostInt8Dot::Avx512Bw:
+        gemm_blocked(p_a,
+                     lda,
+                     p_b,
+                     ldb,
+                     p_b_sum,
+                     p_c,
+                     ldc,
+                     M,
+                     N,
+                     K,
+                     madd(dot_avx512_bw<4>),
+                     madd(dot_avx512_bw<1>));
+        return;
+    case HostInt8Dot::AvxVnni:
+        gemm_blocked(
+            p_a, lda, p_b, ldb, p_b_sum, p_c, ldc, M, N, K, dot_avx_vnni<4>, dot_avx_vnni<1>);
+        return;
+    case HostInt8Dot::Avx2:
+        gemm_blocked(
+            p_a, lda, p_b, ldb, p_b_sum, p_c, ldc, M, N, K, madd(dot_avx2<4>), madd(dot_avx2<1>));
+        return;
+    case HostInt8Dot::Scalar: break;
+    }
+#else
+    (void)dot;
+    (void)p_b_sum;
+#endif
+
+    gemm_scalar(p_a, lda, p_b, ldb, p_c, ldc, M, N, K);
+}
+
+} // namespace detail
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,440 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_permute.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_HOST_PERMUTE_X86 1
+#include <immintrin.h>
+#else
+#define CK_HOST_PERMUTE_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+// edge of a square tile, a tile of the source and of the destination fit in L1 together
+std::size_t TileSize(std::size_t elem_size) { return elem_size <= 4 ? 64 : 32; }
+
+// length of a row in the copy case, where c is the fastest dimension of both operands
+constexpr std::size_t CopyRunBytes = 64 * 1024;
+
+template <typename U>
+inline U load(const std::byte* p)
+{
+    U v;
+    std::memcpy(&v, p, sizeof(U));
+    return v;
+}
+
+template <typename U>
+inline void store(std::byte* p, U v)
+{
+    std::memcpy(p, &v, sizeof(U));
+}
+
+// element (r, c) of a tile is p_src[r * src_stride_r + c * src_stride_c] and
+// p_dst[r * dst_stride_r + c * dst_stride_c], strides in elements
+template <typename U>
+void permute_tile_scalar(const std::byte* p_src,
+                         std::size_t src_stride_r,
+                         std::size_t src_stride_c,
+                         std::byte* p_dst,
+                         std::size_t dst_stride_r,
+                         std::size_t dst_stride_c,
+                         std::size_t rows,
+                         std::size_t cols)
+{
+    for(std::size_t r = 0; r < rows; ++r)
+    {
+        const std::byte* p_s = p_src + r * src_stride_r * sizeof(U);
+        std::byte* p_d       = p_dst + r * dst_stride_r * sizeof(U);
+
+        for(std::size_t c = 0; c < cols; ++c)
+        {
+            store<U>(p_d + c * dst_stride_c * sizeof(U),
+                     load<U>(p_s + c * src_stride_c * sizeof(U)));
+        }
+    }
+}
+
+void permute_tile_bytes(const std::byte* p_src,
+                        std::size_t src_stride_r,
+                        std::size_t src_stride_c,
+                        std::byte* p_dst,
+                        std::size_t dst_stride_r,
+                        std::size_t dst_stride_c,
+                        std::size_t rows,
+                        std::size_t cols,
+                        std::size_t elem_size)
+{
+    for(std::size_t r = 0; r < rows; ++r)
+    {
+        for(std::size_t c = 0; c < cols; ++c)
+        {
+            std::memcpy(p_dst + (r * dst_stride_r + c * dst_stride_c) * elem_size,
+                        p_src + (r * src_stride_r + c * src_stride_c) * elem_size,
+                        elem_size);
+        }
+    }
+}
+
+#if CK_HOST_PERMUTE_X86
+
+// W x W register transposes: W rows of the source, 'src_ld' elements apart, each holding W
+// consecutive r, become W rows of the destination, 'dst_ld' elements apart, each holding W
+// consecutive c
+
+// 16 x 16 bytes and 8 x 8 16-bit words: log2(W) rounds of interleaving row i with row i + W / 2
+template <int W, __m128i (*UnpackLo)(__m128i, __m128i), __m128i (*UnpackHi)(__m128i, __m128i)>
+inline void transpose_sse2(const std::byte* p_src,
+                           std::size_t src_ld_bytes,
+                           std::byte* p_dst,
+                           std::size_t dst_ld_bytes)
+{
+    __m128i a[W];
+    __m128i b[W];
+
+    for(int i = 0; i < W; ++i)
+    {
+        a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i * src_ld_bytes));
+    }
+
+    for(int round = 1; round < W; round *= 2)
+    {
+        for(int i = 0; i < W / 2; ++i)
+        {
+            b[2 * i]     = UnpackLo(a[i], a[i + W / 2]);
+            b[2 * i + 1] = UnpackHi(a[i], a[i + W / 2]);
+        }
+
+        std::copy(b, b + W, a);
+    }
+
+    for(int i = 0; i < W; ++i)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i * dst_ld_bytes), a[i]);
+    }
+}
+
+inline __m128i unpacklo_epi8(__m128i a, __m128i b) { return _mm_unpacklo_epi8(a, b); }
+inline __m128i unpackhi_epi8(__m128i a, __m128i b) { return _mm_unpackhi_epi8(a, b); }
+inline __m128i unpacklo_epi16(__m128i a, __m128i b) { return _mm_unpacklo_epi16(a, b); }
+inline __m128i unpackhi_epi16(__m128i a, __m128i b) { return _mm_unpackhi_epi16(a, b); }
+
+void transpose_16x16_b8(const std::byte* p_src,
+                        std::size_t src_ld_bytes,
+                        std::byte* p_dst,
+                        std::size_t dst_ld_bytes)
+{
+    transpose_sse2<16, unpacklo_epi8, unpackhi_epi8>(p_src, src_ld_bytes, p_dst, dst_ld_bytes);
+}
+
+void transpose_8x8_b16(const std::byte* p_src,
+                       std::size_t src_ld_bytes,
+                       std::byte* p_dst,
+                       std::size_t dst_ld_bytes)
+{
+    transpose_sse2<8, unpacklo_epi16, unpackhi_epi16>(p_src, src_ld_bytes, p_dst, dst_ld_bytes);
+}
+
+__attribute__((target("avx"))) void transpose_8x8_b32(const std::byte* p_src,
+                                                      std::size_t src_ld_bytes,
+                                                      std::byte* p_dst,
+                                                      std::size_t dst_ld_bytes)
+{
+    __m256 r[8];
+
+    for(int i = 0; i < 8; ++i)
+    {
+        r[i] = _mm256_loadu_ps(reinterpret_cast<const float*>(p_src + i * src_ld_bytes));
+    }
+
+    __m256 t[8];
+    for(int i = 0; i < 4; ++i)
+    {
+        t[2 * i]     = _mm256_unpacklo_ps(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm256_unpackhi_ps(r[2 * i], r[2 * i + 1]);
+    }
+
+    __m256 u[8];
+    for(int i = 0; i < 2; ++i)
+    {
+        u[4 * i + 0] = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+        u[4 * i + 1] = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+        u[4 * i + 2] = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+        u[4 * i + 3] = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    for(int i = 0; i < 4; ++i)
+    {
+        _mm256_storeu_ps(reinterpret_cast<float*>(p_dst + i * dst_ld_bytes),
+                         _mm256_permute2f128_ps(u[i], u[i + 4], 0x20));
+        _mm256_storeu_ps(reinterpret_cast<float*>(p_dst + (i + 4) * dst_ld_bytes),
+                         _mm256_permute2f128_ps(u[i], u[i + 4], 0x31));
+    }
+}
+
+__attribute__((target("avx"))) void transpose_4x4_b64(const std::byte* p_src,
+                                                      std::size_t src_ld_bytes,
+                                                      std::byte* p_dst,
+                                                      std::size_t dst_ld_bytes)
+{
+    __m256d r[4];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        r[i] = _mm256_loadu_pd(reinterpret_cast<const double*>(p_src + i * src_ld_bytes));
+    }
+
+    const __m256d t0 = _mm256_unpacklo_pd(r[0], r[1]);
+    const __m256d t1 = _mm256_unpackhi_pd(r[0], r[1]);
+    const __m256d t2 = _mm256_unpacklo_pd(r[2], r[3]);
+    const __m256d t3 = _mm256_unpackhi_pd(r[2], r[3]);
+
+    auto p_d = [&](int i) { return reinterpret_cast<double*>(p_dst + i * dst_ld_bytes); };
+
+    _mm256_storeu_pd(p_d(0), _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(p_d(1), _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(p_d(2), _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(p_d(3), _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+// src is unit-stride along r, dst along c: W x W blocks through the register transpose, the
+// ragged right and bottom edges element by element
+template <typename U,
+          std::size_t W,
+          void (*Kernel)(const std::byte*, std::size_t, std::byte*, std::size_t)>
+void permute_tile_simd(const std::byte* p_src,
+                       std::size_t src_stride_c,
+                       std::byte* p_dst,
+                       std::size_t dst_stride_r,
+                       std::size_t rows,
+                       std::size_t cols)
+{
+    constexpr std::size_t S = sizeof(U);
+
+    const std::size_t rows_w = rows / W * W;
+    const std::size_t cols_w = cols / W * W;
+
+    for(std::size_t c = 0; c < cols_w; c += W)
+    {
+        for(std::size_t r = 0; r < rows_w; r += W)
+        {
+            Kernel(p_src + (r + c * src_stride_c) * S,
+                   src_stride_c * S,
+                   p_dst + (r * dst_stride_r + c) * S,
+                   dst_stride_r * S);
+        }
+    }
+
+    permute_tile_scalar<U>(p_src + rows_w * S,
+                           1,
+                           src_stride_c,
+                           p_dst + rows_w * dst_stride_r * S,
+                           dst_stride_r,
+                           1,
+                           rows - rows_w,
+                           cols);
+    permute_tile_scalar<U>(p_src + cols_w * src_stride_c * S,
+                           1,
+                           src_stride_c,
+                           p_dst + cols_w * S,
+                           dst_stride_r,
+                           1,
+                           rows_w,
+                           cols - cols_w);
+}
+
+#endif // CK_HOST_PERMUTE_X86
+
+void permute_tile(const std::byte* p_src,
+                  std::size_t src_stride_r,
+                  std::size_t src_stride_c,
+                  std::byte* p_dst,
+                  std::size_t dst_stride_r,
+                  std::size_t dst_stride_c,
+                  std::size_t rows,
+                  std::size_t cols,
+                  std::size_t elem_size,
+                  HostSimd simd)
+{
+    if(src_stride_c == 1 && dst_stride_c == 1)
+    {
+        for(std::size_t r = 0; r < rows; ++r)
+        {
+            std::memcpy(p_dst + r * dst_stride_r * elem_size,
+                        p_src + r * src_stride_r * elem_size,
+                        cols * elem_size);
+        }
+
+        return;
+    }
+
+#if CK_HOST_PERMUTE_X86
+    if(src_stride_r == 1 && dst_stride_c == 1 && simd != HostSimd::None &&
+       GetHostSimd() != HostSimd::None)
+    {
+        switch(elem_size)
+        {
+        case 1:
+            permute_tile_simd<uint8_t, 16, transpose_16x16_b8>(
+                p_src, src_stride_c, p_dst, dst_stride_r, rows, cols);
+            return;
+        case 2:
+            permute_tile_simd<uint16_t, 8, transpose_8x8_b16>(
+                p_src, src_stride_c, p_dst, dst_stride_r, rows, cols);
+            return;
+        case 4:
+            permute_tile_simd<uint32_t, 8, transpose_8x8_b32>(
+                p_src, src_stride_c, p_dst, dst_stride_r, rows, cols);
+            return;
+        case 8:
+            permute_tile_simd<uint64_t, 4, transpose_4x4_b64>(
+                p_src, src_stride_c, p_dst, dst_stride_r, rows, cols);
+            return;
+        default: break;
+        }
+    }
+#else
+    (void)simd;
+#endif
+
+    auto f_scalar = [&](auto u) {
+        using U = decltype(u);
+
+        permute_tile_scalar<U>(
+            p_src, src_stride_r, src_stride_c, p_dst, dst_stride_r, dst_stride_c, rows, cols);
+    };
+
+    switch(elem_size)
+    {
+    case 1: f_scalar(uint8_t{}); break;
+    case 2: f_scalar(uint16_t{}); break;
+    case 4: f_scalar(uint32_t{}); break;
+    case 8: f_scalar(uint64_t{}); break;
+    default:
+        permute_tile_bytes(p_src,
+                           src_stride_r,
+                           src_stride_c,
+                           p_dst,
+                           dst_stride_r,
+                           dst_stride_c,
+                           rows,
+                           cols,
+                           elem_size);
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+void host_permute_bytes(const void* p_src,
+                        const std::vector<std::size_t>& src_strides,
+                        void* p_dst,
+                        const std::vector<std::size_t>& dst_strides,
+                        const std::vector<std::size_t>& lengths,
+                        std::size_t elem_size,
+                        HostSimd simd)
+{
+    // dst first, so the innermost dimension of the loop is the fastest one of dst
+    const auto loop = make_host_elementwise_loop(lengths, {dst_strides, src_strides});
+
+    const std::size_t rank = loop.lengths.size();
+
+    if(loop.lengths[0] == 0)
+    {
+        return;
+    }
+
+    const auto& dst_s = loop.strides[0];
+    const auto& src_s = loop.strides[1];
+
+    // c: fastest dimension of dst, r: fastest dimension of src; the copy case when they coincide
+    const std::size_t c_dim = rank - 1;
+
+    std::size_t r_dim = c_dim;
+    for(std::size_t d = 0; d < c_dim; ++d)
+    {
+        if(src_s[d] < src_s[r_dim])
+        {
+            r_dim = d;
+        }
+    }
+
+    const bool copy = r_dim == c_dim;
+
+    std::vector<std::size_t> batch_dims;
+    std::size_t num_batch = 1;
+    for(std::size_t d = 0; d < c_dim; ++d)
+    {
+        if(d != r_dim)
+        {
+            batch_dims.push_back(d);
+            num_batch *= loop.lengths[d];
+        }
+    }
+
+    const std::size_t len_r = copy ? 1 : loop.lengths[r_dim];
+    const std::size_t len_c = loop.lengths[c_dim];
+
+    const std::size_t tile_r = TileSize(elem_size);
+    const std::size_t tile_c =
+        copy ? std::max(std::size_t{1}, CopyRunBytes / elem_size) : TileSize(elem_size);
+
+    const std::size_t src_stride_r = copy ? 0 : src_s[r_dim];
+    const std::size_t dst_stride_r = copy ? 0 : dst_s[r_dim];
+
+    const auto* p_src_bytes = static_cast<const std::byte*>(p_src);
+    auto* p_dst_bytes       = static_cast<std::byte*>(p_dst);
+
+    auto f_tile = [&](auto i_batch, auto i_tile_r, auto i_tile_c) {
+        std::size_t src_offset = 0;
+        std::size_t dst_offset = 0;
+
+        for(std::size_t k = batch_dims.size(), i = i_batch; k-- > 0;)
+        {
+            const std::size_t d   = batch_dims[k];
+            const std::size_t idx = i % loop.lengths[d];
+            i /= loop.lengths[d];
+
+            src_offset += idx * src_s[d];
+            dst_offset += idx * dst_s[d];
+        }
+
+        const std::size_t r = i_tile_r * tile_r;
+        const std::size_t c = i_tile_c * tile_c;
+
+        src_offset += r * src_stride_r + c * src_s[c_dim];
+        dst_offset += r * dst_stride_r + c * dst_s[c_dim];
+
+        permute_tile(p_src_bytes + src_offset * elem_size,
+                     src_stride_r,
+                     src_s[c_dim],
+                     p_dst_bytes + dst_offset * elem_size,
+                     dst_stride_r,
+                     dst_s[c_dim],
+                     std::min(tile_r, len_r - r),
+                     std::min(tile_c, len_c - c),
+                     elem_size,
+                     simd);
+    };
+
+    make_ParallelTensorFunctor(
+        f_tile, num_batch, (len_r + tile_r - 1) / tile_r, (len_c + tile_c - 1) / tile_c)(
+        std::thread::hardware_concurrency());
+}
+
+} // namespace detail
+
+} // namespace utils
+} // namespace ck
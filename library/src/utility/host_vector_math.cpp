@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+
+#include "ck/library/utility/host_vector_math.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_HOST_VECTOR_MATH_X86 1
+#include <immintrin.h>
+#else
+#define CK_HOST_VECTOR_MATH_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+#if CK_HOST_VECTOR_MATH_X86
+
+bool HasFma()
+{
+    static const bool has_fma = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }();
+
+    return has_fma;
+}
+
+// exp(x) = 2^n * exp(r), n = round(x / ln2), |r| <= ln2 / 2 (Cephes expf polynomial)
+__attribute__((target("avx2,fma"))) inline __m256 exp_avx2(__m256 x)
+{
+    const __m256 hi = _mm256_set1_ps(88.7228394f);  // ln(FLT_MAX)
+    const __m256 lo = _mm256_set1_ps(-87.3365479f); // ln(FLT_MIN)
+
+    const __m256 xc = _mm256_min_ps(_mm256_max_ps(x, lo), hi);
+
+    const __m256 n = _mm256_round_ps(_mm256_mul_ps(xc, _mm256_set1_ps(1.44269504f)),
+                                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    // ln2 split in two parts so that n * ln2_hi is exact
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), xc);
+    r        = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), r);
+
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p        = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.3981999507e-3f));
+    p        = _mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073e-3f));
+    p        = _mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894e-2f));
+    p        = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459e-1f));
+    p        = _mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201e-1f));
+    p = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.f)));
+
+    // n is in [-126, 128]; 2^128 is not representable, so scale by 2^(n - s) * 2^s, s = n > 127
+    const __m256i ni = _mm256_cvtps_epi32(n);
+    const __m256i s =
+        _mm256_and_si256(_mm256_cmpgt_epi32(ni, _mm256_set1_epi32(127)), _mm256_set1_epi32(1));
+    const __m256i e0  = _mm256_add_epi32(_mm256_sub_epi32(ni, s), _mm256_set1_epi32(127));
+    const __m256i e1  = _mm256_add_epi32(s, _mm256_set1_epi32(127));
+    const __m256 pow0 = _mm256_castsi256_ps(_mm256_slli_epi32(e0, 23));
+    const __m256 pow1 = _mm256_castsi256_ps(_mm256_slli_epi32(e1, 23));
+
+    __m256 y = _mm256_mul_ps(_mm256_mul_ps(p, pow0), pow1);
+
+    y = _mm256_blendv_ps(y, _mm256_set1_ps(HUGE_VALF), _mm256_cmp_ps(x, hi, _CMP_GT_OQ));
+    y = _mm256_blendv_ps(y, _mm256_setzero_ps(), _mm256_cmp_ps(x, lo, _CMP_LT_OQ));
+
+    // NaN in, NaN out
+    return _mm256_blendv_ps(y, x, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+}
+
+__attribute__((target("avx2,fma"))) inline __m256 abs_avx2(__m256 x)
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.f), x);
+}
+
+__attribute__((target("avx2,fma"))) inline __m256 copysign_avx2(__m256 magnitude, __m256 x)
+{
+    return _mm256_or_ps(magnitude, _mm256_and_ps(_mm256_set1_ps(-0.f), x));
+}
+
+// erf(x): Taylor series up to x^21 for |x| < 1, Abramowitz & Stegun 7.1.26 otherwise
+__attribute__((target("avx2,fma"))) inline __m256 erf_avx2(__m256 x)
+{
+    const __m256 ax = abs_avx2(x);
+    const __m256 x2 = _mm256_mul_ps(x, x);
+
+    __m256 s = _mm256_set1_ps(1.4807192816e-08f);
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-1.6365844691e-07f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(1.6462114366e-06f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-1.4925650358e-05f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(1.2055332982e-04f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-8.5483270235e-04f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(5.2239776254e-03f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-2.6866170645e-02f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(1.1283791671e-01f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-3.7612638903e-01f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(1.1283791671e+00f));
+    const __m256 small = _mm256_mul_ps(s, ax);
+
+    const __m256 one = _mm256_set1_ps(1.f);
+
+    const __m256 t = _mm256_div_ps(one, _mm256_fmadd_ps(_mm256_set1_ps(0.3275911f), ax, one));
+
+    __m256 q = _mm256_set1_ps(1.061405429f);
+    q        = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-1.453152027f));
+    q        = _mm256_fmadd_ps(q, t, _mm256_set1_ps(1.421413741f));
+    q        = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-0.284496736f));
+    q        = _mm256_fmadd_ps(q, t, _mm256_set1_ps(0.254829592f));
+    q        = _mm256_mul_ps(q, t);
+    const __m256 large = _mm256_fnmadd_ps(q, exp_avx2(_mm256_sub_ps(_mm256_setzero_ps(), x2)), one);
+
+    const __m256 y = _mm256_blendv_ps(large, small, _mm256_cmp_ps(ax, one, _CMP_LT_OQ));
+
+    return copysign_avx2(y, x);
+}
+
+// tanh(x): Taylor series up to x^17 for |x| < 0.55, 1 - 2 / (exp(2|x|) + 1) otherwise
+__attribute__((target("avx2,fma"))) inline __m256 tanh_avx2(__m256 x)
+{
+    const __m256 ax = abs_avx2(x);
+    const __m256 x2 = _mm256_mul_ps(x, x);
+
+    __m256 s = _mm256_set1_ps(5.9002744095e-04f);
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-1.4558343871e-03f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(3.5921280366e-03f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-8.8632355299e-03f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(2.1869488536e-02f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-5.3968253968e-02f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(1.3333333333e-01f));
+    s        = _mm256_fmadd_ps(s, x2, _mm256_set1_ps(-3.3333333333e-01f));
+    const __m256 small = _mm256_fmadd_ps(_mm256_mul_ps(s, x2), ax, ax);
+
+    const __m256 one   = _mm256_set1_ps(1.f);
+    const __m256 e     = exp_avx2(_mm256_add_ps(ax, ax));
+    const __m256 large =
+        _mm256_sub_ps(one, _mm256_div_ps(_mm256_set1_ps(2.f), _mm256_add_ps(e, one)));
+
+    const __m256 y =
+        _mm256_blendv_ps(large, small, _mm256_cmp_ps(ax, _mm256_set1_ps(0.55f), _CMP_LT_OQ));
+
+    return copysign_avx2(y, x);
+}
+
+// the last partial vector goes through a padded buffer, so every element is evaluated by the
+// same polynomial wherever it sits in the range
+template <__m256 (*Kernel)(__m256)>
+__attribute__((target("avx2,fma"))) void loop_avx2(const float* p_x, float* p_y, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        _mm256_storeu_ps(p_y + i, Kernel(_mm256_loadu_ps(p_x + i)));
+    }
+
+    if(i < n)
+    {
+        float buf[8] = {};
+        std::copy(p_x + i, p_x + n, buf);
+        _mm256_storeu_ps(buf, Kernel(_mm256_loadu_ps(buf)));
+        std::copy(buf, buf + (n - i), p_y + i);
+    }
+}
+
+bool UseAvx2(HostSimd simd)
+{
+    // a polynomial bound workload, 256-bit FMA is used on AVX-512 machines too
+    return simd != HostSimd::None && GetHostSimd() != HostSimd::None && HasFma();
+}
+
+#endif // CK_HOST_VECTOR_MATH_X86
+
+} // namespace
+
+void host_exp(const float* p_x, float* p_y, std::size_t n, HostSimd simd)
+{
+#if CK_HOST_VECTOR_MATH_X86
+    if(UseAvx2(simd))
+    {
+        loop_avx2<exp_avx2>(p_x, p_y, n);
+        return;
+    }
+#else
+    (void)simd;
+#endif
+
+    std::transform(p_x, p_x + n, p_y, [](float x) { return std::exp(x); });
+}
+
+void host_erf(const float* p_x, float* p_y, std::size_t n, HostSimd simd)
+{
+#if CK_HOST_VECTOR_MATH_X86
+    if(UseAvx2(simd))
+    {
+        loop_avx2<erf_avx2>(p_x, p_y, n);
+        return;
+    }
+#else
+    (void)simd;
+#endif
+
+    std::transform(p_x, p_x + n, p_y, [](float x) { return std::erf(x); });
+}
+
+void host_tanh(const float* p_x, float* p_y, std::size_t n, HostSimd simd)
+{
+#if CK_HOST_VECTOR_MATH_X86
+    if(UseAvx2(simd))
+    {
+        loop_avx2<tanh_avx2>(p_x, p_y, n);
+        return;
+    }
+#else
+    (void)simd;
+#endif
+
+    std::transform(p_x, p_x + n, p_y, [](float x) { return std::tanh(x); });
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+
+#include "ck/library/utility/packed_int4.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_PACKED_INT4_X86 1
+#include <immintrin.h>
+#else
+#define CK_PACKED_INT4_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+// n must be even
+void pack_scalar(const int8_t* p_src, uint8_t* p_dst, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; i += 2)
+    {
+        p_dst[i / 2] = (static_cast<uint8_t>(p_src[i]) & 0x0f) |
+                       static_cast<uint8_t>(static_cast<uint8_t>(p_src[i + 1]) << 4);
+    }
+}
+
+void unpack_scalar(const uint8_t* p_src, int8_t* p_dst, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        p_dst[i] = get_packed_int4(p_src, i);
+    }
+}
+
+#if CK_PACKED_INT4_X86
+
+// 64 values -> 32 bytes per iteration. Each 16-bit lane holds an (even, odd) pair, which is
+// combined into the low byte of the lane and narrowed with unsigned saturation (always exact).
+__attribute__((target("avx2"))) std::size_t
+pack_avx2(const int8_t* p_src, uint8_t* p_dst, std::size_t n)
+{
+    const __m256i low_mask  = _mm256_set1_epi16(0x000f);
+    const __m256i high_mask = _mm256_set1_epi16(0x00f0);
+
+    std::size_t i = 0;
+    for(; i + 64 <= n; i += 64)
+    {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i + 32));
+
+        const __m256i b0 = _mm256_or_si256(_mm256_and_si256(v0, low_mask),
+                                           _mm256_and_si256(_mm256_srli_epi16(v0, 4), high_mask));
+        const __m256i b1 = _mm256_or_si256(_mm256_and_si256(v1, low_mask),
+                                           _mm256_and_si256(_mm256_srli_epi16(v1, 4), high_mask));
+
+        // packus works per 128-bit lane, restore the element order afterwards
+        const __m256i packed =
+            _mm256_permute4x64_epi64(_mm256_packus_epi16(b0, b1), _MM_SHUFFLE(3, 1, 2, 0));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i / 2), packed);
+    }
+    return i;
+}
+
+// 32 bytes -> 64 values per iteration; sign extension of a nibble x is (x ^ 8) - 8
+__attribute__((target("avx2"))) std::size_t
+unpack_avx2(const uint8_t* p_src, int8_t* p_dst, std::size_t n)
+{
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i sign_bit    = _mm256_set1_epi8(0x08);
+
+    std::size_t i = 0;
+    for(; i + 64 <= n; i += 64)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i / 2));
+
+        const __m256i low  = _mm256_and_si256(v, nibble_mask);
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+
+        // unpack works per 128-bit lane, restore the element order afterwards
+        const __m256i r0 = _mm256_unpacklo_epi8(low, high);
+        const __m256i r1 = _mm256_unpackhi_epi8(low, high);
+
+        __m256i out0 = _mm256_permute2x128_si256(r0, r1, 0x20);
+        __m256i out1 = _mm256_permute2x128_si256(r0, r1, 0x31);
+
+        out0 = _mm256_sub_epi8(_mm256_xor_si256(out0, sign_bit), sign_bit);
+        out1 = _mm256_sub_epi8(_mm256_xor_si256(out1, sign_bit), sign_bit);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), out0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i + 32), out1);
+    }
+    return i;
+}
+
+#endif // CK_PACKED_INT4_X86
+
+} // namespace
+
+namespace detail {
+
+void pack_int4_chunk(const int8_t* p_src, uint8_t* p_dst, std::size_t n, HostSimd simd)
+{
+    std::size_t i = 0;
+
+#if CK_PACKED_INT4_X86
+    // a memory bound shuffle, 256 bit is enough on AVX-512 machines too
+    if(simd != HostSimd::None && GetHostSimd() != HostSimd::None)
+    {
+        i = pack_avx2(p_src, p_dst, n);
+    }
+#else
+    (void)simd;
+#endif
+
+    const std::size_t n_even = n - n % 2;
+    pack_scalar(p_src + i, p_dst + i / 2, n_even - i);
+
+    if(n % 2 != 0)
+    {
+        p_dst[n / 2] = static_cast<uint8_t>(p_src[n - 1]) & 0x0f;
+    }
+}
+
+void unpack_int4_chunk(const uint8_t* p_src, int8_t* p_dst, std::size_t n, HostSimd simd)
+{
+    std::size_t i = 0;
+
+#if CK_PACKED_INT4_X86
+    if(simd != HostSimd::None && GetHostSimd() != HostSimd::None)
+    {
+        i = unpack_avx2(p_src, p_dst, n);
+    }
+#else
+    (void)simd;
+#endif
+
+    unpack_scalar(p_src + i / 2, p_dst + i, n - i);
+}
+
+} // namespace detail
+
+void pack_int4(const int8_t* p_src, uint8_t* p_dst, std::size_t n)
+{
+    const HostSimd simd = GetHostSimd();
+
+    // chunk boundaries are multiples of 64 elements, so every chunk starts on a byte boundary
+    detail::parallel_for_chunks(n, std::size_t{1} << 16, [&](std::size_t begin, std::size_t end) {
+        detail::pack_int4_chunk(p_src + begin, p_dst + begin / 2, end - begin, simd);
+    });
+}
+
+void unpack_int4(const uint8_t* p_src, int8_t* p_dst, std::size_t n)
+{
+    const HostSimd simd = GetHostSimd();
+
+    detail::parallel_for_chunks(n, std::size_t{1} << 16, [&](std::size_t begin, std::size_t end) {
+        detail::unpack_int4_chunk(p_src + begin / 2, p_dst + begin, end - begin, simd);
+    });
+}
+
+} // namespace utils
+} // namespace ck
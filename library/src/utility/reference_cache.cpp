@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "ck/library/utility/environment.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::uint64_t hash_prime = 0x9e3779b97f4a7c15ull;
+
+inline std::uint64_t mix(std::uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+inline std::uint64_t rotl(std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+} // namespace
+
+std::uint64_t HashBytes(const void* p, std::size_t size, std::uint64_t seed)
+{
+    const auto* bytes = static_cast<const unsigned char*>(p);
+
+    // four independent lanes so the multiply chains overlap
+    std::uint64_t lanes[4] = {seed, seed ^ hash_prime, rotl(seed, 17), rotl(seed, 41) + 1};
+
+    std::size_t i = 0;
+    for(; i + 32 <= size; i += 32)
+    {
+        for(int l = 0; l < 4; ++l)
+        {
+            std::uint64_t w;
+            std::memcpy(&w, bytes + i + 8 * l, sizeof(w));
+            lanes[l] = rotl(lanes[l] ^ (w * hash_prime), 31) * 0x87c37b91114253d5ull;
+        }
+    }
+
+    std::uint64_t h = size;
+    for(int l = 0; l < 4; ++l)
+    {
+        h = mix(h ^ lanes[l]) * hash_prime;
+    }
+
+    for(; i < size; ++i)
+    {
+        h = (h ^ bytes[i]) * 0x100000001b3ull;
+    }
+
+    return mix(h);
+}
+
+std::string ReferenceCacheKey::ToString() const
+{
+    std::ostringstream os;
+    os << std::hex << std::setfill('0') << std::setw(16) << h0_ << std::setw(16) << h1_;
+    return os.str();
+}
+
+ReferenceCache::ReferenceCache(const std::string& dir, std::size_t max_bytes)
+    : dir_(dir), max_bytes_(max_bytes)
+{
+    fs::create_directories(dir_);
+}
+
+ReferenceCache* ReferenceCache::GetDefault()
+{
+    static std::unique_ptr<ReferenceCache> cache = []() -> std::unique_ptr<ReferenceCache> {
+        const char* dir = std::getenv("CK_REFERENCE_CACHE_DIR");
+        if(dir == nullptr || *dir == '\0')
+        {
+            return nullptr;
+        }
+
+        // no cache rather than an unbounded one
+        const auto max_mb = GetEnvUnsigned("CK_REFERENCE_CACHE_MAX_MB", 4096);
+        if(!max_mb)
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<ReferenceCache>(dir, *max_mb << 20);
+    }();
+
+    return cache.get();
+}
+
+std::string ReferenceCache::GetPath(const ReferenceCacheKey& key) const
+{
+    return (fs::path(dir_) / (key.ToString() + ".npy")).string();
+}
+
+std::string ReferenceCache::MakeTempPath(const std::string& path)
+{
+    std::ostringstream os;
+    os << path << ".tmp." << ::getpid() << "." << std::this_thread::get_id();
+    return os.str();
+}
+
+void ReferenceCache::Commit(const std::string& tmp, const std::string& path)
+{
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if(ec)
+    {
+        fs::remove(tmp, ec);
+    }
+}
+
+bool ReferenceCache::Touch(const std::string& path)
+{
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return !ec;
+}
+
+std::size_t ReferenceCache::GetSizeInBytes() const
+{
+    std::size_t total = 0;
+    std::error_code ec;
+
+    for(const auto& entry : fs::directory_iterator(dir_, ec))
+    {
+        if(entry.is_regular_file(ec) && entry.path().extension() == ".npy")
+        {
+            total += entry.file_size(ec);
+        }
+    }
+    return total;
+}
+
+void ReferenceCache::Trim(std::size_t max_bytes) const
+{
+    struct Entry
+    {
+        fs::path path;
+        std::size_t size;
+        fs::file_time_type time;
+    };
+
+    std::vector<Entry> entries;
+    std::size_t total = 0;
+    std::error_code ec;
+
+    for(const auto& entry : fs::directory_iterator(dir_, ec))
+    {
+        if(!entry.is_regular_file(ec) || entry.path().extension() != ".npy")
+            continue;
+
+        const std::size_t size = entry.file_size(ec);
+        const auto time        = entry.last_write_time(ec);
+
+        if(ec)
+            continue; // removed by another process meanwhile
+
+        entries.push_back({entry.path(), size, time});
+        total += size;
+    }
+
+    if(total <= max_bytes)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time;
+    });
+
+    for(const auto& entry : entries)
+    {
+        if(total <= max_bytes)
+            break;
+
+        fs::remove(entry.path, ec);
+        total -= entry.size;
+    }
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,626 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cctype>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ck/library/utility/tensor_io.hpp"
+
+namespace ck {
+namespace utils {
+
+std::size_t GetTensorFileDataTypeSize(TensorFileDataType type)
+{
+    switch(type)
+    {
+    case TensorFileDataType::F32: return 4;
+    case TensorFileDataType::F16: return 2;
+    case TensorFileDataType::BF16: return 2;
+    case TensorFileDataType::I8: return 1;
+    case TensorFileDataType::I32: return 4;
+    }
+    throw std::runtime_error("GetTensorFileDataTypeSize: unknown data type");
+}
+
+// names follow the safetensors dtype spelling
+std::string GetTensorFileDataTypeString(TensorFileDataType type)
+{
+    switch(type)
+    {
+    case TensorFileDataType::F32: return "F32";
+    case TensorFileDataType::F16: return "F16";
+    case TensorFileDataType::BF16: return "BF16";
+    case TensorFileDataType::I8: return "I8";
+    case TensorFileDataType::I32: return "I32";
+    }
+    throw std::runtime_error("GetTensorFileDataTypeString: unknown data type");
+}
+
+namespace {
+
+TensorFileDataType ParseTensorFileDataTypeString(const std::string& str)
+{
+    for(auto type : {TensorFileDataType::F32,
+                     TensorFileDataType::F16,
+                     TensorFileDataType::BF16,
+                     TensorFileDataType::I8,
+                     TensorFileDataType::I32})
+    {
+        if(GetTensorFileDataTypeString(type) == str)
+            return type;
+    }
+    throw std::runtime_error("safetensors: unsupported dtype " + str);
+}
+
+std::size_t GetNumElements(const std::vector<std::size_t>& lengths)
+{
+    return std::accumulate(
+        lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<std::size_t>());
+}
+
+} // namespace
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        throw std::runtime_error("MappedFile::Open: cannot open " + path);
+    }
+
+    struct stat st;
+    if(::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("MappedFile::Open: cannot stat " + path);
+    }
+
+    const std::size_t size = st.st_size;
+    void* p                = nullptr;
+
+    if(size > 0)
+    {
+        p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+
+    if(p == MAP_FAILED)
+    {
+        throw std::runtime_error("MappedFile::Open: cannot map " + path);
+    }
+
+    return std::shared_ptr<MappedFile>(new MappedFile(static_cast<std::byte*>(p), size, false));
+}
+
+std::shared_ptr<MappedFile> MappedFile::Create(const std::string& path, std::size_t size)
+{
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0)
+    {
+        throw std::runtime_error("MappedFile::Create: cannot create " + path);
+    }
+
+    if(::ftruncate(fd, size) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("MappedFile::Create: cannot resize " + path);
+    }
+
+    void* p = nullptr;
+
+    if(size > 0)
+    {
+        p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if(p == MAP_FAILED)
+    {
+        throw std::runtime_error("MappedFile::Create: cannot map " + path);
+    }
+
+    return std::shared_ptr<MappedFile>(new MappedFile(static_cast<std::byte*>(p), size, true));
+}
+
+MappedFile::~MappedFile()
+{
+    if(p_data_ != nullptr)
+    {
+        ::munmap(p_data_, size_);
+    }
+}
+
+void MappedFile::Flush()
+{
+    if(writable_ && p_data_ != nullptr && ::msync(p_data_, size_, MS_SYNC) != 0)
+    {
+        throw std::runtime_error("MappedFile::Flush: msync failed");
+    }
+}
+
+// .npy
+namespace {
+
+constexpr char npy_magic[]          = "\x93NUMPY";
+constexpr std::size_t npy_magic_len = 6;
+
+std::string GetNpyDescr(TensorFileDataType type)
+{
+    switch(type)
+    {
+    case TensorFileDataType::F32: return "<f4";
+    case TensorFileDataType::F16: return "<f2";
+    case TensorFileDataType::BF16: return "|V2";
+    case TensorFileDataType::I8: return "|i1";
+    case TensorFileDataType::I32: return "<i4";
+    }
+    throw std::runtime_error("npy: unknown data type");
+}
+
+TensorFileDataType ParseNpyDescr(const std::string& descr)
+{
+    if(descr == "<f4")
+        return TensorFileDataType::F32;
+    if(descr == "<f2")
+        return TensorFileDataType::F16;
+    if(descr == "|V2" || descr == "<V2")
+        return TensorFileDataType::BF16;
+    if(descr == "|i1" || descr == "<i1")
+        return TensorFileDataType::I8;
+    if(descr == "<i4")
+        return TensorFileDataType::I32;
+
+    throw std::runtime_error("npy: unsupported descr " + descr);
+}
+
+// returns the text following "'key':" in a python dict literal
+std::string::size_type FindNpyDictValue(const std::string& dict, const std::string& key)
+{
+    const auto pos = dict.find("'" + key + "'");
+    if(pos == std::string::npos)
+    {
+        throw std::runtime_error("npy: header has no key " + key);
+    }
+
+    auto colon = dict.find(':', pos);
+    if(colon == std::string::npos)
+    {
+        throw std::runtime_error("npy: malformed header");
+    }
+
+    ++colon;
+    while(colon < dict.size() && std::isspace(static_cast<unsigned char>(dict[colon])))
+        ++colon;
+
+    return colon;
+}
+
+} // namespace
+
+NpyHeader ParseNpyHeader(const std::byte* p_data, std::size_t size)
+{
+    const auto* p = reinterpret_cast<const unsigned char*>(p_data);
+
+    if(size < npy_magic_len + 4 || std::memcmp(p, npy_magic, npy_magic_len) != 0)
+    {
+        throw std::runtime_error("npy: bad magic");
+    }
+
+    const unsigned major = p[6];
+
+    std::size_t header_len = 0;
+    std::size_t prefix_len = 0;
+
+    if(major == 1)
+    {
+        header_len = p[8] | (p[9] << 8);
+        prefix_len = 10;
+    }
+    else if(major == 2 || major == 3)
+    {
+        if(size < 12)
+            throw std::runtime_error("npy: truncated header");
+
+        header_len = std::size_t(p[8]) | (std::size_t(p[9]) << 8) | (std::size_t(p[10]) << 16) |
+                     (std::size_t(p[11]) << 24);
+        prefix_len = 12;
+    }
+    else
+    {
+        throw std::runtime_error("npy: unsupported format version");
+    }
+
+    if(prefix_len + header_len > size)
+    {
+        throw std::runtime_error("npy: truncated header");
+    }
+
+    const std::string dict(reinterpret_cast<const char*>(p + prefix_len), header_len);
+
+    NpyHeader header;
+
+    // descr
+    {
+        const auto begin = FindNpyDictValue(dict, "descr") + 1;
+        const auto end   = dict.find_first_of("'\"", begin);
+        header.entry.type = ParseNpyDescr(dict.substr(begin, end - begin));
+    }
+
+    // fortran_order
+    header.fortran_order = dict.compare(FindNpyDictValue(dict, "fortran_order"), 4, "True") == 0;
+
+    // shape
+    {
+        auto pos       = FindNpyDictValue(dict, "shape");
+        const auto end = dict.find(')', pos);
+        if(dict[pos] != '(' || end == std::string::npos)
+        {
+            throw std::runtime_error("npy: malformed shape");
+        }
+
+        std::istringstream is(dict.substr(pos + 1, end - pos - 1));
+        std::string token;
+        while(std::getline(is, token, ','))
+        {
+            if(token.find_first_not_of(" ") != std::string::npos)
+                header.entry.lengths.push_back(std::stoull(token));
+        }
+    }
+
+    header.entry.begin = prefix_len + header_len;
+    header.entry.end   = header.entry.begin + GetTensorFileDataTypeSize(header.entry.type) *
+                                                GetNumElements(header.entry.lengths);
+
+    if(header.entry.end > size)
+    {
+        throw std::runtime_error("npy: file is smaller than its shape");
+    }
+
+    return header;
+}
+
+std::string MakeNpyHeader(TensorFileDataType type, const std::vector<std::size_t>& lengths)
+{
+    std::ostringstream dict;
+
+    dict << "{'descr': '" << GetNpyDescr(type) << "', 'fortran_order': False, 'shape': (";
+    for(auto len : lengths)
+    {
+        dict << len << ", ";
+    }
+    dict << "), }";
+
+    std::string str = dict.str();
+
+    // version 1.0 stores the header length in 2 bytes, 2.0 in 4 bytes
+    const bool v1             = str.size() + 64 + 10 < 65536;
+    const std::size_t prefix  = v1 ? 10 : 12;
+    const std::size_t padding = 64 - (prefix + str.size() + 1) % 64;
+
+    str.append(padding % 64, ' ');
+    str.push_back('\n');
+
+    std::string header(npy_magic, npy_magic_len);
+    header.push_back(v1 ? 1 : 2);
+    header.push_back(0);
+
+    for(std::size_t i = 0; i < prefix - 8; ++i)
+    {
+        header.push_back(static_cast<char>((str.size() >> (8 * i)) & 0xff));
+    }
+
+    return header + str;
+}
+
+// .safetensors
+namespace {
+
+// Minimal JSON reader for safetensors headers: a flat object whose values are either tensor
+// records {"dtype": str, "shape": [int], "data_offsets": [int, int]} or the "__metadata__"
+// object of string pairs.
+struct JsonReader
+{
+    const std::string& s;
+    std::size_t pos = 0;
+
+    void SkipSpace()
+    {
+        while(pos < s.size() && std::isspace(static_cast<unsigned char>(s[pos])))
+            ++pos;
+    }
+
+    void Expect(char c)
+    {
+        SkipSpace();
+        if(pos >= s.size() || s[pos] != c)
+        {
+            throw std::runtime_error(std::string("safetensors: expected '") + c + "' in header");
+        }
+        ++pos;
+    }
+
+    bool Consume(char c)
+    {
+        SkipSpace();
+        if(pos < s.size() && s[pos] == c)
+        {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    std::string ReadString()
+    {
+        Expect('"');
+
+        std::string str;
+        while(pos < s.size() && s[pos] != '"')
+        {
+            if(s[pos] == '\\' && pos + 1 < s.size())
+            {
+                ++pos;
+                switch(s[pos])
+                {
+                case 'n': str.push_back('\n'); break;
+                case 't': str.push_back('\t'); break;
+                case 'r': str.push_back('\r'); break;
+                case 'b': str.push_back('\b'); break;
+                case 'f': str.push_back('\f'); break;
+                case 'u': str.append(s, pos - 1, 6); pos += 4; break;
+                default: str.push_back(s[pos]);
+                }
+            }
+            else
+            {
+                str.push_back(s[pos]);
+            }
+            ++pos;
+        }
+
+        Expect('"');
+        return str;
+    }
+
+    std::size_t ReadUnsigned()
+    {
+        SkipSpace();
+
+        const auto begin = pos;
+        while(pos < s.size() && std::isdigit(static_cast<unsigned char>(s[pos])))
+            ++pos;
+
+        if(begin == pos)
+        {
+            throw std::runtime_error("safetensors: expected an unsigned integer in header");
+        }
+        return std::stoull(s.substr(begin, pos - begin));
+    }
+
+    std::vector<std::size_t> ReadUnsignedArray()
+    {
+        std::vector<std::size_t> values;
+
+        Expect('[');
+        if(Consume(']'))
+            return values;
+
+        do
+        {
+            values.push_back(ReadUnsigned());
+        } while(Consume(','));
+        Expect(']');
+
+        return values;
+    }
+
+    template <typename F>
+    void ReadObject(F&& on_member)
+    {
+        Expect('{');
+        if(Consume('}'))
+            return;
+
+        do
+        {
+            const std::string key = ReadString();
+            Expect(':');
+            on_member(key);
+        } while(Consume(','));
+        Expect('}');
+    }
+};
+
+void AppendJsonString(std::ostringstream& os, const std::string& str)
+{
+    os << '"';
+    for(char c : str)
+    {
+        if(c == '"' || c == '\\')
+            os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+} // namespace
+
+SafeTensorsFile::SafeTensorsFile(const std::string& path) : file_(MappedFile::Open(path))
+{
+    const auto* p = reinterpret_cast<const unsigned char*>(file_->data());
+
+    if(file_->size() < 8)
+    {
+        throw std::runtime_error("safetensors: truncated file " + path);
+    }
+
+    std::size_t header_len = 0;
+    for(int i = 7; i >= 0; --i)
+    {
+        header_len = (header_len << 8) | p[i];
+    }
+
+    if(8 + header_len > file_->size())
+    {
+        throw std::runtime_error("safetensors: truncated header in " + path);
+    }
+
+    const std::size_t data_begin = 8 + header_len;
+    const std::string json(reinterpret_cast<const char*>(p + 8), header_len);
+
+    JsonReader reader{json};
+
+    reader.ReadObject([&](const std::string& name) {
+        if(name == "__metadata__")
+        {
+            reader.ReadObject(
+                [&](const std::string& key) { metadata_[key] = reader.ReadString(); });
+            return;
+        }
+
+        TensorFileEntry entry{};
+        std::vector<std::size_t> offsets;
+
+        reader.ReadObject([&](const std::string& key) {
+            if(key == "dtype")
+                entry.type = ParseTensorFileDataTypeString(reader.ReadString());
+            else if(key == "shape")
+                entry.lengths = reader.ReadUnsignedArray();
+            else if(key == "data_offsets")
+                offsets = reader.ReadUnsignedArray();
+            else
+                throw std::runtime_error("safetensors: unexpected key " + key);
+        });
+
+        if(offsets.size() != 2 || offsets[0] > offsets[1] ||
+           data_begin + offsets[1] > file_->size())
+        {
+            throw std::runtime_error("safetensors: bad data_offsets for " + name);
+        }
+
+        entry.begin = data_begin + offsets[0];
+        entry.end   = data_begin + offsets[1];
+
+        entries_.emplace(name, std::move(entry));
+    });
+}
+
+std::vector<std::string> SafeTensorsFile::GetNames() const
+{
+    std::vector<std::string> names;
+    for(const auto& entry : entries_)
+    {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+const TensorFileEntry& SafeTensorsFile::GetEntry(const std::string& name) const
+{
+    const auto it = entries_.find(name);
+    if(it == entries_.end())
+    {
+        throw std::runtime_error("safetensors: no tensor named " + name);
+    }
+    return it->second;
+}
+
+SafeTensorsWriter::SafeTensorsWriter(const std::string& path,
+                                     const std::vector<TensorDesc>& tensors,
+                                     const std::map<std::string, std::string>& metadata)
+{
+    std::ostringstream json;
+    std::size_t offset = 0;
+
+    json << '{';
+
+    if(!metadata.empty())
+    {
+        json << "\"__metadata__\":{";
+        bool first = true;
+        for(const auto& kv : metadata)
+        {
+            if(!first)
+                json << ',';
+            first = false;
+
+            AppendJsonString(json, kv.first);
+            json << ':';
+            AppendJsonString(json, kv.second);
+        }
+        json << '}';
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> offsets;
+
+    for(const auto& desc : tensors)
+    {
+        const std::size_t bytes =
+            GetTensorFileDataTypeSize(desc.type) * GetNumElements(desc.lengths);
+
+        offsets.emplace_back(offset, offset + bytes);
+
+        if(json.tellp() > 1)
+            json << ',';
+
+        AppendJsonString(json, desc.name);
+        json << ":{\"dtype\":\"" << GetTensorFileDataTypeString(desc.type) << "\",\"shape\":[";
+        for(std::size_t i = 0; i < desc.lengths.size(); ++i)
+        {
+            json << (i == 0 ? "" : ",") << desc.lengths[i];
+        }
+        json << "],\"data_offsets\":[" << offset << ',' << offset + bytes << "]}";
+
+        offset += bytes;
+    }
+
+    json << '}';
+
+    // pad the header so that the data section starts 8-byte aligned
+    std::string header = json.str();
+    header.append((8 - header.size() % 8) % 8, ' ');
+
+    const std::size_t data_begin = 8 + header.size();
+
+    for(std::size_t i = 0; i < tensors.size(); ++i)
+    {
+        if(!entries_
+                .emplace(tensors[i].name,
+                         TensorFileEntry{tensors[i].type,
+                                         tensors[i].lengths,
+                                         data_begin + offsets[i].first,
+                                         data_begin + offsets[i].second})
+                .second)
+        {
+            throw std::runtime_error("SafeTensorsWriter: duplicate tensor " + tensors[i].name);
+        }
+    }
+
+    file_ = MappedFile::Create(path, data_begin + offset);
+
+    auto* p = reinterpret_cast<unsigned char*>(file_->data());
+    for(int i = 0; i < 8; ++i)
+    {
+        p[i] = static_cast<unsigned char>((header.size() >> (8 * i)) & 0xff);
+    }
+    std::copy(header.begin(), header.end(), p + 8);
+}
+
+const TensorFileEntry& SafeTensorsWriter::GetEntry(const std::string& name) const
+{
+    const auto it = entries_.find(name);
+    if(it == entries_.end())
+    {
+        throw std::runtime_error("SafeTensorsWriter: no tensor named " + name);
+    }
+    return it->second;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,480 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/workload_trace.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+// segment header: magic and format version
+constexpr char trace_magic[]           = "CKWT";
+constexpr std::size_t trace_magic_size = 4;
+constexpr uint64_t trace_version       = 1;
+
+// kinds of the entries of a segment
+constexpr unsigned char string_tag = 1;
+constexpr unsigned char record_tag = 2;
+
+void put_varint(std::string& bytes, uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        bytes.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    bytes.push_back(static_cast<char>(value));
+}
+
+void put_signed_varint(std::string& bytes, int64_t value)
+{
+    put_varint(bytes,
+               (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// little endian
+void put_fixed64(std::string& bytes, uint64_t value)
+{
+    for(int i = 0; i < 8; ++i)
+    {
+        bytes.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+void put_double(std::string& bytes, double value)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    put_fixed64(bytes, bits);
+}
+
+class Reader
+{
+    public:
+    explicit Reader(const std::string& bytes) : bytes_{bytes} {}
+
+    bool AtEnd() const { return pos_ == bytes_.size(); }
+
+    bool AtSegmentHeader() const
+    {
+        return bytes_.compare(pos_, trace_magic_size, trace_magic) == 0;
+    }
+
+    void SkipSegmentHeader()
+    {
+        pos_ += trace_magic_size;
+
+        if(GetVarint() != trace_version)
+        {
+            throw std::runtime_error("wrong! unsupported workload trace version");
+        }
+    }
+
+    unsigned char GetByte()
+    {
+        Require(1);
+
+        return static_cast<unsigned char>(bytes_[pos_++]);
+    }
+
+    uint64_t GetVarint()
+    {
+        uint64_t value = 0;
+
+        for(int shift = 0; shift < 64; shift += 7)
+        {
+            const unsigned char byte = GetByte();
+
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+
+            if((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error("wrong! malformed varint in workload trace");
+    }
+
+    int64_t GetSignedVarint()
+    {
+        const uint64_t value = GetVarint();
+
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    uint64_t GetFixed64()
+    {
+        Require(8);
+
+        uint64_t value = 0;
+
+        for(int i = 0; i < 8; ++i)
+        {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes_[pos_++])) << (8 * i);
+        }
+
+        return value;
+    }
+
+    double GetDouble()
+    {
+        const uint64_t bits = GetFixed64();
+
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        return value;
+    }
+
+    std::string GetString()
+    {
+        const uint64_t size = GetVarint();
+
+        Require(size);
+
+        std::string str = bytes_.substr(pos_, size);
+
+        pos_ += size;
+
+        return str;
+    }
+
+    // a count of elements of at least one byte each
+    uint64_t GetCount()
+    {
+        const uint64_t count = GetVarint();
+
+        Require(count);
+
+        return count;
+    }
+
+    private:
+    void Require(uint64_t size) const
+    {
+        if(size > bytes_.size() - pos_)
+        {
+            throw std::runtime_error("wrong! truncated workload trace");
+        }
+    }
+
+    const std::string& bytes_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace
+
+WorkloadTraceEncoder::WorkloadTraceEncoder()
+{
+    bytes_.append(trace_magic, trace_magic_size);
+
+    put_varint(bytes_, trace_version);
+}
+
+uint64_t WorkloadTraceEncoder::GetStringIndex(const std::string& str)
+{
+    const auto [it, is_new] = string_indices_.emplace(str, string_indices_.size());
+
+    if(is_new)
+    {
+        bytes_.push_back(static_cast<char>(string_tag));
+
+        put_varint(bytes_, str.size());
+
+        bytes_ += str;
+    }
+
+    return it->second;
+}
+
+void WorkloadTraceEncoder::Encode(const WorkloadRecord& record)
+{
+    const uint64_t operation_index = GetStringIndex(record.operation_);
+    const uint64_t instance_index  = GetStringIndex(record.instance_);
+
+    bytes_.push_back(static_cast<char>(record_tag));
+
+    put_varint(bytes_, operation_index);
+
+    put_varint(bytes_, record.problem_.size());
+
+    for(const int64_t value : record.problem_)
+    {
+        put_signed_varint(bytes_, value);
+    }
+
+    put_varint(bytes_, record.parameters_.size());
+
+    for(const double value : record.parameters_)
+    {
+        put_double(bytes_, value);
+    }
+
+    put_varint(bytes_, instance_index);
+    put_fixed64(bytes_, record.instance_id_);
+    put_double(bytes_, record.ave_time_ms_);
+}
+
+std::string WorkloadTraceEncoder::Flush() { return std::exchange(bytes_, std::string{}); }
+
+std::string EncodeWorkloadTrace(const std::vector<WorkloadRecord>& records)
+{
+    WorkloadTraceEncoder encoder;
+
+    for(const auto& record : records)
+    {
+        encoder.Encode(record);
+    }
+
+    return encoder.Flush();
+}
+
+std::vector<WorkloadRecord> DecodeWorkloadTrace(const std::string& bytes)
+{
+    std::vector<WorkloadRecord> records;
+
+    Reader reader{bytes};
+
+    if(!reader.AtEnd() && !reader.AtSegmentHeader())
+    {
+        throw std::runtime_error("wrong! not a workload trace");
+    }
+
+    std::vector<std::string> strings;
+
+    auto f_get_string = [&] {
+        const uint64_t index = reader.GetVarint();
+
+        if(index >= strings.size())
+        {
+            throw std::runtime_error("wrong! undefined string in workload trace");
+        }
+
+        return strings[index];
+    };
+
+    while(!reader.AtEnd())
+    {
+        if(reader.AtSegmentHeader())
+        {
+            reader.SkipSegmentHeader();
+
+            strings.clear();
+
+            continue;
+        }
+
+        const unsigned char tag = reader.GetByte();
+
+        if(tag == string_tag)
+        {
+            strings.push_back(reader.GetString());
+        }
+        else if(tag == record_tag)
+        {
+            WorkloadRecord record;
+
+            record.operation_ = f_get_string();
+
+            record.problem_.resize(reader.GetCount());
+
+            for(auto& value : record.problem_)
+            {
+                value = reader.GetSignedVarint();
+            }
+
+            record.parameters_.resize(reader.GetCount());
+
+            for(auto& value : record.parameters_)
+            {
+                value = reader.GetDouble();
+            }
+
+            record.instance_    = f_get_string();
+            record.instance_id_ = reader.GetFixed64();
+            record.ave_time_ms_ = reader.GetDouble();
+
+            records.push_back(std::move(record));
+        }
+        else
+        {
+            throw std::runtime_error("wrong! unknown entry in workload trace");
+        }
+    }
+
+    return records;
+}
+
+std::vector<WorkloadRecord> LoadWorkloadTrace(const std::string& path)
+{
+    std::ifstream is(path, std::ios::binary);
+
+    if(!is)
+    {
+        throw std::runtime_error("wrong! cannot read " + path);
+    }
+
+    const std::string bytes{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+
+    return DecodeWorkloadTrace(bytes);
+}
+
+WorkloadTraceWriter::WorkloadTraceWriter(const std::string& path)
+    : file_{path, std::ios::binary | std::ios::app}
+{
+    if(!file_)
+    {
+        throw std::runtime_error("wrong! cannot write " + path);
+    }
+}
+
+WorkloadTraceWriter::~WorkloadTraceWriter() { Flush(); }
+
+void WorkloadTraceWriter::Write(const WorkloadRecord& record)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    encoder_.Encode(record);
+
+    if(encoder_.GetNumBytes() >= max_buffered_bytes)
+    {
+        FlushLocked();
+    }
+}
+
+void WorkloadTraceWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    FlushLocked();
+}
+
+void WorkloadTraceWriter::FlushLocked()
+{
+    const std::string bytes = encoder_.Flush();
+
+    file_.write(bytes.data(), bytes.size());
+    file_.flush();
+}
+
+WorkloadTraceWriter* GetWorkloadTraceWriter()
+{
+    static const std::unique_ptr<WorkloadTraceWriter> writer = [] {
+        const char* path = std::getenv("CK_WORKLOAD_TRACE");
+
+        return path != nullptr && *path != '\0' ? std::make_unique<WorkloadTraceWriter>(path)
+                                                : nullptr;
+    }();
+
+    return writer.get();
+}
+
+std::vector<WorkloadReplayItem> PlanWorkloadReplay(const std::vector<WorkloadRecord>& records)
+{
+    std::vector<WorkloadReplayItem> items;
+
+    std::map<std::tuple<std::string, std::vector<int64_t>, std::vector<double>>, std::size_t>
+        item_indices;
+
+    for(const auto& record : records)
+    {
+        const auto [it, is_new] = item_indices.emplace(
+            std::make_tuple(record.operation_, record.problem_, record.parameters_),
+            items.size());
+
+        if(is_new)
+        {
+            items.push_back({record, 0, 0, {}});
+        }
+
+        auto& item = items[it->second];
+
+        item.num_calls_ += 1;
+        item.total_time_ms_ += record.ave_time_ms_;
+
+        if(std::find(item.instance_ids_.begin(), item.instance_ids_.end(), record.instance_id_) ==
+           item.instance_ids_.end())
+        {
+            item.instance_ids_.push_back(record.instance_id_);
+        }
+    }
+
+    std::stable_sort(items.begin(), items.end(), [](const auto& a, const auto& b) {
+        return std::make_tuple(a.total_time_ms_, a.num_calls_) >
+               std::make_tuple(b.total_time_ms_, b.num_calls_);
+    });
+
+    return items;
+}
+
+std::vector<std::vector<std::string>>
+MakeWorkloadReplayCommands(const std::vector<WorkloadReplayItem>& items,
+                           const WorkloadReplayOptions& options)
+{
+    // problem values before the run options
+    constexpr std::size_t num_leading_values = 2;
+
+    std::vector<std::vector<std::string>> commands;
+
+    for(const auto& item : items)
+    {
+        const auto& problem = item.record_.problem_;
+
+        if(problem.size() < num_leading_values)
+        {
+            throw std::runtime_error("wrong! workload record of " + item.record_.operation_ +
+                                     " has too short a problem");
+        }
+
+        std::vector<std::string> command{"ckProfiler", item.record_.operation_};
+
+        for(std::size_t i = 0; i < num_leading_values; ++i)
+        {
+            command.push_back(std::to_string(problem[i]));
+        }
+
+        command.push_back(std::to_string(options.do_verification_));
+        command.push_back(std::to_string(options.init_method_));
+        command.push_back(std::to_string(options.do_log_));
+        command.push_back(std::to_string(options.time_kernel_));
+
+        for(std::size_t i = num_leading_values; i < problem.size(); ++i)
+        {
+            command.push_back(std::to_string(problem[i]));
+        }
+
+        if(options.all_instances_)
+        {
+            commands.push_back(command);
+        }
+        else
+        {
+            for(const uint64_t instance_id : item.instance_ids_)
+            {
+                commands.push_back(command);
+                commands.back().push_back(std::to_string(instance_id));
+            }
+        }
+    }
+
+    return commands;
+}
+
+} // namespace utils
+} // namespace ck
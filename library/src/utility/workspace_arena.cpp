@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+
+#include "ck/host_utility/trace.hpp"
+
+#include "ck/library/utility/workspace_arena.hpp"
+
+namespace ck {
+namespace utils {
+
+WorkspaceArena::WorkspaceArena(DeviceMemoryAllocator& allocator, hipStream_t stream)
+    : allocator_{allocator}, stream_{stream}
+{
+}
+
+WorkspaceArena::~WorkspaceArena() { FreeAll(); }
+
+void* WorkspaceArena::Reserve(std::size_t size)
+{
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    const std::size_t aligned_size = GetAlignedSize(size);
+
+    // the first region since the buffer was allocated or grown
+    if(p_buffer_ == nullptr && overflow_blocks_.empty())
+    {
+        capacity_ = std::max(capacity_, aligned_size);
+        p_buffer_ = Allocate(capacity_);
+
+        CK_TRACE_COUNTER("memory", "workspace_arena_capacity", capacity_);
+    }
+
+    void* p = nullptr;
+
+    if(p_buffer_ != nullptr && aligned_size <= capacity_ - offset_)
+    {
+        p = static_cast<char*>(p_buffer_) + offset_;
+
+        offset_ += aligned_size;
+    }
+    else
+    {
+        // until Reset() grows the buffer
+        p = Allocate(aligned_size);
+
+        overflow_blocks_.push_back(p);
+    }
+
+    bytes_reserved_ += aligned_size;
+
+    return p;
+}
+
+void* WorkspaceArena::Reserve(const tensor_operation::device::BaseOperator& op,
+                              tensor_operation::device::BaseArgument* p_arg)
+{
+    void* p = Reserve(op.GetWorkSpaceSize(p_arg));
+
+    op.SetWorkSpacePointer(p_arg, p);
+
+    return p;
+}
+
+void WorkspaceArena::Reset()
+{
+    // a sequence only overflows when it reserved more than the capacity
+    if(!overflow_blocks_.empty())
+    {
+        FreeAll();
+
+        capacity_ = bytes_reserved_;
+    }
+
+    offset_         = 0;
+    bytes_reserved_ = 0;
+}
+
+void* WorkspaceArena::Allocate(std::size_t size)
+{
+    void* p = allocator_.Allocate(size, stream_);
+
+    num_allocations_ += 1;
+
+    return p;
+}
+
+void WorkspaceArena::FreeAll()
+{
+    for(void* p : overflow_blocks_)
+    {
+        allocator_.Free(p);
+    }
+
+    overflow_blocks_.clear();
+
+    if(p_buffer_ != nullptr)
+    {
+        allocator_.Free(p_buffer_);
+
+        p_buffer_ = nullptr;
+    }
+}
+
+} // namespace utils
+} // namespace ck
@@ -14,6 +14,8 @@ enum struct DataTypeEnum
     Int8x4   = 4,
     BFloat16 = 5,
     Double   = 6,
+    Float8   = 7, // E4M3, ck::f8_t
+    BFloat8  = 8, // E5M2, ck::bf8_t
     Unknown  = 100,
 };
 
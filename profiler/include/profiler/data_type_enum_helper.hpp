@@ -41,6 +41,18 @@ struct get_datatype_from_enum<DataTypeEnum::Double>
     using type = double;
 };
 
+template <>
+struct get_datatype_from_enum<DataTypeEnum::Float8>
+{
+    using type = f8_t;
+};
+
+template <>
+struct get_datatype_from_enum<DataTypeEnum::BFloat8>
+{
+    using type = bf8_t;
+};
+
 template <typename T>
 struct get_datatype_enum_from_type;
 
@@ -74,4 +86,16 @@ struct get_datatype_enum_from_type<double>
     static constexpr DataTypeEnum value = DataTypeEnum::Double;
 };
 
+template <>
+struct get_datatype_enum_from_type<f8_t>
+{
+    static constexpr DataTypeEnum value = DataTypeEnum::Float8;
+};
+
+template <>
+struct get_datatype_enum_from_type<bf8_t>
+{
+    static constexpr DataTypeEnum value = DataTypeEnum::BFloat8;
+};
+
 } // namespace ck
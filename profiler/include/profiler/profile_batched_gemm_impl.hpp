@@ -17,6 +17,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
 namespace ck {
@@ -113,7 +114,18 @@ bool profile_batched_gemm_impl(int do_verification,
         auto ref_argument = ref_batched_gemm.MakeArgument(
             a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        auto make_ref_key = [&]() {
+            return ck::utils::ReferenceCacheKey::Make<ReferenceBatchedGemmInstance>().AddAll(
+                a_element_op,
+                b_element_op,
+                c_element_op,
+                a_g_m_k,
+                b_g_k_n,
+                c_g_m_n_host_result.mDesc);
+        };
+
+        ck::utils::run_reference_cached(
+            make_ref_key, c_g_m_n_host_result, [&]() { ref_invoker.Run(ref_argument); });
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
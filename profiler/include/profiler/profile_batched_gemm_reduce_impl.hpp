@@ -16,6 +16,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -138,9 +139,6 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
     auto c_element_op                     = CElementOp{};
     std::array<void*, 3> gemm_element_ops = {&a_element_op, &b_element_op, &c_element_op};
 
-    const auto reduce0_op = ReduceOp0{};
-    const auto reduce1_op = ReduceOp1{};
-
     auto passthrough                            = UnaryIdenticElementOp{};
     auto square                                 = UnarySquareElementOp{};
     std::array<void*, 2> reduce_in_element_ops  = {&passthrough, &square};
@@ -167,28 +165,22 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
 
         ref_invoker.Run(ref_argument);
 
-        for(int batch = 0; batch < BatchCount; ++batch)
-        {
-            for(int m = 0; m < M; ++m)
-            {
-                auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
-                auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ReduceAccDataType d0_val =
-                        ck::type_convert<ReduceAccDataType>(c_g_m_n_host_result(batch, m, n));
-                    ReduceAccDataType d1_val;
-
-                    square(d1_val, d0_val);
-                    reduce0_op(reduce0_acc, d0_val);
-                    reduce1_op(reduce1_acc, d1_val);
-                }
-
-                d0_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce0_acc);
-                d1_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce1_acc);
-            }
-        }
+        using ReferenceReduceInstance = ck::tensor_operation::host::ReferenceMultipleReduce<
+            CDataType,
+            ReduceAccDataType,
+            ck::Tuple<ReduceDataType, ReduceDataType>,
+            ck::Tuple<ReduceOp0, ReduceOp1>,
+            ck::Tuple<UnaryIdenticElementOp, UnarySquareElementOp>,
+            ck::Tuple<UnaryIdenticElementOp, UnaryIdenticElementOp>>;
+
+        auto ref_reduce = ReferenceReduceInstance{};
+
+        ref_reduce.MakeInvoker().Run(
+            ref_reduce.MakeArgument(c_g_m_n_host_result,
+                                    {d0_g_m_host_result, d1_g_m_host_result},
+                                    {2},
+                                    ck::make_tuple(passthrough, square),
+                                    ck::make_tuple(passthrough, passthrough)));
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
@@ -14,6 +14,7 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_permute.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
@@ -199,16 +200,16 @@ bool profile_batched_gemm_softmax_gemm_permute_impl(bool do_verification,
         Tensor<ADataType> a1_g_m_n({BatchCount, M, N});            // scratch object after softmax
         Tensor<CDataType> c_g_m_o_host_result({BatchCount, M, O}); // scratch object after gemm1
 
-        // permute
-        a_gs_ms_ks.ForEach([&](auto& self, auto idx) {
-            a_g_m_k(idx[0] * G1 + idx[1], idx[2], idx[3]) = self(idx);
-        });
-        b0_gs_ns_ks.ForEach([&](auto& self, auto idx) {
-            b0_g_k_n(idx[0] * G1 + idx[1], idx[3], idx[2]) = self(idx);
-        });
-        b1_gs_os_ns.ForEach([&](auto& self, auto idx) {
-            b1_g_n_o(idx[0] * G1 + idx[1], idx[3], idx[2]) = self(idx);
-        });
+        // permute, the gs_ms_ks tensors are viewed in the g_m_k order of the reference gemms
+        const auto b0_gs_ks_ns = make_tensor_view(b0_gs_ns_ks).Permute({0, 1, 3, 2});
+        const auto b1_gs_ns_os = make_tensor_view(b1_gs_os_ns).Permute({0, 1, 3, 2});
+
+        ck::utils::host_permute(
+            a_gs_ms_ks, make_tensor_view(a_g_m_k).Reshape(a_gs_ms_ks.mDesc.GetLengths()));
+        ck::utils::host_permute(b0_gs_ks_ns,
+                                make_tensor_view(b0_g_k_n).Reshape(b0_gs_ks_ns.GetLengths()));
+        ck::utils::host_permute(b1_gs_ns_os,
+                                make_tensor_view(b1_g_n_o).Reshape(b1_gs_ns_os.GetLengths()));
 
         auto ref_gemm0          = ReferenceGemm0Instance{};
         auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
@@ -237,14 +238,8 @@ bool profile_batched_gemm_softmax_gemm_permute_impl(bool do_verification,
         ref_gemm1_invoker.Run(ref_gemm1_argument);
 
         // permute
-        c_gs_ms_os_host_result.ForEach([&](auto& self, auto idx) {
-            const size_t& g0 = idx[0];
-            const size_t& g1 = idx[1];
-
-            const size_t g = g0 * G1 + g1;
-
-            self(idx) = c_g_m_o_host_result(g, idx[2], idx[3]);
-        });
+        ck::utils::host_permute(make_tensor_view(c_g_m_o_host_result).Reshape(c_gs_ms_os_lengths),
+                                c_gs_ms_os_host_result);
     }
 
     std::string best_op_name;
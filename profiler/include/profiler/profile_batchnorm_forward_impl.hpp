@@ -12,6 +12,7 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/workspace_arena.hpp"
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_forward.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_forward.hpp"
 
@@ -261,6 +262,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
     int num_kernel = 0;
     bool pass      = true;
 
+    ck::utils::WorkspaceArena workspace_arena;
+
     for(auto& inst_ptr : instance_ptrs)
     {
         auto argument_ptr = inst_ptr->MakeArgumentPointer(
@@ -299,11 +302,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
             continue;
         };
 
-        size_t workspace_sz = inst_ptr->GetWorkSpaceSize(argument_ptr.get());
-
-        DeviceMem workspace_dev(workspace_sz);
-
-        inst_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
+        workspace_arena.Reset();
+        workspace_arena.Reserve(*inst_ptr, argument_ptr.get());
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
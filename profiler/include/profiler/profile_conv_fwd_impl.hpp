@@ -20,6 +20,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
 
 namespace ck {
@@ -106,10 +107,26 @@ bool profile_conv_fwd_impl(int do_verification,
                                                   wei_element_op,
                                                   out_element_op);
 
-        // init host output to zero
-        host_output.SetZero();
-
-        ref_invoker.Run(ref_argument);
+        auto make_ref_key = [&]() {
+            return ck::utils::ReferenceCacheKey::Make<decltype(ref_conv)>().AddAll(
+                conv_param.conv_filter_strides_,
+                conv_param.conv_filter_dilations_,
+                conv_param.input_left_pads_,
+                conv_param.input_right_pads_,
+                in_element_op,
+                wei_element_op,
+                out_element_op,
+                input,
+                weight,
+                host_output.mDesc);
+        };
+
+        ck::utils::run_reference_cached(make_ref_key, host_output, [&]() {
+            // init host output to zero
+            host_output.SetZero();
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceConvFwd<NDimSpatial,
@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <string>
 #include <typeinfo>
 
 #include "ck/ck.hpp"
+#include "ck/host_utility/trace.hpp"
+#include "ck/utility/span.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
@@ -16,14 +21,35 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/gemm_perf_model.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
 namespace ck {
 namespace profiler {
 
+// the current device, as seen by the GEMM perf model
+inline utils::GemmPerfDevice get_gemm_perf_device()
+{
+    hipDeviceProp_t props{};
+    int device = 0;
+
+    utils::GemmPerfDevice perf_device;
+
+    if(hipGetDevice(&device) == hipSuccess &&
+       hipGetDeviceProperties(&props, device) == hipSuccess)
+    {
+        perf_device.num_cu_             = props.multiProcessorCount;
+        perf_device.max_threads_per_cu_ = props.maxThreadsPerMultiProcessor;
+        perf_device.lds_bytes_per_cu_   = props.maxSharedMemoryPerMultiProcessor;
+    }
+
+    return perf_device;
+}
+
 template <typename ALayout,
           typename BLayout,
           typename CLayout,
@@ -40,7 +66,8 @@ int profile_gemm_impl(int do_verification,
                       int K,
                       int StrideA,
                       int StrideB,
-                      int StrideC)
+                      int StrideC,
+                      uint64_t instance_id = 0)
 {
     bool pass = true;
 
@@ -91,8 +118,10 @@ int profile_gemm_impl(int do_verification,
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
     DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
 
-    a_device_buf.ToDevice(a_m_k.mData.data());
-    b_device_buf.ToDevice(b_k_n.mData.data());
+    auto& transfer_engine = ck::utils::GetDefaultTransferEngine();
+
+    a_device_buf.ToDevice(a_m_k.mData.data(), transfer_engine);
+    b_device_buf.ToDevice(b_k_n.mData.data(), transfer_engine);
 
     using DeviceOp = ck::tensor_operation::device::DeviceGemm<ALayout,
                                                               BLayout,
@@ -104,15 +133,23 @@ int profile_gemm_impl(int do_verification,
                                                               BElementOp,
                                                               CElementOp>;
 
-    // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    using DeviceOpFactory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>;
 
-    std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
+    // get device op instances, each constructed when it is profiled
+    const auto& op_descs = DeviceOpFactory::GetInstanceDescriptors();
+
+    // timings to calibrate ck::utils::GemmPerfModel with
+    const char* perf_records_path = std::getenv("CK_GEMM_PERF_RECORDS");
+    const auto perf_device        = get_gemm_perf_device();
+
+    std::cout << "found " << op_descs.size() << " instances" << std::endl;
 
     // Run reference op
     if(do_verification)
     {
+        CK_TRACE_ZONE(zone, "profiler", "reference");
+
         using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
                                                                                 BDataType,
                                                                                 CDataType,
@@ -127,7 +164,13 @@ int profile_gemm_impl(int do_verification,
         auto ref_argument = ref_op.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        auto make_ref_key = [&]() {
+            return ck::utils::ReferenceCacheKey::Make<ReferenceGemmInstance>().AddAll(
+                a_element_op, b_element_op, c_element_op, a_m_k, b_k_n, c_m_n_host_result.mDesc);
+        };
+
+        ck::utils::run_reference_cached(
+            make_ref_key, c_m_n_host_result, [&]() { ref_invoker.Run(ref_argument); });
     }
 
     std::string best_op_name;
@@ -136,8 +179,19 @@ int profile_gemm_impl(int do_verification,
     float best_gb_per_sec = 0;
 
     // profile device op instances
-    for(auto& op_ptr : op_ptrs)
+    for(std::size_t i = 0; i < op_descs.size(); ++i)
     {
+        // only the instance asked for, if any
+        if(instance_id != 0 && op_descs[i]->GetInstanceId() != instance_id)
+        {
+            continue;
+        }
+
+        const auto op_ptr = op_descs[i]->MakeInstance();
+
+        CK_TRACE_ZONE(zone, "profiler", "profile instance");
+        zone.SetDetail(op_ptr->GetTypeString());
+
         auto argument_ptr =
             op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
                                         static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
@@ -176,6 +230,33 @@ int profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            zone.AddArg("ave_time_ms", avg_time);
+            zone.AddArg("tflops", tflops);
+            zone.AddArg("gb_per_sec", gb_per_sec);
+            CK_TRACE_COUNTER("profiler", "tflops", tflops);
+
+            if(perf_records_path != nullptr && time_kernel)
+            {
+                utils::GemmPerfRecord record;
+
+                record.problem_.M_               = M;
+                record.problem_.N_               = N;
+                record.problem_.K_               = K;
+                record.problem_.a_element_bytes_ = sizeof(ADataType);
+                record.problem_.b_element_bytes_ = sizeof(BDataType);
+                record.problem_.c_element_bytes_ = sizeof(CDataType);
+                record.problem_.a_layout_        = ALayout::name;
+                record.problem_.b_layout_        = BLayout::name;
+                record.problem_.c_layout_        = CLayout::name;
+
+                record.device_      = perf_device;
+                record.tile_        = op_descs[i]->GetTile();
+                record.instance_id_ = op_descs[i]->GetInstanceId();
+                record.ave_time_ms_ = avg_time;
+
+                utils::AppendGemmPerfRecord(perf_records_path, record);
+            }
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
@@ -186,9 +267,22 @@ int profile_gemm_impl(int do_verification,
 
             if(do_verification)
             {
-                c_device_buf.FromDevice(c_m_n_device_result.mData.data());
-
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                // chunk by chunk, while the next is copied
+                c_device_buf.FromDevice(
+                    c_m_n_device_result.mData.data(),
+                    transfer_engine,
+                    [&](std::size_t offset, std::size_t size) {
+                        const std::size_t first = offset / sizeof(CDataType);
+                        const std::size_t n     = size / sizeof(CDataType);
+
+                        pass = pass & ck::utils::check_err(
+                                          ck::span<const CDataType>{
+                                              c_m_n_device_result.mData.data() + first, n},
+                                          ck::span<const CDataType>{
+                                              c_m_n_host_result.mData.data() + first, n},
+                                          "Error: Incorrect results! From element " +
+                                              std::to_string(first) + ":");
+                    });
 
                 if(do_log)
                 {
@@ -19,6 +19,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
 namespace ck {
@@ -129,7 +130,13 @@ bool profile_gemm_splitk_impl(int do_verification,
         auto ref_argument = ref_gemm.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        auto make_ref_key = [&]() {
+            return ck::utils::ReferenceCacheKey::Make<ReferenceGemmInstance>().AddAll(
+                a_element_op, b_element_op, c_element_op, a_m_k, b_k_n, c_m_n_host_result.mDesc);
+        };
+
+        ck::utils::run_reference_cached(
+            make_ref_key, c_m_n_host_result, [&]() { ref_invoker.Run(ref_argument); });
     }
 
     std::string best_op_name;
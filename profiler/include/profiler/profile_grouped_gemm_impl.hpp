@@ -18,7 +18,8 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/utility/workspace_arena.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
 
 namespace ck {
 namespace profiler {
@@ -108,10 +109,54 @@ bool profile_grouped_gemm_impl(int do_verification,
     const auto b_element_op = BElementOp{};
     const auto c_element_op = CElementOp{};
 
-    // if(do_verification)
-    // {
+    std::vector<Tensor<CDataType>> c_m_n_host_results;
 
-    // }
+    if(do_verification)
+    {
+        std::vector<const ADataType*> p_a_host;
+        std::vector<const BDataType*> p_b_host;
+        std::vector<CDataType*> p_c_host;
+        std::vector<ck::tensor_operation::device::GemmDesc> host_gemm_descs;
+
+        c_m_n_host_results.reserve(group_count);
+
+        for(std::size_t i = 0; i < group_count; i++)
+        {
+            c_m_n_host_results.push_back(
+                Tensor<CDataType>(f_host_tensor_descriptor(Ms[i], Ns[i], StrideCs[i], CLayout{})));
+
+            p_a_host.push_back(a_m_k[i].data());
+            p_b_host.push_back(b_k_n[i].data());
+            p_c_host.push_back(c_m_n_host_results[i].data());
+
+            host_gemm_descs.push_back(
+                {Ms[i], Ns[i], Ks[i], StrideAs[i], StrideBs[i], StrideCs[i], {}});
+        }
+
+        // computed once for all instances, all groups in one flop-balanced pass
+        using ReferenceGroupedGemmInstance =
+            ck::tensor_operation::host::ReferenceGroupedGemm<ALayout,
+                                                             BLayout,
+                                                             CLayout,
+                                                             ADataType,
+                                                             BDataType,
+                                                             CDataType,
+                                                             AccDataType,
+                                                             AElementOp,
+                                                             BElementOp,
+                                                             CElementOp>;
+
+        auto ref_gemm    = ReferenceGroupedGemmInstance{};
+        auto ref_invoker = ref_gemm.MakeInvoker();
+
+        ref_invoker.Run(ref_gemm.MakeArgument(p_a_host,
+                                              p_b_host,
+                                              p_c_host,
+                                              host_gemm_descs,
+                                              a_element_op,
+                                              b_element_op,
+                                              c_element_op));
+    }
 
     using DeviceMemPtr = std::unique_ptr<DeviceMem>;
     std::vector<DeviceMemPtr> a_device_buf, b_device_buf, c_device_buf;
@@ -180,6 +225,8 @@ bool profile_grouped_gemm_impl(int do_verification,
     auto p_ds = std::vector<std::array<const void*, 0>>{};
 
     // profile device GEMM instances
+    ck::utils::WorkspaceArena workspace_arena;
+
     for(auto& gemm_ptr : op_ptrs)
     {
         auto argument_ptr =
@@ -194,9 +241,8 @@ bool profile_grouped_gemm_impl(int do_verification,
 
         auto invoker_ptr = gemm_ptr->MakeInvokerPointer();
 
-        DeviceMem gemm_desc_workspace(gemm_ptr->GetWorkSpaceSize(argument_ptr.get()));
-
-        gemm_ptr->SetWorkSpacePointer(argument_ptr.get(), gemm_desc_workspace.GetDeviceBuffer());
+        workspace_arena.Reset();
+        workspace_arena.Reserve(*gemm_ptr, argument_ptr.get());
 
         if(gemm_ptr->IsSupportedArgument(argument_ptr.get()))
         {
@@ -235,30 +281,8 @@ bool profile_grouped_gemm_impl(int do_verification,
 
                     c_device_buf[i]->FromDevice(c_m_n_device_results[i].mData.data());
 
-                    Tensor<CDataType> c_m_n_host_result(
-                        f_host_tensor_descriptor(Ms[i], Ns[i], StrideCs[i], CLayout{}));
-
-                    using ReferenceGemmInstance =
-                        ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                  BDataType,
-                                                                  CDataType,
-                                                                  AccDataType,
-                                                                  AElementOp,
-                                                                  BElementOp,
-                                                                  CElementOp>;
-
-                    auto ref_gemm    = ReferenceGemmInstance{};
-                    auto ref_invoker = ref_gemm.MakeInvoker();
-
-                    auto ref_argument = ref_gemm.MakeArgument(a_m_k[i],
-                                                              b_k_n[i],
-                                                              c_m_n_host_result,
-                                                              a_element_op,
-                                                              b_element_op,
-                                                              c_element_op);
-
-                    ref_invoker.Run(ref_argument);
-                    pass = pass && ck::utils::check_err(c_m_n_device_results[i], c_m_n_host_result);
+                    pass = pass &&
+                           ck::utils::check_err(c_m_n_device_results[i], c_m_n_host_results[i]);
 
                     if(do_log)
                     {
@@ -269,7 +293,7 @@ bool profile_grouped_gemm_impl(int do_verification,
                             std::cout << "c_device: ", c_m_n_device_results[i].mData, ",")
                             << std::endl;
                         LogRangeAsType<float>(
-                            std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
+                            std::cout << "c_host  : ", c_m_n_host_results[i].mData, ",")
                             << std::endl;
                     }
                 }
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+enum struct GemmMatrixLayout
+{
+    MK_KN_MN, // 0
+    MK_NK_MN, // 1
+    KM_KN_MN, // 2
+    KM_NK_MN, // 3
+};
+
+enum struct GemmDataType
+{
+    F32_F32_F32,    // 0
+    F16_F16_F16,    // 1
+    BF16_BF16_BF16, // 2
+    INT8_INT8_INT8, // 3
+};
+
+#define OP_NAME "gemm_instances"
+#define OP_DESC "GEMM instance enumeration"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: data type (0: fp32; 1: fp16; 2: bf16; 3: int8)\n"
+              << "arg3: matrix layout (0: A[m, k] * B[k, n] = C[m, n];\n"
+              << "                     1: A[m, k] * B[n, k] = C[m, n];\n"
+              << "                     2: A[k, m] * B[k, n] = C[m, n];\n"
+              << "                     3: A[k, m] * B[n, k] = C[m, n])\n"
+              << "arg4: print instances (0: no; 1: yes)\n"
+              << std::endl;
+}
+
+// Time to enumerate the instances of the GEMM instance factory: the descriptors, collected on
+// first use and cached, against GetInstances(), which constructs every instance on every call.
+int profile_gemm_instances(int argc, char* argv[])
+{
+    if(argc != 5)
+    {
+        print_helper_msg();
+        exit(1);
+    }
+
+    const auto data_type = static_cast<GemmDataType>(std::stoi(argv[2]));
+    const auto layout    = static_cast<GemmMatrixLayout>(std::stoi(argv[3]));
+    const bool do_log    = std::stoi(argv[4]);
+
+    using F32  = float;
+    using F16  = ck::half_t;
+    using BF16 = ck::bhalf_t;
+    using INT8 = int8_t;
+
+    using Row = ck::tensor_layout::gemm::RowMajor;
+    using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+    auto f_time_ms = [](auto f) {
+        const auto start = std::chrono::steady_clock::now();
+
+        f();
+
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    };
+
+    auto profile = [&](auto a_layout, auto b_layout, auto c_layout, auto data) {
+        using DataType = decltype(data);
+
+        using DeviceOp = ck::tensor_operation::device::DeviceGemm<decltype(a_layout),
+                                                                  decltype(b_layout),
+                                                                  decltype(c_layout),
+                                                                  DataType,
+                                                                  DataType,
+                                                                  DataType,
+                                                                  PassThrough,
+                                                                  PassThrough,
+                                                                  PassThrough>;
+
+        using Factory =
+            ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>;
+
+        std::size_t num_instances = 0;
+
+        const float describe_ms =
+            f_time_ms([&] { num_instances = Factory::GetInstanceDescriptors().size(); });
+
+        const float describe_again_ms = f_time_ms([&] { Factory::GetInstanceDescriptors(); });
+
+        const float make_one_ms = f_time_ms([&] {
+            if(num_instances > 0)
+            {
+                Factory::MakeInstance(num_instances - 1);
+            }
+        });
+
+        const float make_all_ms = f_time_ms([&] { Factory::GetInstances(); });
+
+        std::cout << "instances: " << num_instances << std::endl;
+        std::cout << "GetInstanceDescriptors(), first call: " << describe_ms << " ms" << std::endl;
+        std::cout << "GetInstanceDescriptors(), cached: " << describe_again_ms << " ms"
+                  << std::endl;
+        std::cout << "MakeInstance(): " << make_one_ms << " ms" << std::endl;
+        std::cout << "GetInstances(): " << make_all_ms << " ms" << std::endl;
+
+        if(do_log)
+        {
+            const auto& descs = Factory::GetInstanceDescriptors();
+
+            for(std::size_t id = 0; id < descs.size(); ++id)
+            {
+                const auto& tile         = descs[id]->GetTile();
+                const auto& capabilities = descs[id]->GetCapabilities();
+
+                std::cout << id << ": block " << tile.block_size_ << ", tile " << tile.m_per_block_
+                          << "x" << tile.n_per_block_ << "x" << tile.k_per_block_ << ", "
+                          << ck::tensor_operation::device::getGemmSpecializationString(
+                                 capabilities.gemm_spec_)
+                          << ", " << descs[id]->GetTypeString() << std::endl;
+            }
+        }
+
+        return 0;
+    };
+
+    if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, F32{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, F16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, BF16{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, INT8{});
+    }
+    else
+    {
+        std::cout << "this data_type & layout is not implemented" << std::endl;
+
+        return 1;
+    }
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_gemm_instances);
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/workload_trace.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "replay"
+#define OP_DESC "Workload trace replay"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: workload trace, as recorded to CK_WORKLOAD_TRACE\n"
+              << "arg3: instances (0: the instances called; 1: all instances)\n"
+              << "arg4: verification (0: no; 1: yes)\n"
+              << "arg5: time kernel (0: no, 1: yes)\n"
+              << std::endl;
+}
+
+// Re-runs the calls of a workload trace with the ckProfiler operations they were recorded for, once
+// per problem, the problems taking the most time first.
+int profile_replay(int argc, char* argv[])
+{
+    if(argc != 6)
+    {
+        print_helper_msg();
+        exit(1);
+    }
+
+    const std::string trace_path = argv[2];
+
+    ck::utils::WorkloadReplayOptions options;
+
+    options.all_instances_   = std::stoi(argv[3]);
+    options.do_verification_ = std::stoi(argv[4]);
+    options.time_kernel_     = std::stoi(argv[5]);
+
+    const auto records = ck::utils::LoadWorkloadTrace(trace_path);
+
+    std::vector<ck::utils::WorkloadReplayItem> items;
+
+    for(auto& item : ck::utils::PlanWorkloadReplay(records))
+    {
+        std::cout << item.record_.operation_ << " {";
+
+        for(std::size_t i = 0; i < item.record_.problem_.size(); ++i)
+        {
+            std::cout << (i == 0 ? "" : ", ") << item.record_.problem_[i];
+        }
+
+        std::cout << "}: " << item.num_calls_ << " calls, " << item.total_time_ms_ << " ms, "
+                  << item.instance_ids_.size() << " instances" << std::endl;
+
+        // a data type or layout ckProfiler has no code for
+        if(std::any_of(item.record_.problem_.begin(),
+                       item.record_.problem_.begin() +
+                           std::min<std::size_t>(2, item.record_.problem_.size()),
+                       [](int64_t value) { return value < 0; }))
+        {
+            std::cout << "not supported by ckProfiler, skipped" << std::endl;
+
+            continue;
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    std::cout << records.size() << " calls, " << items.size() << " problems to replay"
+              << std::endl;
+
+    bool pass = true;
+
+    for(auto& command : ck::utils::MakeWorkloadReplayCommands(items, options))
+    {
+        const auto operation = ProfilerOperationRegistry::GetInstance().Get(command[1]);
+
+        if(!operation.has_value())
+        {
+            std::cout << "cannot find operation: " << command[1] << std::endl;
+
+            pass = false;
+
+            continue;
+        }
+
+        std::vector<char*> command_argv;
+
+        for(auto& arg : command)
+        {
+            std::cout << arg << " ";
+
+            command_argv.push_back(arg.data());
+        }
+
+        std::cout << std::endl;
+
+        command_argv.push_back(nullptr);
+
+        pass = (*operation)(static_cast<int>(command.size()), command_argv.data()) == 0 && pass;
+    }
+
+    return pass ? 0 : 1;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_replay);
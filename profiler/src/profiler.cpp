@@ -4,6 +4,8 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "ck/host_utility/trace.hpp"
+
 #include "profiler_operation_registry.hpp"
 
 static void print_helper_message()
@@ -20,6 +22,9 @@ int main(int argc, char* argv[])
     else if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(argv[1]);
             operation.has_value())
     {
+        CK_TRACE_ZONE(zone, "profiler", "operation");
+        zone.SetDetail(argv[1]);
+
         return (*operation)(argc, argv);
     }
     else
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+using ck::bf8_t;
+using ck::f8_t;
+
+namespace {
+
+template <typename T>
+uint8_t to_bits(T x)
+{
+    return ck::bit_cast<uint8_t>(x);
+}
+
+template <typename T>
+T from_bits(uint8_t bits)
+{
+    return ck::bit_cast<T>(bits);
+}
+
+// nearest finite value by exhaustive search, ties to the even code; saturating
+template <typename T>
+uint8_t brute_force_rne(float x)
+{
+    uint8_t best      = 0;
+    double best_error = std::numeric_limits<double>::infinity();
+
+    for(int code = 0; code < 256; ++code)
+    {
+        const float value = ck::type_convert<float>(from_bits<T>(static_cast<uint8_t>(code)));
+        if(!std::isfinite(value) || std::signbit(value) != std::signbit(x))
+            continue;
+
+        const double error = std::abs(double(value) - double(x));
+        if(error < best_error || (error == best_error && code % 2 == 0))
+        {
+            best       = static_cast<uint8_t>(code);
+            best_error = error;
+        }
+    }
+    return best;
+}
+
+template <typename T>
+void test_round_trip()
+{
+    for(int code = 0; code < 256; ++code)
+    {
+        const float value = ck::type_convert<float>(from_bits<T>(static_cast<uint8_t>(code)));
+
+        if(std::isnan(value))
+        {
+            EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::type_convert<T>(value))));
+        }
+        else if(std::isfinite(value))
+        {
+            EXPECT_EQ(to_bits(ck::type_convert<T>(value)), code) << "value " << value;
+            EXPECT_EQ(to_bits(ck::type_convert<T>(static_cast<ck::half_t>(value))), code);
+        }
+    }
+}
+
+template <typename T>
+void test_against_brute_force(float max_value)
+{
+    std::mt19937 gen(11939);
+    std::uniform_real_distribution<float> dis(-1.1f * max_value, 1.1f * max_value);
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        // spread the magnitudes over all binades, denormals included
+        const float x = dis(gen) / std::exp2(static_cast<float>(i % 24));
+
+        EXPECT_EQ(to_bits(ck::type_convert<T>(x)), brute_force_rne<T>(x)) << "x = " << x;
+    }
+}
+
+} // namespace
+
+TEST(FP8, RoundTripAllCodes)
+{
+    test_round_trip<f8_t>();
+    test_round_trip<bf8_t>();
+}
+
+TEST(FP8, KnownValues)
+{
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.0f)), 0x38);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(-2.0f)), 0xC0);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(448.0f)), 0x7E);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(std::exp2(-9.0f))), 0x01);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(-0.0f)), 0x80);
+
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(1.0f)), 0x3C);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(57344.0f)), 0x7B);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(std::exp2(-16.0f))), 0x01);
+
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(from_bits<f8_t>(0x7F))));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(from_bits<f8_t>(0xFF))));
+    EXPECT_TRUE(std::isinf(ck::type_convert<float>(from_bits<bf8_t>(0x7C))));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(from_bits<bf8_t>(0x7E))));
+}
+
+TEST(FP8, RoundToNearestEven)
+{
+    // 1.0625 lies halfway between 1.0 (0x38) and 1.125 (0x39)
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.0625f)), 0x38);
+    // 1.1875 lies halfway between 1.125 (0x39) and 1.25 (0x3A)
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.1875f)), 0x3A);
+    // the largest denormal 7 * 2^-9 rounds up into the smallest normal 2^-6
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(7.5f * std::exp2(-9.0f))), 0x08);
+    // half of the smallest denormal is a tie to zero, slightly more rounds up
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(std::exp2(-10.0f))), 0x00);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.01f * std::exp2(-10.0f))), 0x01);
+
+    test_against_brute_force<f8_t>(448.0f);
+    test_against_brute_force<bf8_t>(57344.0f);
+}
+
+TEST(FP8, Saturation)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1000.0f)), 0x7E);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(inf)), 0x7E);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(-inf)), 0xFE);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(1e6f)), 0x7B);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(-inf)), 0xFB);
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::type_convert<f8_t>(std::nanf("")))));
+
+    // without saturation E4M3 overflows to NaN and E5M2 to infinity
+    using ck::utils::cast_to_f8;
+    using ck::utils::f8_e4m3_format;
+    using ck::utils::f8_e5m2_format;
+
+    EXPECT_EQ((cast_to_f8<f8_e4m3_format, false>(1000.0f)), 0x7F);
+    EXPECT_EQ((cast_to_f8<f8_e4m3_format, false>(460.0f)), 0x7E);
+    EXPECT_EQ((cast_to_f8<f8_e5m2_format, false>(-1e6f)), 0xFC);
+    EXPECT_EQ((cast_to_f8<f8_e5m2_format, false>(inf)), 0x7C);
+}
+
+TEST(FP8, StochasticRounding)
+{
+    std::mt19937 gen(11939);
+
+    // exactly representable values never change
+    for(int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(to_bits(ck::f8_convert_sr<f8_t>(1.125f, gen())), 0x39);
+        EXPECT_EQ(to_bits(ck::f8_convert_sr<bf8_t>(-0.75f, gen())), 0xBA);
+    }
+
+    // other values round to one of the two neighbours and are unbiased on average
+    for(float x : {1.03f, -300.0f, 3.0f * std::exp2(-11.0f)})
+    {
+        const int n = 100000;
+        double sum  = 0;
+        for(int i = 0; i < n; ++i)
+        {
+            const float y = ck::type_convert<float>(ck::f8_convert_sr<f8_t>(x, gen()));
+            EXPECT_LE(std::abs(y - x), std::abs(x) * 0.125f + std::exp2(-9.0f));
+            sum += y;
+        }
+        EXPECT_NEAR(sum / n, x, std::abs(x) * 1e-2) << "x = " << x;
+    }
+}
+
+TEST(FP8, NumericLimits)
+{
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Max()), 448.0f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Lowest()), -448.0f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Min()), std::exp2(-6.0f));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::NumericLimits<f8_t>::QuietNaN())));
+
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Max()), 57344.0f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Lowest()), -57344.0f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Min()), std::exp2(-14.0f));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::NumericLimits<bf8_t>::QuietNaN())));
+    EXPECT_TRUE(std::isinf(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Infinity())));
+}
+
+TEST(FP8, FillAndCheckErr)
+{
+    std::vector<f8_t> a(1000);
+    ck::utils::FillUniformDistribution<f8_t>{-4.f, 4.f}(a);
+
+    std::vector<f8_t> b = a;
+    EXPECT_TRUE(ck::utils::check_err(b, a));
+
+    // one unit in the last place passes, two do not
+    b[10] = from_bits<f8_t>(to_bits(ck::type_convert<f8_t>(3.0f)));
+    a[10] = from_bits<f8_t>(to_bits(ck::type_convert<f8_t>(3.0f)) + 1);
+    EXPECT_TRUE(ck::utils::check_err(b, a));
+    a[10] = from_bits<f8_t>(to_bits(ck::type_convert<f8_t>(3.0f)) + 2);
+    EXPECT_FALSE(ck::utils::check_err(b, a, "expected mismatch"));
+
+    Tensor<bf8_t> t({16, 16});
+    t.GenerateTensorValue(GeneratorTensor_2<bf8_t>{-5, 5});
+    for(auto v : t.mData)
+    {
+        const float f = ck::type_convert<float>(v);
+        EXPECT_EQ(f, std::round(f));
+        EXPECT_TRUE(f >= -5.f && f < 5.f);
+    }
+}
+
+TEST(FP8, ReferenceGemmPerTensorScaling)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Scale       = ck::tensor_operation::element_wise::Scale;
+
+    const std::size_t M = 19, N = 23, K = 37;
+
+    // quantize fp32 operands with per-tensor scales
+    Tensor<float> a_fp32({M, K});
+    Tensor<float> b_fp32({K, N});
+    a_fp32.GenerateTensorValue(GeneratorTensor_3<float>{-10.f, 10.f});
+    b_fp32.GenerateTensorValue(GeneratorTensor_3<float>{-0.1f, 0.1f});
+
+    const float scale_a = 10.f / 448.f;
+    const float scale_b = 0.1f / 57344.f;
+
+    Tensor<f8_t> a({M, K});
+    Tensor<bf8_t> b({K, N});
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        a.mData[i] = ck::type_convert<f8_t>(a_fp32.mData[i] / scale_a);
+    for(std::size_t i = 0; i < b.mData.size(); ++i)
+        b.mData[i] = ck::type_convert<bf8_t>(b_fp32.mData[i] / scale_b);
+
+    Tensor<float> c({M, N});
+
+    using RefGemm = ck::tensor_operation::host::
+        ReferenceGemm<f8_t, bf8_t, float, float, PassThrough, PassThrough, Scale>;
+    auto argument = RefGemm::MakeArgument(a, b, c, {}, {}, Scale{scale_a * scale_b});
+    RefGemm::MakeInvoker().Run(argument);
+
+    // same products, dequantized first
+    Tensor<float> c_ref({M, N});
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            float acc = 0;
+            for(std::size_t k = 0; k < K; ++k)
+                acc += ck::type_convert<float>(a(m, k)) * ck::type_convert<float>(b(k, n));
+            c_ref(m, n) = acc * (scale_a * scale_b);
+        }
+
+    EXPECT_TRUE(ck::utils::check_err(c.mData, c_ref.mData));
+}
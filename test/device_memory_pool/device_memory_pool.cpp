@@ -0,0 +1,406 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/device_memory_pool.hpp"
+
+namespace {
+
+using ck::utils::DeviceMemoryPool;
+using ck::utils::HostMemoryAllocator;
+
+// a host allocator of limited capacity, counting its allocations
+class LimitedHostMemoryAllocator : public HostMemoryAllocator
+{
+    public:
+    LimitedHostMemoryAllocator(std::size_t capacity, std::size_t& bytes_allocated)
+        : capacity_{capacity}, bytes_allocated_{bytes_allocated}
+    {
+    }
+
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr) override
+    {
+        if(size > capacity_ - bytes_allocated_)
+        {
+            throw std::runtime_error("out of memory");
+        }
+
+        void* p = HostMemoryAllocator::Allocate(size, stream);
+
+        sizes_.push_back({p, size});
+        bytes_allocated_ += size;
+
+        return p;
+    }
+
+    void Free(void* p) override
+    {
+        for(auto it = sizes_.begin(); it != sizes_.end(); ++it)
+        {
+            if(it->first == p)
+            {
+                bytes_allocated_ -= it->second;
+                sizes_.erase(it);
+                break;
+            }
+        }
+
+        HostMemoryAllocator::Free(p);
+    }
+
+    private:
+    std::size_t capacity_;
+    std::size_t& bytes_allocated_;
+    std::vector<std::pair<void*, std::size_t>> sizes_;
+};
+
+// hands out addresses without memory behind them, for sizes a test cannot allocate
+class AddressAllocator : public ck::utils::DeviceMemoryAllocator
+{
+    public:
+    void* Allocate(std::size_t size, hipStream_t = nullptr) override
+    {
+        return reinterpret_cast<void*>(std::exchange(next_, next_ + size));
+    }
+
+    void Free(void*) override {}
+
+    private:
+    std::uintptr_t next_ = HostMemoryAllocator::alignment;
+};
+
+hipStream_t make_stream(std::uintptr_t i) { return reinterpret_cast<hipStream_t>(i); }
+
+} // namespace
+
+TEST(DeviceMemoryPool, SizeClasses)
+{
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(1), 512);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(512), 512);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(513), 640);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(1000), 1024);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(std::size_t{1} << 30), std::size_t{1} << 30);
+
+    std::size_t prev_size_class = 0;
+
+    for(std::size_t size = 1; size < (std::size_t{1} << 34); size = size * 9 / 8 + 1)
+    {
+        const std::size_t size_class = DeviceMemoryPool::GetSizeClass(size);
+
+        EXPECT_GE(size_class, size);
+        EXPECT_GE(size_class, prev_size_class);
+        EXPECT_EQ(DeviceMemoryPool::GetSizeClass(size_class), size_class);
+
+        if(size > 512)
+        {
+            EXPECT_LE(size_class - size, size / 4);
+            EXPECT_LE(size_class - size, std::size_t{2} << 20);
+        }
+
+        prev_size_class = size_class;
+    }
+}
+
+TEST(DeviceMemoryPool, Reuse)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    EXPECT_EQ(pool.Allocate(0), nullptr);
+
+    void* p0 = pool.Allocate(1000);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p0) % HostMemoryAllocator::alignment, 0);
+
+    pool.Free(p0);
+
+    // same size class
+    void* p1 = pool.Allocate(900);
+
+    EXPECT_EQ(p1, p0);
+
+    // another size class
+    void* p2 = pool.Allocate(2000);
+
+    EXPECT_NE(p2, p0);
+
+    pool.Free(p1);
+    pool.Free(p2);
+    pool.Free(nullptr);
+
+    const auto stats = pool.GetStats();
+
+    EXPECT_EQ(stats.num_allocations_, 3);
+    EXPECT_EQ(stats.num_hits_, 1);
+    EXPECT_EQ(stats.num_upstream_allocations_, 2);
+    EXPECT_EQ(stats.num_upstream_frees_, 0);
+    EXPECT_EQ(stats.bytes_in_use_, 0);
+    EXPECT_EQ(stats.bytes_cached_, 1024 + 2048);
+    EXPECT_DOUBLE_EQ(stats.GetHitRate(), 1.0 / 3);
+
+    EXPECT_THROW(pool.Free(p0), std::runtime_error);
+}
+
+TEST(DeviceMemoryPool, Streams)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    void* p0 = pool.Allocate(4096, make_stream(1));
+
+    pool.Free(p0);
+
+    // not until the block is back upstream
+    void* p1 = pool.Allocate(4096, make_stream(2));
+
+    EXPECT_NE(p1, p0);
+
+    void* p2 = pool.Allocate(4096, make_stream(1));
+
+    EXPECT_EQ(p2, p0);
+
+    pool.Free(p1);
+    pool.Free(p2);
+
+    EXPECT_EQ(pool.GetStats().num_hits_, 1);
+}
+
+TEST(DeviceMemoryPool, Stats)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    void* p0 = pool.Allocate(1000);
+    void* p1 = pool.Allocate(3000);
+
+    auto stats = pool.GetStats();
+
+    EXPECT_EQ(stats.bytes_requested_, 4000);
+    EXPECT_EQ(stats.bytes_in_use_, 1024 + 3072);
+    EXPECT_EQ(stats.peak_bytes_in_use_, 1024 + 3072);
+    EXPECT_DOUBLE_EQ(stats.GetFragmentation(), 1 - 4000.0 / 4096);
+
+    pool.Free(p1);
+
+    stats = pool.GetStats();
+
+    EXPECT_EQ(stats.bytes_requested_, 1000);
+    EXPECT_EQ(stats.GetBytesReserved(), 4096);
+    EXPECT_EQ(stats.peak_bytes_in_use_, 4096);
+    EXPECT_EQ(stats.peak_bytes_reserved_, 4096);
+    EXPECT_DOUBLE_EQ(stats.GetFragmentation(), 1 - 1000.0 / 4096);
+
+    pool.Free(p0);
+    pool.Trim();
+
+    stats = pool.GetStats();
+
+    EXPECT_EQ(stats.GetBytesReserved(), 0);
+    EXPECT_EQ(stats.peak_bytes_reserved_, 4096);
+    EXPECT_EQ(stats.GetFragmentation(), 0);
+}
+
+TEST(DeviceMemoryPool, Trim)
+{
+    std::size_t bytes_allocated = 0;
+
+    DeviceMemoryPool pool{std::make_unique<LimitedHostMemoryAllocator>(1 << 20, bytes_allocated)};
+
+    std::vector<void*> ps;
+
+    for(std::size_t size : {512, 1024, 2048, 4096})
+    {
+        ps.push_back(pool.Allocate(size));
+    }
+
+    for(void* p : ps)
+    {
+        pool.Free(p);
+    }
+
+    EXPECT_EQ(bytes_allocated, 512 + 1024 + 2048 + 4096);
+
+    // the largest first
+    pool.Trim(4000);
+
+    EXPECT_EQ(pool.GetStats().bytes_cached_, 512 + 1024 + 2048);
+    EXPECT_EQ(bytes_allocated, 512 + 1024 + 2048);
+
+    pool.Trim();
+
+    EXPECT_EQ(pool.GetStats().bytes_cached_, 0);
+    EXPECT_EQ(pool.GetStats().num_upstream_frees_, 4);
+    EXPECT_EQ(bytes_allocated, 0);
+}
+
+TEST(DeviceMemoryPool, MaxBytesCached)
+{
+    std::size_t bytes_allocated = 0;
+
+    DeviceMemoryPool pool{std::make_unique<LimitedHostMemoryAllocator>(1 << 20, bytes_allocated),
+                          3000};
+
+    void* p0 = pool.Allocate(2048);
+    void* p1 = pool.Allocate(2048);
+
+    pool.Free(p0);
+    pool.Free(p1);
+
+    const auto stats = pool.GetStats();
+
+    EXPECT_EQ(stats.bytes_cached_, 2048);
+    EXPECT_EQ(stats.num_upstream_frees_, 1);
+    EXPECT_EQ(bytes_allocated, 2048);
+}
+
+TEST(DeviceMemoryPool, DefaultMaxBytesCached)
+{
+    constexpr std::size_t size = DeviceMemoryPool::default_max_bytes_cached / 4 * 3;
+
+    auto f_free_two_blocks = [&](DeviceMemoryPool& pool) {
+        void* p0 = pool.Allocate(size);
+        void* p1 = pool.Allocate(size);
+
+        pool.Free(p0);
+        pool.Free(p1);
+
+        return pool.GetStats();
+    };
+
+    DeviceMemoryPool pool{std::make_unique<AddressAllocator>()};
+
+    const auto stats = f_free_two_blocks(pool);
+
+    EXPECT_EQ(stats.bytes_cached_, size);
+    EXPECT_EQ(stats.num_upstream_frees_, 1);
+
+    // opted in
+    DeviceMemoryPool unlimited_pool{std::make_unique<AddressAllocator>(),
+                                    DeviceMemoryPool::unlimited_bytes_cached};
+
+    const auto unlimited_stats = f_free_two_blocks(unlimited_pool);
+
+    EXPECT_EQ(unlimited_stats.bytes_cached_, 2 * size);
+    EXPECT_EQ(unlimited_stats.num_upstream_frees_, 0);
+}
+
+TEST(DeviceMemoryPool, OutOfMemory)
+{
+    std::size_t bytes_allocated = 0;
+
+    {
+        DeviceMemoryPool pool{std::make_unique<LimitedHostMemoryAllocator>(8192, bytes_allocated)};
+
+        void* p0 = pool.Allocate(4096);
+        void* p1 = pool.Allocate(4096);
+
+        EXPECT_THROW(pool.Allocate(512), std::runtime_error);
+
+        pool.Free(p0);
+        pool.Free(p1);
+
+        // the cache trimmed to make room
+        void* p2 = pool.Allocate(8192);
+
+        EXPECT_NE(p2, nullptr);
+        EXPECT_EQ(pool.GetStats().bytes_cached_, 0);
+
+        pool.Free(p2);
+    }
+
+    // the pool frees its cache
+    EXPECT_EQ(bytes_allocated, 0);
+}
+
+TEST(DeviceMemoryPool, Threads)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    constexpr int num_threads    = 8;
+    constexpr int num_iterations = 2000;
+
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for(int i = 0; i < num_iterations; ++i)
+            {
+                const std::size_t size = 256 * (1 + (t + i) % 16);
+
+                auto* p = static_cast<unsigned char*>(pool.Allocate(size, make_stream(t % 2)));
+
+                p[0]        = static_cast<unsigned char>(t);
+                p[size - 1] = static_cast<unsigned char>(i);
+
+                pool.Free(p);
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = pool.GetStats();
+
+    EXPECT_EQ(stats.num_allocations_, num_threads * num_iterations);
+    EXPECT_EQ(stats.bytes_in_use_, 0);
+    EXPECT_GT(stats.GetHitRate(), 0.9);
+}
+
+// DeviceMem on a pool, without touching the device
+TEST(DeviceMemoryPool, DeviceMem)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    void* p = nullptr;
+
+    {
+        DeviceMem buf(1000, pool);
+
+        p = buf.GetDeviceBuffer();
+
+        EXPECT_NE(p, nullptr);
+        EXPECT_EQ(buf.GetBufferSize(), 1000);
+        EXPECT_EQ(pool.GetStats().bytes_requested_, 1000);
+    }
+
+    DeviceMem buf(1000, pool);
+
+    EXPECT_EQ(buf.GetDeviceBuffer(), p);
+    EXPECT_EQ(pool.GetStats().num_hits_, 1);
+}
+
+// DeviceMem for the stream it is used on, reused on that stream only
+TEST(DeviceMemoryPool, DeviceMemStream)
+{
+    DeviceMemoryPool pool{std::make_unique<HostMemoryAllocator>()};
+
+    void* p = nullptr;
+
+    {
+        DeviceMem buf(1000, make_stream(1), pool);
+
+        p = buf.GetDeviceBuffer();
+    }
+
+    DeviceMem buf0(1000, pool);
+    DeviceMem buf1(1000, make_stream(2), pool);
+
+    EXPECT_NE(buf0.GetDeviceBuffer(), p);
+    EXPECT_NE(buf1.GetDeviceBuffer(), p);
+
+    DeviceMem buf2(1000, make_stream(1), pool);
+
+    EXPECT_EQ(buf2.GetDeviceBuffer(), p);
+    EXPECT_EQ(pool.GetStats().num_hits_, 1);
+}
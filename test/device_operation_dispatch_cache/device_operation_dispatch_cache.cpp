@@ -0,0 +1,348 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_dispatch_cache.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseInvoker;
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::instance::DeviceOperationDispatchCache;
+using ck::tensor_operation::device::instance::DeviceOperationProblemKey;
+using ck::tensor_operation::device::instance::MakeDeviceOperationDispatchEntry;
+
+std::atomic<int> num_arguments_made{0};
+
+// CPU stand-ins for a device operation and its instances: c = a * scale, on n elements
+struct DeviceScale : public BaseOperator
+{
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const float* p_a, float* p_c, int n, float scale) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+template <int VectorSize>
+struct DeviceScaleVector : public DeviceScale
+{
+    struct Argument : public BaseArgument
+    {
+        Argument(const float* p_a, float* p_c, int n, float scale)
+            : p_a_{p_a}, p_c_{p_c}, n_{n}, scale_{scale}
+        {
+            ++num_arguments_made;
+        }
+
+        bool SetInputPointer(std::size_t i, const void* p) override
+        {
+            return ck::tensor_operation::device::SetArgumentPointer(i, p, p_a_);
+        }
+
+        bool SetOutputPointer(std::size_t i, void* p) override
+        {
+            return ck::tensor_operation::device::SetArgumentPointer(i, p, p_c_);
+        }
+
+        const float* p_a_;
+        float* p_c_;
+        int n_;
+        float scale_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const BaseArgument* p_arg, const StreamConfig& = StreamConfig{}) override
+        {
+            const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+            for(int i = 0; i < arg.n_; ++i)
+            {
+                arg.p_c_[i] = arg.p_a_[i] * arg.scale_;
+            }
+
+            return VectorSize;
+        }
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->n_ % VectorSize == 0;
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const float* p_a, float* p_c, int n, float scale) override
+    {
+        return std::make_unique<Argument>(p_a, p_c, n, scale);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    }
+};
+
+std::vector<std::unique_ptr<DeviceScale>> GetInstances()
+{
+    std::vector<std::unique_ptr<DeviceScale>> op_ptrs;
+
+    op_ptrs.push_back(std::make_unique<DeviceScaleVector<8>>());
+    op_ptrs.push_back(std::make_unique<DeviceScaleVector<4>>());
+    op_ptrs.push_back(std::make_unique<DeviceScaleVector<1>>());
+
+    return op_ptrs;
+}
+
+using Cache = DeviceOperationDispatchCache<DeviceScale>;
+
+// the problem is n and scale, the buffers are passed to Run()
+Cache::EntryPtr Dispatch(Cache& cache, int n, float scale)
+{
+    const DeviceOperationProblemKey key{n, static_cast<int64_t>(scale)};
+
+    return cache.FindOrInsert(key, [&] {
+        return MakeDeviceOperationDispatchEntry(GetInstances(), [=](DeviceScale& op) {
+            return op.MakeArgumentPointer(nullptr, nullptr, n, scale);
+        });
+    });
+}
+
+float RunOn(const Cache::EntryPtr& entry, const std::vector<float>& a, std::vector<float>& c)
+{
+    return entry->Run({a.data()}, {c.data()});
+}
+
+} // namespace
+
+TEST(DeviceOperationDispatchCache, HitsAndMisses)
+{
+    std::vector<float> a(64, 1.f);
+    std::vector<float> c(64, 0.f);
+
+    Cache cache{16};
+
+    num_arguments_made = 0;
+
+    // 8 elements take the first instance, 12 the second
+    EXPECT_EQ(RunOn(Dispatch(cache, 8, 2.f), a, c), 8);
+    EXPECT_EQ(RunOn(Dispatch(cache, 12, 3.f), a, c), 4);
+    EXPECT_EQ(num_arguments_made, 3);
+
+    for(int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(RunOn(Dispatch(cache, 8, 2.f), a, c), 8);
+        EXPECT_EQ(c[0], 2.f);
+        EXPECT_EQ(RunOn(Dispatch(cache, 12, 3.f), a, c), 4);
+        EXPECT_EQ(c[0], 3.f);
+    }
+
+    EXPECT_EQ(num_arguments_made, 3);
+    EXPECT_EQ(cache.GetNumEntries(), 2);
+    EXPECT_EQ(cache.GetNumHits(), 20);
+    EXPECT_EQ(cache.GetNumMisses(), 2);
+    EXPECT_EQ(cache.GetNumEvictions(), 0);
+
+    EXPECT_EQ(cache.Find({7, 2}), nullptr);
+    EXPECT_EQ(cache.GetNumMisses(), 3);
+
+    cache.Clear();
+
+    EXPECT_EQ(cache.GetNumEntries(), 0);
+    EXPECT_EQ(cache.Find({8, 2}), nullptr);
+}
+
+TEST(DeviceOperationDispatchCache, OtherBuffers)
+{
+    std::vector<float> a(8, 1.f);
+    std::vector<float> b(8, 5.f);
+    std::vector<float> c(8, 0.f);
+    std::vector<float> d(8, 0.f);
+
+    Cache cache{16};
+
+    const auto entry = Dispatch(cache, 8, 2.f);
+
+    RunOn(entry, a, c);
+
+    // the same problem on other buffers hits, and only writes its own output
+    EXPECT_EQ(Dispatch(cache, 8, 2.f), entry);
+
+    RunOn(entry, b, d);
+
+    EXPECT_EQ(c, std::vector<float>(8, 2.f));
+    EXPECT_EQ(d, std::vector<float>(8, 10.f));
+
+    // every buffer has to be rebound, none kept from a previous call
+    EXPECT_THROW(entry->Run({a.data(), b.data()}, {c.data()}), std::runtime_error);
+    EXPECT_THROW(entry->Run({a.data()}, {c.data(), d.data()}), std::runtime_error);
+    EXPECT_THROW(entry->Run({}, {c.data()}), std::runtime_error);
+    EXPECT_THROW(entry->Run({a.data()}, {}), std::runtime_error);
+
+    EXPECT_EQ(RunOn(entry, a, c), 8);
+}
+
+TEST(DeviceOperationDispatchCache, ProblemKey)
+{
+    DeviceOperationProblemKey key{1, 2};
+
+    EXPECT_EQ(key.size(), 2);
+    EXPECT_EQ(key, (DeviceOperationProblemKey{1, 2}));
+    EXPECT_FALSE(key == (DeviceOperationProblemKey{1, 2, 0}));
+
+    for(std::size_t i = key.size(); i < DeviceOperationProblemKey::max_size; ++i)
+    {
+        key.PushBack(static_cast<int64_t>(i));
+    }
+
+    EXPECT_THROW(key.PushBack(0), std::runtime_error);
+}
+
+TEST(DeviceOperationDispatchCache, SeveralCaches)
+{
+    Cache cache_1{16};
+    Cache cache_2{16};
+
+    const auto entry_1 = Dispatch(cache_1, 8, 2.f);
+    const auto entry_2 = Dispatch(cache_2, 8, 2.f);
+
+    // lookups alternating between caches of the same DeviceOp see their own entries
+    for(int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(cache_1.Find({8, 2}), entry_1);
+        EXPECT_EQ(cache_2.Find({8, 2}), entry_2);
+    }
+
+    EXPECT_NE(entry_1, entry_2);
+    EXPECT_EQ(cache_1.GetNumHits(), 10);
+    EXPECT_EQ(cache_2.GetNumHits(), 10);
+}
+
+TEST(DeviceOperationDispatchCache, LeastRecentlyUsedEviction)
+{
+    std::vector<float> a(64, 1.f);
+    std::vector<float> c(64, 0.f);
+
+    Cache cache{2};
+
+    const auto entry_1 = Dispatch(cache, 1, 1.f);
+    Dispatch(cache, 2, 1.f);
+
+    // the entry of 2 is now the least recently used
+    Dispatch(cache, 1, 1.f);
+    Dispatch(cache, 3, 1.f);
+
+    EXPECT_EQ(cache.GetNumEntries(), 2);
+    EXPECT_EQ(cache.GetNumEvictions(), 1);
+    EXPECT_NE(cache.Find({1, 1}), nullptr);
+    EXPECT_EQ(cache.Find({2, 1}), nullptr);
+    EXPECT_NE(cache.Find({3, 1}), nullptr);
+
+    // held entries outlive their eviction
+    Dispatch(cache, 4, 1.f);
+    Dispatch(cache, 5, 1.f);
+
+    EXPECT_EQ(cache.Find({1, 1}), nullptr);
+    EXPECT_EQ(RunOn(entry_1, a, c), 1);
+}
+
+TEST(DeviceOperationDispatchCache, FailedInsertion)
+{
+    Cache cache{2};
+
+    EXPECT_THROW(Cache{0}, std::runtime_error);
+
+    // no instance to pick
+    EXPECT_THROW(cache.FindOrInsert({1, 1},
+                                    [] {
+                                        return MakeDeviceOperationDispatchEntry(
+                                            std::vector<std::unique_ptr<DeviceScale>>{},
+                                            [](DeviceScale&) { return nullptr; });
+                                    }),
+                 std::runtime_error);
+
+    EXPECT_EQ(cache.GetNumEntries(), 0);
+    EXPECT_EQ(cache.GetNumMisses(), 1);
+}
+
+namespace {
+
+constexpr int num_threads = 8;
+constexpr int num_keys    = 24;
+constexpr int num_calls   = 20000;
+
+// runs every thread through the num_keys problems, on buffers of its own, returns the number of
+// wrong results
+int RunConcurrently(Cache& cache)
+{
+    std::vector<std::thread> threads;
+
+    std::atomic<int> num_wrong{0};
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            const std::vector<float> a(num_keys, t);
+
+            std::vector<float> c(num_keys);
+
+            for(int i = 0; i < num_calls; ++i)
+            {
+                const int n = 1 + (i * 7 + t) % num_keys;
+
+                // shared by the threads
+                const auto entry = Dispatch(cache, n, 1.f);
+
+                c[n - 1] = -1.f;
+
+                RunOn(entry, a, c);
+
+                if(c[n - 1] != t)
+                {
+                    ++num_wrong;
+                }
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return num_wrong;
+}
+
+} // namespace
+
+TEST(DeviceOperationDispatchCache, ConcurrentLookups)
+{
+    Cache cache{num_keys};
+
+    EXPECT_EQ(RunConcurrently(cache), 0);
+    EXPECT_EQ(cache.GetNumHits() + cache.GetNumMisses(), num_threads * num_calls);
+    EXPECT_EQ(cache.GetNumEntries(), num_keys);
+    EXPECT_EQ(cache.GetNumEvictions(), 0);
+    EXPECT_GE(cache.GetNumHits(), num_threads * (num_calls - num_keys));
+}
+
+TEST(DeviceOperationDispatchCache, ConcurrentEvictions)
+{
+    // fewer entries than problems in flight
+    Cache cache{num_keys / 2};
+
+    EXPECT_EQ(RunConcurrently(cache), 0);
+    EXPECT_EQ(cache.GetNumHits() + cache.GetNumMisses(), num_threads * num_calls);
+    EXPECT_EQ(cache.GetNumEntries(), num_keys / 2);
+    EXPECT_GT(cache.GetNumEvictions(), 0);
+}
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_capabilities.hpp"
+#include "ck/tensor_operation/gpu/device/device_operation_tile.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
+
+namespace {
+
+using ck::index_t;
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::ConvolutionForwardSpecialization;
+using ck::tensor_operation::device::DeviceOperationCapabilities;
+using ck::tensor_operation::device::DeviceOperationTile;
+using ck::tensor_operation::device::GemmSpecialization;
+
+int num_constructed = 0;
+
+// stand-ins for a device operation and its instances, which count their constructions
+struct DeviceMock : public BaseOperator
+{
+};
+
+template <index_t BlockSize, index_t MPerBlock, index_t NPerBlock, index_t KPerBlock>
+struct DeviceMockTiled : public DeviceMock
+{
+    DeviceMockTiled() { ++num_constructed; }
+
+    static constexpr DeviceOperationTile GetTile()
+    {
+        return DeviceOperationTile{
+            BlockSize, MPerBlock, NPerBlock, KPerBlock, GemmSpecialization::MNPadding};
+    }
+
+    std::string GetTypeString() const override
+    {
+        return "DeviceMockTiled<" + std::to_string(BlockSize) + ">";
+    }
+};
+
+struct DeviceMockUntiled : public DeviceMock
+{
+    DeviceMockUntiled() { ++num_constructed; }
+
+    static constexpr DeviceOperationCapabilities GetCapabilities()
+    {
+        DeviceOperationCapabilities capabilities{};
+
+        capabilities.conv_fwd_spec_ = ConvolutionForwardSpecialization::Filter1x1Pad0;
+
+        return capabilities;
+    }
+};
+
+using device_mock_instances = std::tuple<DeviceMockTiled<256, 256, 128, 32>,
+                                         DeviceMockTiled<64, 32, 32, 8>,
+                                         DeviceMockUntiled>;
+
+using device_mock_irregular_tile_instances = std::tuple<DeviceMockTiled<256, 128, 160, 32>>;
+
+// as in the instance library
+void add_device_mock_instances(
+    ck::tensor_operation::device::instance::DeviceOperationInstanceDescriptors<DeviceMock>&
+        instances)
+{
+    ck::tensor_operation::device::instance::add_device_operation_instance_descriptors<
+        device_mock_instances>(instances);
+    ck::tensor_operation::device::instance::add_device_operation_instance_descriptors<
+        device_mock_irregular_tile_instances>(instances);
+}
+
+// a device operation whose factory is not on the registry
+struct DeviceMockEager : public BaseOperator
+{
+};
+
+template <index_t BlockSize>
+struct DeviceMockEagerImpl : public DeviceMockEager
+{
+    DeviceMockEagerImpl() { ++num_constructed; }
+};
+
+using device_mock_eager_instances =
+    std::tuple<DeviceMockEagerImpl<64>, DeviceMockEagerImpl<128>, DeviceMockEagerImpl<256>>;
+
+} // namespace
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <>
+struct DeviceOperationInstanceFactory<DeviceMock>
+    : DeviceOperationInstanceRegistry<DeviceOperationInstanceFactory<DeviceMock>, DeviceMock>
+{
+    static void AddInstances(DeviceOperationInstanceDescriptors<DeviceMock>& op_descs)
+    {
+        add_device_mock_instances(op_descs);
+    }
+};
+
+template <>
+struct DeviceOperationInstanceFactory<DeviceMockEager>
+{
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceMockEager>> op_ptrs;
+
+        add_device_operation_instances(op_ptrs, device_mock_eager_instances{});
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+namespace {
+
+using Factory = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceMock>;
+
+// the descriptor table of an instance tuple is a compile-time constant
+constexpr const auto& mock_descriptors =
+    ck::tensor_operation::device::instance::device_operation_instance_descriptors<
+        DeviceMock,
+        device_mock_instances>;
+
+static_assert(mock_descriptors.size() == 3);
+static_assert(mock_descriptors[0].tile_.block_size_ == 256);
+static_assert(mock_descriptors[1].tile_.m_per_block_ == 32);
+static_assert(mock_descriptors[1].tile_.k_per_block_ == 8);
+static_assert(mock_descriptors[2].tile_.block_size_ == 0);
+
+// from the tile, or reported by the instance
+static_assert(mock_descriptors[0].capabilities_.gemm_spec_ == GemmSpecialization::MNPadding);
+static_assert(mock_descriptors[2].capabilities_.gemm_spec_ == GemmSpecialization::Default);
+static_assert(mock_descriptors[2].capabilities_.conv_fwd_spec_ ==
+              ConvolutionForwardSpecialization::Filter1x1Pad0);
+
+} // namespace
+
+TEST(DeviceOperationInstanceRegistry, DescribeWithoutConstructing)
+{
+    num_constructed = 0;
+
+    const auto& descs = Factory::GetInstanceDescriptors();
+
+    ASSERT_EQ(descs.size(), 4);
+    EXPECT_EQ(Factory::GetNumInstances(), 4);
+    EXPECT_EQ(num_constructed, 0);
+
+    // collected once
+    EXPECT_EQ(&Factory::GetInstanceDescriptors(), &descs);
+
+    EXPECT_EQ(descs[0]->GetTile().n_per_block_, 128);
+    EXPECT_EQ(descs[0]->GetTile().gemm_spec_, GemmSpecialization::MNPadding);
+    EXPECT_EQ(descs[2]->GetTile().block_size_, 0);
+    EXPECT_EQ(descs[2]->GetTile().gemm_spec_, GemmSpecialization::Default);
+    EXPECT_EQ(descs[3]->GetTile().n_per_block_, 160);
+
+    EXPECT_EQ(num_constructed, 0);
+}
+
+TEST(DeviceOperationInstanceRegistry, MakeInstanceById)
+{
+    const auto& descs = Factory::GetInstanceDescriptors();
+
+    num_constructed = 0;
+
+    for(std::size_t id = 0; id < descs.size(); ++id)
+    {
+        const auto op_ptr = Factory::MakeInstance(id);
+
+        EXPECT_EQ(num_constructed, id + 1);
+        EXPECT_EQ(op_ptr->GetTypeIdName(), descs[id]->GetTypeIdName());
+        EXPECT_EQ(op_ptr->GetTypeIdHashCode(), descs[id]->GetTypeIdHashCode());
+    }
+
+    EXPECT_THROW(Factory::MakeInstance(descs.size()), std::runtime_error);
+}
+
+TEST(DeviceOperationInstanceRegistry, TypeString)
+{
+    const auto& descs = Factory::GetInstanceDescriptors();
+
+    EXPECT_EQ(descs[0]->GetTypeString(), "DeviceMockTiled<256>");
+    EXPECT_EQ(descs[1]->GetTypeString(), "DeviceMockTiled<64>");
+
+    for(std::size_t id = 0; id < descs.size(); ++id)
+    {
+        EXPECT_EQ(descs[id]->GetTypeString(), Factory::MakeInstance(id)->GetTypeString());
+    }
+}
+
+TEST(DeviceOperationInstanceRegistry, SameInstancesAsEager)
+{
+    // what GetInstances() returned before the registry
+    std::vector<std::unique_ptr<DeviceMock>> eager_op_ptrs;
+    ck::tensor_operation::device::instance::add_device_operation_instances(
+        eager_op_ptrs, device_mock_instances{});
+    ck::tensor_operation::device::instance::add_device_operation_instances(
+        eager_op_ptrs, device_mock_irregular_tile_instances{});
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    ASSERT_EQ(op_ptrs.size(), eager_op_ptrs.size());
+
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+    {
+        EXPECT_EQ(op_ptrs[i]->GetTypeIdName(), eager_op_ptrs[i]->GetTypeIdName());
+    }
+}
+
+TEST(DeviceOperationInstanceRegistry, StableInstanceId)
+{
+    // FNV-1a of the mangled name, pinned so that stored IDs stay valid
+    EXPECT_EQ(ck::tensor_operation::device::MakeInstanceId(typeid(BaseOperator)),
+              0x040a7175a7246a4eull);
+
+    const auto& descs = Factory::GetInstanceDescriptors();
+
+    for(std::size_t i = 0; i < descs.size(); ++i)
+    {
+        EXPECT_EQ(Factory::MakeInstance(i)->GetInstanceId(), descs[i]->GetInstanceId());
+
+        for(std::size_t j = 0; j < i; ++j)
+        {
+            EXPECT_NE(descs[i]->GetInstanceId(), descs[j]->GetInstanceId());
+        }
+    }
+}
+
+TEST(DeviceOperationInstanceRegistry, FindInstanceById)
+{
+    using ck::tensor_operation::device::instance::FindInstanceById;
+
+    const auto& descs = Factory::GetInstanceDescriptors();
+
+    num_constructed = 0;
+
+    for(const auto* desc : descs)
+    {
+        const auto op_ptr = FindInstanceById<DeviceMock>(desc->GetInstanceId());
+
+        ASSERT_NE(op_ptr, nullptr);
+        EXPECT_EQ(op_ptr->GetTypeIdName(), desc->GetTypeIdName());
+    }
+
+    // one construction per lookup
+    EXPECT_EQ(num_constructed, descs.size());
+
+    EXPECT_EQ(FindInstanceById<DeviceMock>(0), nullptr);
+
+    // factories without a registry
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+            DeviceMockEager>::GetInstances();
+
+    // the instance list is constructed for the first lookup only
+    EXPECT_NE(FindInstanceById<DeviceMockEager>(op_ptrs[0]->GetInstanceId()), nullptr);
+
+    num_constructed = 0;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        const auto found_op_ptr = FindInstanceById<DeviceMockEager>(op_ptr->GetInstanceId());
+
+        ASSERT_NE(found_op_ptr, nullptr);
+        EXPECT_EQ(found_op_ptr->GetTypeIdName(), op_ptr->GetTypeIdName());
+    }
+
+    EXPECT_EQ(num_constructed, op_ptrs.size());
+
+    EXPECT_EQ(FindInstanceById<DeviceMockEager>(descs[0]->GetInstanceId()), nullptr);
+}
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/library/utility/device_transfer.hpp"
+
+namespace {
+
+using ck::utils::HostTransferBackend;
+using ck::utils::TransferEngine;
+
+// a host backend counting its staging buffers and the copies issued
+class CountingHostTransferBackend : public HostTransferBackend
+{
+    public:
+    void* AllocateStaging(std::size_t size) override
+    {
+        num_staging_buffers_ += 1;
+
+        return HostTransferBackend::AllocateStaging(size);
+    }
+
+    void FreeStaging(void* p) override
+    {
+        num_staging_buffers_ -= 1;
+
+        HostTransferBackend::FreeStaging(p);
+    }
+
+    void CopyFromDeviceAsync(void* p_dst, const void* p_src, std::size_t size) override
+    {
+        num_copies_issued_ += 1;
+
+        HostTransferBackend::CopyFromDeviceAsync(p_dst, p_src, size);
+    }
+
+    int num_staging_buffers_       = 0;
+    std::size_t num_copies_issued_ = 0;
+};
+
+std::vector<uint8_t> make_data(std::size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + seed);
+    }
+
+    return data;
+}
+
+} // namespace
+
+TEST(TransferEngine, RoundTrip)
+{
+    constexpr std::size_t chunk_size = 1000;
+
+    TransferEngine engine{std::make_unique<HostTransferBackend>(), chunk_size};
+
+    for(std::size_t size : {0, 1, 999, 1000, 2500, 5003})
+    {
+        const auto src = make_data(size, static_cast<uint8_t>(size));
+
+        std::vector<uint8_t> dev(size);
+        std::vector<uint8_t> dst(size);
+
+        engine.ToDevice(dev.data(), src.data(), size);
+
+        EXPECT_EQ(dev, src) << size;
+
+        engine.FromDevice(dst.data(), dev.data(), size);
+
+        EXPECT_EQ(dst, src) << size;
+    }
+}
+
+TEST(TransferEngine, Chunks)
+{
+    constexpr std::size_t chunk_size = 256;
+    constexpr std::size_t size       = 4 * chunk_size + 10;
+
+    auto backend    = std::make_unique<CountingHostTransferBackend>();
+    auto* p_backend = backend.get();
+
+    TransferEngine engine{std::move(backend), chunk_size};
+
+    const auto src = make_data(size, 7);
+
+    std::vector<uint8_t> dst(size);
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+
+    engine.FromDevice(dst.data(), src.data(), size, [&](std::size_t offset, std::size_t n) {
+        chunks.push_back({offset, n});
+
+        // complete
+        EXPECT_TRUE(
+            std::equal(src.begin() + offset, src.begin() + offset + n, dst.begin() + offset));
+
+        // and the next in flight
+        EXPECT_EQ(p_backend->num_copies_issued_, std::min(chunks.size() + 1, std::size_t{5}));
+    });
+
+    EXPECT_EQ(chunks,
+              (std::vector<std::pair<std::size_t, std::size_t>>{
+                  {0, 256}, {256, 256}, {512, 256}, {768, 256}, {1024, 10}}));
+    EXPECT_EQ(dst, src);
+}
+
+TEST(TransferEngine, Staging)
+{
+    auto backend    = std::make_unique<CountingHostTransferBackend>();
+    auto* p_backend = backend.get();
+
+    {
+        TransferEngine engine{std::move(backend), 64};
+
+        // allocated when first used
+        EXPECT_EQ(p_backend->num_staging_buffers_, 0);
+
+        std::vector<uint8_t> dev(1000);
+        std::vector<uint8_t> host(1000);
+
+        for(int i = 0; i < 3; ++i)
+        {
+            engine.ToDevice(dev.data(), host.data(), host.size());
+            engine.FromDevice(host.data(), dev.data(), dev.size());
+        }
+
+        EXPECT_EQ(p_backend->num_staging_buffers_, 2);
+    }
+
+    // the backend is destroyed with the engine
+}
+
+TEST(TransferEngine, CallbackThrows)
+{
+    TransferEngine engine{std::make_unique<HostTransferBackend>(), 100};
+
+    const auto src = make_data(1000, 3);
+
+    std::vector<uint8_t> dst(1000);
+
+    EXPECT_THROW(engine.FromDevice(dst.data(),
+                                   src.data(),
+                                   src.size(),
+                                   [](std::size_t offset, std::size_t) {
+                                       if(offset == 300)
+                                       {
+                                           throw std::runtime_error("mismatch");
+                                       }
+                                   }),
+                 std::runtime_error);
+
+    // usable after
+    std::fill(dst.begin(), dst.end(), 0);
+
+    engine.FromDevice(dst.data(), src.data(), src.size());
+
+    EXPECT_EQ(dst, src);
+}
+
+TEST(TransferEngine, Invalid)
+{
+    EXPECT_THROW(TransferEngine(nullptr), std::runtime_error);
+    EXPECT_THROW(TransferEngine(std::make_unique<HostTransferBackend>(), 0), std::runtime_error);
+}
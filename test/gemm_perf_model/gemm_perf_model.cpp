@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/gemm_perf_model.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::DeviceOperationTile;
+using ck::tensor_operation::device::GemmSpecialization;
+using ck::utils::GemmPerfDevice;
+using ck::utils::GemmPerfModel;
+using ck::utils::GemmPerfProblem;
+using ck::utils::GemmPerfRecord;
+
+DeviceOperationTile MakeTile(ck::index_t block_size,
+                             ck::index_t m_per_block,
+                             ck::index_t n_per_block,
+                             ck::index_t k_per_block,
+                             GemmSpecialization gemm_spec    = GemmSpecialization::MNKPadding,
+                             ck::index_t num_prefetch_stages = 1)
+{
+    // A and B tiles in LDS, fp16
+    const ck::index_t lds_bytes = (m_per_block + n_per_block) * k_per_block * 2;
+
+    // pipeline v1, and the swizzle of BlockToCTileMap_M00_N0_M01Adapt
+    return DeviceOperationTile{block_size,
+                               m_per_block,
+                               n_per_block,
+                               k_per_block,
+                               gemm_spec,
+                               lds_bytes,
+                               8,
+                               8,
+                               8,
+                               1,
+                               num_prefetch_stages,
+                               8};
+}
+
+// tiles of the fp16 instance lists
+std::vector<DeviceOperationTile> MakeTiles()
+{
+    return {MakeTile(256, 256, 128, 32),
+            MakeTile(256, 128, 256, 32),
+            MakeTile(128, 128, 128, 32),
+            MakeTile(256, 128, 128, 32),
+            MakeTile(128, 128, 64, 32),
+            MakeTile(128, 64, 128, 32),
+            MakeTile(64, 64, 64, 32),
+            MakeTile(256, 128, 64, 32),
+            MakeTile(256, 64, 128, 32),
+            MakeTile(256, 256, 128, 32, GemmSpecialization::Default),
+            MakeTile(64, 32, 32, 8),
+            MakeTile(256, 128, 128, 32, GemmSpecialization::MNKPadding, 2)};
+}
+
+std::vector<GemmPerfProblem> MakeProblems()
+{
+    std::vector<GemmPerfProblem> problems;
+
+    for(std::size_t M : {64, 500, 1024, 3840, 7680})
+    {
+        for(std::size_t N : {128, 1000, 4096})
+        {
+            for(std::size_t K : {64, 1024, 4000})
+            {
+                problems.push_back(GemmPerfProblem{M, N, K, 1, 2, 2, 2});
+            }
+        }
+    }
+
+    return problems;
+}
+
+// times as given by a model
+std::vector<GemmPerfRecord> MakeRecords(const GemmPerfModel& model, const GemmPerfDevice& device)
+{
+    std::vector<GemmPerfRecord> records;
+
+    for(const auto& problem : MakeProblems())
+    {
+        for(const auto& tile : MakeTiles())
+        {
+            const double time = model.Estimate(problem, tile, device);
+
+            if(std::isfinite(time))
+            {
+                records.push_back(GemmPerfRecord{problem, device, tile, records.size(), time});
+            }
+        }
+    }
+
+    return records;
+}
+
+} // namespace
+
+TEST(GemmPerfModel, Features)
+{
+    const GemmPerfDevice device{4, 2048, 65536};
+
+    // 3 x 3 blocks on 4 CUs, one block per CU by LDS
+    const auto tile = DeviceOperationTile{256, 128, 128, 32, GemmSpecialization::Default, 40000};
+
+    const auto features = GemmPerfModel::GetFeatures({384, 384, 64}, tile, device);
+
+    ASSERT_TRUE(features.supported_);
+    EXPECT_EQ(features.grid_size_, 9);
+    EXPECT_EQ(features.blocks_per_cu_, 1);
+    EXPECT_EQ(features.waves_, 3);
+    EXPECT_DOUBLE_EQ(features.wave_efficiency_, 0.75);
+    EXPECT_DOUBLE_EQ(features.padding_efficiency_, 1.);
+    EXPECT_DOUBLE_EQ(features.compute_, 3. * 2 * 128 * 128 * 64);
+    EXPECT_DOUBLE_EQ(features.latency_, 3. * 2);
+    // the 4 resident blocks cover 2 rows and 3 columns of C tiles
+    EXPECT_DOUBLE_EQ(features.memory_,
+                     64. * (9. * 2 / 4 * 128 * 2 + 9. * 3 / 4 * 128 * 2) + 384 * 384 * 2);
+
+    // prefetching hides part of the latency, a swizzle of 2 rows covers 2 x 2 C tiles
+    auto pipelined_tile                 = tile;
+    pipelined_tile.num_prefetch_stages_ = 2;
+    pipelined_tile.m01_                 = 2;
+
+    const auto pipelined = GemmPerfModel::GetFeatures({384, 384, 64}, pipelined_tile, device);
+
+    ASSERT_TRUE(pipelined.supported_);
+    EXPECT_DOUBLE_EQ(pipelined.latency_, 3.);
+    EXPECT_DOUBLE_EQ(pipelined.memory_,
+                     64. * (9. * 2 / 4 * 128 * 2 + 9. * 2 / 4 * 128 * 2) + 384 * 384 * 2);
+
+    // not a multiple of the tile, and not padded
+    EXPECT_FALSE(GemmPerfModel::GetFeatures({384, 383, 64}, tile, device).supported_);
+    EXPECT_FALSE(std::isfinite(GemmPerfModel{}.Estimate({384, 383, 64}, tile, device)));
+
+    // padded N, and threads rather than LDS limit the occupancy
+    auto padded_tile       = tile;
+    padded_tile.gemm_spec_ = GemmSpecialization::MNPadding;
+    padded_tile.lds_bytes_ = 16384;
+
+    const auto padded = GemmPerfModel::GetFeatures({384, 383, 64}, padded_tile, device);
+
+    ASSERT_TRUE(padded.supported_);
+    EXPECT_EQ(padded.blocks_per_cu_, 4);
+    EXPECT_EQ(padded.waves_, 1);
+    EXPECT_DOUBLE_EQ(padded.padding_efficiency_, 383. / 384);
+
+    // unknown tile
+    EXPECT_FALSE(GemmPerfModel::GetFeatures({384, 384, 64}, {}, device).supported_);
+}
+
+TEST(GemmPerfModel, Rank)
+{
+    const GemmPerfModel model;
+    const GemmPerfDevice device;
+    const auto tiles = MakeTiles();
+
+    // M is not a multiple of 256, the unpadded instance is left out
+    const GemmPerfProblem problem{3900, 4096, 4096};
+
+    const auto ranking = model.Rank(problem, tiles, device);
+
+    ASSERT_EQ(ranking.size(), tiles.size() - 1);
+
+    for(std::size_t i = 0; i < ranking.size(); ++i)
+    {
+        EXPECT_NE(ranking[i], 9);
+
+        if(i > 0)
+        {
+            EXPECT_LE(model.Estimate(problem, tiles[ranking[i - 1]], device),
+                      model.Estimate(problem, tiles[ranking[i]], device));
+        }
+    }
+
+    // a tiny problem is not given a tile mostly made of padding
+    const auto& small_tile = tiles[model.Rank({64, 64, 64}, tiles, device).front()];
+
+    EXPECT_LE(small_tile.m_per_block_, 64);
+    EXPECT_LE(small_tile.n_per_block_, 64);
+}
+
+TEST(GemmPerfModel, Calibrate)
+{
+    const GemmPerfDevice device{104, 2048, 65536};
+
+    GemmPerfModel reference;
+    reference.compute_ms_ = 1.1e-9;
+    reference.latency_ms_ = 3e-4;
+    reference.memory_ms_  = 1.5e-9;
+    reference.launch_ms_  = 2e-3;
+
+    const auto records = MakeRecords(reference, device);
+
+    const auto model = GemmPerfModel::Calibrate(records);
+
+    EXPECT_NEAR(model.compute_ms_ / reference.compute_ms_, 1., 1e-6);
+    EXPECT_NEAR(model.latency_ms_ / reference.latency_ms_, 1., 1e-6);
+    EXPECT_NEAR(model.memory_ms_ / reference.memory_ms_, 1., 1e-6);
+    EXPECT_NEAR(model.launch_ms_ / reference.launch_ms_, 1., 1e-6);
+
+    const auto stats = ck::utils::EvaluateRanking(model, records);
+
+    EXPECT_EQ(stats.num_problems_, MakeProblems().size());
+    EXPECT_EQ(stats.num_best_picked_, stats.num_problems_);
+    EXPECT_DOUBLE_EQ(stats.mean_slowdown_, 1.);
+
+    // instances are only compared within a layout
+    auto transposed = records;
+    for(std::size_t i = 0; i < transposed.size(); i += 2)
+    {
+        transposed[i].problem_.b_layout_ = "ColumnMajor";
+    }
+
+    EXPECT_EQ(ck::utils::EvaluateRanking(model, transposed).num_problems_,
+              2 * MakeProblems().size());
+
+    // a term that does not matter is fitted as zero, not negative
+    reference.latency_ms_ = 0;
+
+    const auto no_latency = GemmPerfModel::Calibrate(MakeRecords(reference, device));
+
+    EXPECT_GE(no_latency.latency_ms_, 0.);
+    EXPECT_NEAR(no_latency.latency_ms_, 0., 1e-12);
+    EXPECT_NEAR(no_latency.compute_ms_ / reference.compute_ms_, 1., 1e-6);
+
+    EXPECT_THROW(GemmPerfModel::Calibrate({}), std::runtime_error);
+}
+
+TEST(GemmPerfModel, SaveAndLoadRecords)
+{
+    const auto records = MakeRecords(GemmPerfModel{}, GemmPerfDevice{});
+
+    const auto path =
+        (std::filesystem::temp_directory_path() / "ck_test_gemm_perf_records.csv").string();
+
+    std::remove(path.c_str());
+
+    ck::utils::SaveGemmPerfRecords(path, {records.begin(), records.begin() + 10});
+
+    for(std::size_t i = 10; i < records.size(); ++i)
+    {
+        ck::utils::AppendGemmPerfRecord(path, records[i]);
+    }
+
+    const auto loaded = ck::utils::LoadGemmPerfRecords(path);
+
+    ASSERT_EQ(loaded.size(), records.size());
+
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i].problem_.M_, records[i].problem_.M_);
+        EXPECT_EQ(loaded[i].problem_.K_, records[i].problem_.K_);
+        EXPECT_EQ(loaded[i].device_.num_cu_, records[i].device_.num_cu_);
+        EXPECT_EQ(loaded[i].tile_.n_per_block_, records[i].tile_.n_per_block_);
+        EXPECT_EQ(loaded[i].tile_.gemm_spec_, records[i].tile_.gemm_spec_);
+        EXPECT_EQ(loaded[i].tile_.lds_bytes_, records[i].tile_.lds_bytes_);
+        EXPECT_EQ(loaded[i].tile_.num_prefetch_stages_, records[i].tile_.num_prefetch_stages_);
+        EXPECT_EQ(loaded[i].tile_.m01_, records[i].tile_.m01_);
+        EXPECT_EQ(loaded[i].problem_.b_layout_, records[i].problem_.b_layout_);
+        EXPECT_EQ(loaded[i].instance_id_, records[i].instance_id_);
+        EXPECT_EQ(loaded[i].ave_time_ms_, records[i].ave_time_ms_);
+    }
+
+    std::remove(path.c_str());
+
+    EXPECT_THROW(ck::utils::LoadGemmPerfRecords(path), std::runtime_error);
+}
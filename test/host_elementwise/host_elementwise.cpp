@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_vector_math.hpp"
+
+namespace {
+
+using ck::half_t;
+using ck::span;
+using ck::utils::HostSimd;
+
+namespace element_wise = ck::tensor_operation::element_wise;
+
+// odd sizes so that every call ends on a partial vector and a partial block
+std::vector<float> MakeInput(std::size_t n, float lo, float hi)
+{
+    std::vector<float> x(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = lo + (hi - lo) * static_cast<float>(i) / static_cast<float>(n - 1);
+    }
+
+    return x;
+}
+
+template <typename T>
+std::vector<T> Convert(const std::vector<float>& x)
+{
+    std::vector<T> y(x.size());
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        y[i] = ck::type_convert<T>(x[i]);
+    }
+
+    return y;
+}
+
+bool AlmostEqual(float a, float b, float rtol, float atol)
+{
+    return std::abs(a - b) <= atol + rtol * std::abs(b);
+}
+
+} // namespace
+
+TEST(HostVectorMath, MatchesCmath)
+{
+    for(const HostSimd simd : {HostSimd::None, ck::utils::GetHostSimd()})
+    {
+        const auto x = MakeInput(100003, -90.f, 90.f);
+
+        std::vector<float> y(x.size());
+
+        ck::utils::host_exp(x.data(), y.data(), x.size(), simd);
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            const double ref = std::exp(static_cast<double>(x[i]));
+
+            if(ref >= 1.17549435e-38 && ref <= 3.40282347e+38)
+                ASSERT_TRUE(AlmostEqual(y[i], ref, 2e-7f, 0.f)) << x[i];
+        }
+
+        ck::utils::host_erf(x.data(), y.data(), x.size(), simd);
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            ASSERT_TRUE(AlmostEqual(y[i], std::erf(static_cast<double>(x[i])), 0.f, 2e-7f))
+                << x[i];
+        }
+
+        ck::utils::host_tanh(x.data(), y.data(), x.size(), simd);
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            ASSERT_TRUE(AlmostEqual(y[i], std::tanh(static_cast<double>(x[i])), 2e-7f, 0.f))
+                << x[i];
+        }
+    }
+}
+
+TEST(HostVectorMath, SpecialValues)
+{
+    const float x[5] = {NAN, INFINITY, -INFINITY, 0.f, -100.f};
+    float y[5];
+
+    ck::utils::host_exp(x, y, 5);
+    EXPECT_TRUE(std::isnan(y[0]));
+    EXPECT_EQ(y[1], INFINITY);
+    EXPECT_EQ(y[2], 0.f);
+    EXPECT_EQ(y[3], 1.f);
+    EXPECT_LT(y[4], 1.17549435e-38f);
+
+    ck::utils::host_erf(x, y, 5);
+    EXPECT_TRUE(std::isnan(y[0]));
+    EXPECT_EQ(y[1], 1.f);
+    EXPECT_EQ(y[2], -1.f);
+    EXPECT_EQ(y[3], 0.f);
+    EXPECT_EQ(y[4], -1.f);
+
+    ck::utils::host_tanh(x, y, 5);
+    EXPECT_TRUE(std::isnan(y[0]));
+    EXPECT_EQ(y[1], 1.f);
+    EXPECT_EQ(y[2], -1.f);
+    EXPECT_EQ(y[3], 0.f);
+    EXPECT_EQ(y[4], -1.f);
+}
+
+TEST(HostElementwise, UnaryMatchesFunctor)
+{
+    const auto x = MakeInput(1001, -10.f, 10.f);
+
+    std::vector<float> y(x.size());
+
+    auto check = [&](auto op) {
+        ck::utils::host_elementwise_apply(
+            op, span<float>{y.data(), y.size()}, span<const float>{x});
+
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            float ref;
+            op(ref, x[i]);
+
+            ASSERT_TRUE(AlmostEqual(y[i], ref, 1e-6f, 1e-6f)) << x[i];
+        }
+    };
+
+    check(element_wise::FastGelu{});
+    check(element_wise::Gelu{});
+    check(element_wise::Sigmoid{});
+}
+
+TEST(HostElementwise, HalfMatchesFunctor)
+{
+    const auto x = Convert<half_t>(MakeInput(1001, -8.f, 8.f));
+
+    std::vector<half_t> y(x.size());
+
+    auto check = [&](auto op) {
+        ck::utils::host_elementwise_apply(
+            op, span<half_t>{y.data(), y.size()}, span<const half_t>{x});
+
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            half_t ref;
+            op(ref, x[i]);
+
+            // within one fp16 ulp, the fp16 functors round intermediates to fp16
+            ASSERT_TRUE(AlmostEqual(ck::type_convert<float>(y[i]),
+                                    ck::type_convert<float>(ref),
+                                    2e-3f,
+                                    1e-3f))
+                << ck::type_convert<float>(x[i]);
+        }
+    };
+
+    check(element_wise::FastGelu{});
+    check(element_wise::Gelu{});
+    check(element_wise::Sigmoid{});
+}
+
+TEST(HostElementwise, MultiInputMatchesFunctor)
+{
+    const std::size_t n = 777;
+
+    const auto c  = MakeInput(n, -6.f, 6.f);
+    const auto d0 = Convert<half_t>(MakeInput(n, 2.f, -2.f));
+    const auto d1 = Convert<half_t>(MakeInput(n, -1.f, 1.f));
+
+    std::vector<half_t> e(n);
+    std::vector<float> e_f32(n);
+
+    const element_wise::AddAddFastGelu add_add_fast_gelu{};
+
+    ck::utils::host_elementwise_apply(add_add_fast_gelu,
+                                      span<half_t>{e.data(), n},
+                                      span<const float>{c},
+                                      span<const half_t>{d0},
+                                      span<const half_t>{d1});
+
+    const element_wise::AddFastGelu add_fast_gelu{};
+
+    ck::utils::host_elementwise_apply(add_fast_gelu,
+                                      span<float>{e_f32.data(), n},
+                                      span<const float>{c},
+                                      span<const half_t>{d0});
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        half_t ref;
+        add_add_fast_gelu(ref, c[i], d0[i], d1[i]);
+
+        EXPECT_TRUE(AlmostEqual(ck::type_convert<float>(e[i]),
+                                ck::type_convert<float>(ref),
+                                1e-3f,
+                                1e-3f));
+
+        float ref_f32;
+        add_fast_gelu(ref_f32, c[i], d0[i]);
+
+        EXPECT_TRUE(AlmostEqual(e_f32[i], ref_f32, 1e-6f, 1e-6f));
+    }
+}
+
+TEST(HostElementwise, NormalizeMatchesFunctor)
+{
+    const std::size_t n = 300;
+
+    const auto x           = MakeInput(n, -3.f, 3.f);
+    const auto mean        = MakeInput(n, -0.5f, 0.5f);
+    const auto mean_square = MakeInput(n, 1.f, 2.f);
+    const auto gamma       = MakeInput(n, 0.5f, 1.5f);
+    const auto beta        = MakeInput(n, 0.2f, -0.2f);
+
+    std::vector<float> y(n);
+
+    const element_wise::Normalize op{1e-5};
+
+    ck::utils::host_elementwise_apply(op,
+                                      span<float>{y.data(), y.size()},
+                                      span<const float>{x},
+                                      span<const float>{mean},
+                                      span<const float>{mean_square},
+                                      span<const float>{gamma},
+                                      span<const float>{beta});
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        float ref;
+        op(ref, x[i], mean[i], mean_square[i], gamma[i], beta[i]);
+
+        EXPECT_TRUE(AlmostEqual(y[i], ref, 1e-6f, 1e-6f));
+    }
+}
+
+TEST(HostElementwise, Apply2dStridedAndBroadcast)
+{
+    const std::size_t M = 37;
+    const std::size_t N = 301;
+
+    Tensor<float> c_m_n({M, N});
+    Tensor<half_t> d0_n({N}); // broadcast along M
+    Tensor<half_t> d1_m({M}); // broadcast along N
+    Tensor<half_t> e_n_m({N, M});
+
+    c_m_n.GenerateTensorValue(GeneratorTensor_3<float>{-4.f, 4.f}, 1);
+    d0_n.GenerateTensorValue(GeneratorTensor_3<half_t>{-1.f, 1.f}, 1);
+    d1_m.GenerateTensorValue(GeneratorTensor_3<half_t>{-1.f, 1.f}, 1);
+
+    using Strides = std::vector<std::size_t>;
+
+    const std::vector<std::size_t> lengths{M, N};
+
+    const TensorView<const half_t> d0_m_n{HostTensorDescriptor(lengths, Strides{0, 1}),
+                                          d0_n.data()};
+    const TensorView<const half_t> d1_m_n{HostTensorDescriptor(lengths, Strides{1, 0}),
+                                          d1_m.data()};
+
+    // column major output
+    TensorView<half_t> e_m_n{HostTensorDescriptor(lengths, Strides{1, M}), e_n_m.data()};
+
+    const element_wise::AddAddFastGelu op{};
+
+    ck::utils::host_elementwise_apply_2d(op, e_m_n, c_m_n, d0_m_n, d1_m_n);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            half_t ref;
+            op(ref, c_m_n(m, n), d0_n(n), d1_m(m));
+
+            ASSERT_TRUE(AlmostEqual(ck::type_convert<float>(e_n_m(n, m)),
+                                    ck::type_convert<float>(ref),
+                                    1e-3f,
+                                    1e-3f));
+        }
+    }
+
+    Tensor<half_t> e_wrong({M, N + 1});
+
+    EXPECT_THROW(ck::utils::host_elementwise_apply_2d(op, e_wrong, c_m_n, d0_m_n, d1_m_n),
+                 std::runtime_error);
+}
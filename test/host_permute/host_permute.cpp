@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_permute.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+using ck::utils::HostSimd;
+
+// 12 bytes, no vectorized path
+struct Triple
+{
+    float x, y, z;
+};
+
+template <typename T>
+T MakeValue(std::size_t i)
+{
+    if constexpr(std::is_same_v<T, Triple>)
+    {
+        return Triple{float(i), float(i + 1), float(i + 2)};
+    }
+    else
+    {
+        // distinct bit patterns for every element of the small test tensors
+        T v{};
+        const uint64_t bits = i * 0x9e3779b97f4a7c15ull;
+        std::memcpy(&v, &bits, sizeof(T));
+        return v;
+    }
+}
+
+template <typename T>
+bool BitEqual(const T& a, const T& b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T>
+void Fill(Tensor<T>& t)
+{
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+    {
+        t.mData[i] = MakeValue<T>(i);
+    }
+}
+
+template <typename T>
+class HostPermute : public ::testing::Test
+{
+};
+
+using ElementTypes = ::testing::Types<int8_t, ck::bhalf_t, float, double, Triple>;
+
+TYPED_TEST_SUITE(HostPermute, ElementTypes);
+
+} // namespace
+
+TYPED_TEST(HostPermute, NchwToNhwc)
+{
+    using T = TypeParam;
+
+    // odd sizes, so every tile has ragged edges
+    const std::size_t N = 2;
+    const std::size_t C = 37;
+    const std::size_t H = 5;
+    const std::size_t W = 131;
+
+    Tensor<T> a_nchw({N, C, H, W});
+    Fill(a_nchw);
+
+    for(const HostSimd simd : {HostSimd::None, ck::utils::GetHostSimd()})
+    {
+        Tensor<T> b_nhwc({N, H, W, C});
+
+        ck::utils::host_permute(a_nchw, make_tensor_view(b_nhwc).Permute({0, 3, 1, 2}), simd);
+
+        a_nchw.ForEach([&](auto& self, auto idx) {
+            ASSERT_TRUE(BitEqual(b_nhwc(idx[0], idx[2], idx[3], idx[1]), self(idx)));
+        });
+
+        // and back
+        Tensor<T> c_nchw({N, C, H, W});
+
+        ck::utils::host_permute(make_tensor_view(b_nhwc).Permute({0, 3, 1, 2}), c_nchw, simd);
+
+        for(std::size_t i = 0; i < a_nchw.mData.size(); ++i)
+        {
+            ASSERT_TRUE(BitEqual(c_nchw.mData[i], a_nchw.mData[i]));
+        }
+    }
+}
+
+TYPED_TEST(HostPermute, StridedViews)
+{
+    using T = TypeParam;
+
+    const std::size_t M = 70;
+    const std::size_t N = 45;
+
+    Tensor<T> a_n_m({N, 2 * M});
+    Fill(a_n_m);
+
+    Tensor<T> b_m_n({M, N});
+
+    // every other row of a transposed input: unit stride in neither operand along m
+    const auto a_m_n = make_tensor_view(a_n_m).Permute({1, 0}).Slice(0, 0, 2 * M, 2);
+
+    ck::utils::host_permute(a_m_n, b_m_n);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_TRUE(BitEqual(b_m_n(m, n), a_n_m(n, 2 * m)));
+        }
+    }
+}
+
+TEST(HostPermute, GroupedTransposeAndCopy)
+{
+    const std::size_t G0 = 3;
+    const std::size_t G1 = 2;
+    const std::size_t N  = 100;
+    const std::size_t K  = 24;
+
+    // b0_gs_ns_ks with ns and gs interleaved in memory, as in the attention examples
+    Tensor<ck::half_t> b0_gs_ns_ks(std::vector<std::size_t>{G0, G1, N, K},
+                                   std::vector<std::size_t>{G1 * N * K, K, G1 * K, 1});
+    Fill(b0_gs_ns_ks);
+
+    Tensor<ck::half_t> b0_g_k_n({G0 * G1, K, N});
+
+    auto b0_gs_ks_ns = make_tensor_view(b0_g_k_n).Reshape({G0, G1, K, N});
+
+    ck::utils::host_permute(b0_gs_ns_ks, b0_gs_ks_ns.Permute({0, 1, 3, 2}));
+
+    b0_gs_ns_ks.ForEach([&](auto& self, auto idx) {
+        ASSERT_TRUE(BitEqual(b0_g_k_n(idx[0] * G1 + idx[1], idx[3], idx[2]), self(idx)));
+    });
+
+    // same strides on both sides is a plain copy
+    Tensor<ck::half_t> copy(b0_gs_ns_ks.mDesc);
+
+    ck::utils::host_permute(b0_gs_ns_ks, copy);
+
+    for(std::size_t i = 0; i < copy.mData.size(); ++i)
+    {
+        ASSERT_TRUE(BitEqual(copy.mData[i], b0_gs_ns_ks.mData[i]));
+    }
+
+    Tensor<ck::half_t> wrong({G0 * G1, N, K});
+
+    EXPECT_THROW(ck::utils::host_permute(b0_gs_ns_ks, wrong), std::runtime_error);
+
+    Tensor<float> empty_src({3, 0, 5});
+    Tensor<float> empty_dst({3, 0, 5});
+
+    ck::utils::host_permute(empty_src, empty_dst);
+}
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/bulk_type_convert.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::bhalf_t;
+using ck::half_t;
+using ck::utils::HostSimd;
+
+namespace {
+
+template <typename T>
+std::vector<uint8_t> to_bytes(const std::vector<T>& v)
+{
+    std::vector<uint8_t> bytes(sizeof(T) * v.size());
+    std::memcpy(bytes.data(), v.data(), bytes.size());
+    return bytes;
+}
+
+template <typename T>
+std::vector<T> from_bits(const std::vector<uint32_t>& bits)
+{
+    std::vector<T> v(bits.size());
+    for(std::size_t i = 0; i < bits.size(); ++i)
+    {
+        std::memcpy(&v[i], &bits[i], sizeof(T));
+    }
+    return v;
+}
+
+// all 16-bit patterns, or special values followed by random 32-bit patterns
+template <typename X>
+std::vector<X> make_inputs()
+{
+    std::vector<uint32_t> bits;
+
+    if constexpr(sizeof(X) == 2)
+    {
+        for(uint32_t i = 0; i < 65536; ++i)
+            bits.push_back(i);
+    }
+    else
+    {
+        // zeros, subnormals, bf16 round-to-even ties, Inf, quiet and signaling NaN, max
+        bits = {0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x3f808000, 0x3f818000,
+                0x3f807fff, 0x3f808001, 0x7f800000, 0xff800000, 0x7fc00000, 0x7f800001,
+                0xff80ffff, 0x7f7fffff, 0x7f7f8000, 0x477fe000, 0x477ff000, 0x33000000};
+
+        std::mt19937 gen(0);
+        for(int i = 0; i < 100000; ++i)
+            bits.push_back(static_cast<uint32_t>(gen()));
+
+        // values in a realistic range
+        std::uniform_real_distribution<float> dis(-300.f, 300.f);
+        for(int i = 0; i < 10000; ++i)
+        {
+            const float x = dis(gen);
+            bits.push_back(ck::bit_cast<uint32_t>(x));
+        }
+    }
+
+    return from_bits<X>(bits);
+}
+
+template <typename Y, typename X>
+void test_exact(const std::vector<X>& src)
+{
+    std::vector<Y> expected(src.size());
+    for(std::size_t i = 0; i < src.size(); ++i)
+        expected[i] = ck::type_convert<Y>(src[i]);
+
+    for(auto simd : {HostSimd::None, HostSimd::Avx2, HostSimd::Avx512})
+    {
+        // odd length and offset exercise the tails and unaligned accesses
+        std::vector<Y> result(src.size());
+        ck::utils::detail::bulk_type_convert_chunk(src.data(), result.data(), 3, simd);
+        ck::utils::detail::bulk_type_convert_chunk(
+            src.data() + 3, result.data() + 3, src.size() - 3, simd);
+
+        EXPECT_EQ(to_bytes(result), to_bytes(expected)) << ck::utils::GetHostSimdString(simd);
+    }
+}
+
+std::vector<float> make_int8_range_floats()
+{
+    std::vector<float> src;
+    for(int i = -1280; i <= 1270; ++i)
+        src.push_back(i / 10.f);
+    return src;
+}
+
+} // namespace
+
+TEST(BulkTypeConvert, FloatToHalf) { test_exact<half_t>(make_inputs<float>()); }
+
+TEST(BulkTypeConvert, HalfToFloat) { test_exact<float>(make_inputs<half_t>()); }
+
+TEST(BulkTypeConvert, FloatToBhalf) { test_exact<bhalf_t>(make_inputs<float>()); }
+
+TEST(BulkTypeConvert, BhalfToFloat) { test_exact<float>(make_inputs<bhalf_t>()); }
+
+TEST(BulkTypeConvert, Int8)
+{
+    test_exact<int8_t>(make_int8_range_floats());
+
+    std::vector<int8_t> src;
+    for(int i = -128; i < 128; ++i)
+        src.push_back(static_cast<int8_t>(i));
+    test_exact<float>(src);
+}
+
+TEST(BulkTypeConvert, Int8Saturates)
+{
+    const std::vector<float> src(40, 1000.f);
+    std::vector<int8_t> result(src.size());
+
+    ck::utils::bulk_type_convert(src.data(), result.data(), src.size());
+
+    for(auto x : result)
+        EXPECT_EQ(x, 127);
+}
+
+TEST(BulkTypeConvert, ParallelMatchesScalar)
+{
+    Tensor<float> a({1031, 1027});
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(a.mData);
+
+    const auto b = a.CopyAsType<bhalf_t>();
+    const auto h = a.CopyAsType<half_t>();
+    const auto d = a.CopyAsType<double>();
+
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+    {
+        ASSERT_EQ(b.mData[i], ck::type_convert<bhalf_t>(a.mData[i]));
+        ASSERT_EQ(ck::bit_cast<uint16_t>(h.mData[i]),
+                  ck::bit_cast<uint16_t>(ck::type_convert<half_t>(a.mData[i])));
+        ASSERT_EQ(d.mData[i], static_cast<double>(a.mData[i]));
+    }
+}
+
+TEST(BulkTypeConvert, FillUniformDistributionMatchesFloatSequence)
+{
+    std::vector<float> f(10000);
+    std::vector<bhalf_t> b(f.size());
+    std::vector<half_t> h(f.size());
+
+    ck::utils::FillUniformDistribution<float>{}(f);
+    ck::utils::FillUniformDistribution<bhalf_t>{}(b);
+    ck::utils::FillUniformDistribution<half_t>{}(h);
+
+    for(std::size_t i = 0; i < f.size(); ++i)
+    {
+        ASSERT_EQ(b[i], ck::type_convert<bhalf_t>(f[i]));
+        ASSERT_EQ(ck::bit_cast<uint16_t>(h[i]),
+                  ck::bit_cast<uint16_t>(ck::type_convert<half_t>(f[i])));
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+Tensor<float> make_sequential_tensor(std::initializer_list<std::size_t> lens)
+{
+    Tensor<float> t(lens);
+    ck::utils::FillMonotonicSeq<float>{0.f, 1.f}(t.begin(), t.end());
+    return t;
+}
+
+} // namespace
+
+TEST(TensorView, AliasesTensorStorage)
+{
+    auto t    = make_sequential_tensor({2, 3});
+    auto view = make_tensor_view(t);
+
+    EXPECT_EQ(view.data(), t.data());
+    EXPECT_TRUE(view.IsPacked());
+
+    view(1, 2) = 42.f;
+    EXPECT_EQ(t(1, 2), 42.f);
+}
+
+TEST(TensorView, WrapsExternalPointer)
+{
+    std::vector<int> buf(12);
+    std::iota(buf.begin(), buf.end(), 0);
+
+    const auto view = make_tensor_view(HostTensorDescriptor({3, 4}), buf.data());
+
+    EXPECT_EQ(view(2, 1), 9);
+    EXPECT_EQ(view.size(), 12);
+}
+
+TEST(TensorView, Slice)
+{
+    auto t = make_sequential_tensor({4, 6});
+
+    const auto view = make_tensor_view(t).Slice(1, 1, 6, 2);
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{4, 3}));
+    EXPECT_FALSE(view.IsPacked());
+    EXPECT_EQ(view(0, 0), 1.f);
+    EXPECT_EQ(view(0, 2), 5.f);
+    EXPECT_EQ(view(3, 1), 21.f);
+    EXPECT_THROW(make_tensor_view(t).Slice(0, 2, 5), std::runtime_error);
+}
+
+TEST(TensorView, Select)
+{
+    auto t = make_sequential_tensor({2, 3, 4});
+
+    const auto view = make_tensor_view(t).Select(1, 2);
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{2, 4}));
+    EXPECT_EQ(view(1, 3), t(1, 2, 3));
+}
+
+TEST(TensorView, Permute)
+{
+    auto t = make_sequential_tensor({2, 3, 4});
+
+    const auto view = make_tensor_view(t).Permute({2, 0, 1});
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{4, 2, 3}));
+    for(std::size_t i = 0; i < 2; ++i)
+        for(std::size_t j = 0; j < 3; ++j)
+            for(std::size_t k = 0; k < 4; ++k)
+                EXPECT_EQ(view(k, i, j), t(i, j, k));
+}
+
+TEST(TensorView, Broadcast)
+{
+    auto t = make_sequential_tensor({3, 1});
+
+    const auto view = make_tensor_view(t).Broadcast({2, 3, 5});
+
+    EXPECT_EQ(view.GetStrides(), (std::vector<std::size_t>{0, 1, 0}));
+    EXPECT_EQ(view(1, 2, 4), 2.f);
+    EXPECT_EQ(view.size(), 30);
+    EXPECT_THROW(make_tensor_view(t).Broadcast({4, 5}), std::runtime_error);
+}
+
+TEST(TensorView, Reshape)
+{
+    auto t = make_sequential_tensor({2, 3, 4});
+
+    const auto merged = make_tensor_view(t).Reshape({6, 4});
+    EXPECT_EQ(merged.GetStrides(), (std::vector<std::size_t>{4, 1}));
+    EXPECT_EQ(merged(5, 3), 23.f);
+
+    const auto split = make_tensor_view(t).Reshape({2, 3, 2, 1, 2});
+    EXPECT_EQ(split(1, 2, 1, 0, 1), 23.f);
+
+    // transposed inner dimensions can still be split, but not merged
+    const auto transposed = make_tensor_view(t).Permute({0, 2, 1});
+    EXPECT_NO_THROW(transposed.Reshape({2, 2, 2, 3}));
+    EXPECT_EQ(transposed.Reshape({2, 2, 2, 3})(1, 1, 1, 2), t(1, 2, 3));
+    EXPECT_THROW(transposed.Reshape({2, 12}), std::runtime_error);
+}
+
+TEST(TensorView, IteratesInLogicalOrder)
+{
+    auto t = make_sequential_tensor({2, 3});
+
+    const auto view = make_tensor_view(t).Permute({1, 0});
+
+    const std::vector<float> expected{0, 3, 1, 4, 2, 5};
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), expected.begin(), expected.end()));
+}
+
+TEST(TensorView, IteratorsOutliveTemporaryView)
+{
+    auto t = make_sequential_tensor({2, 3});
+
+    // the view the iterators were made from is gone
+    const auto first = make_tensor_view(t).Permute({1, 0}).begin();
+    const auto last  = make_tensor_view(t).Permute({1, 0}).end();
+
+    const std::vector<float> expected{0, 3, 1, 4, 2, 5};
+    EXPECT_TRUE(std::equal(first, last, expected.begin(), expected.end()));
+    EXPECT_EQ(*(last - 1), 5.f);
+}
+
+TEST(TensorView, CheckErrAcceptsViews)
+{
+    auto t  = make_sequential_tensor({3, 4});
+    auto tt = make_sequential_tensor({4, 3});
+
+    tt.ForEach([&](auto& self, auto idx) { self(idx) = t(idx[1], idx[0]); });
+
+    EXPECT_TRUE(ck::utils::check_err(make_tensor_view(tt).Permute({1, 0}), t));
+    EXPECT_FALSE(ck::utils::check_err(make_tensor_view(tt), t.mData));
+}
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/environment.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+using ck::utils::ReferenceCache;
+using ck::utils::ReferenceCacheKey;
+
+namespace {
+
+struct DummyReference
+{
+};
+
+struct Scale
+{
+    float scale_;
+};
+
+class TestReferenceCache : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        dir_ = ::testing::TempDir() + "ck_test_reference_cache";
+        std::filesystem::remove_all(dir_);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir_); }
+
+    std::string dir_;
+};
+
+Tensor<float> make_iota(std::size_t m, std::size_t n, float start = 0)
+{
+    Tensor<float> t({m, n});
+    float v = start;
+    for(auto& x : t.mData)
+        x = v++;
+    return t;
+}
+
+} // namespace
+
+TEST(ReferenceCacheKey, DependsOnOpParametersAndData)
+{
+    const auto a = make_iota(4, 8);
+    auto b       = make_iota(4, 8);
+
+    // element-op parameters by member
+    const auto key = ReferenceCacheKey::Make<DummyReference>().AddAll(Scale{2.f}.scale_, a);
+
+    EXPECT_EQ(key, ReferenceCacheKey::Make<DummyReference>().AddAll(Scale{2.f}.scale_, b));
+    EXPECT_EQ(key.ToString().size(), 32);
+
+    EXPECT_FALSE(key == ReferenceCacheKey::Make<Scale>().AddAll(Scale{2.f}.scale_, b));
+    EXPECT_FALSE(key == ReferenceCacheKey::Make<DummyReference>().AddAll(Scale{3.f}.scale_, b));
+
+    // same data, different layout
+    Tensor<float> bt({8, 4}, {1, 8});
+    bt.mData = b.mData;
+    EXPECT_FALSE(key == ReferenceCacheKey::Make<DummyReference>().AddAll(Scale{2.f}.scale_, bt));
+
+    b.mData[17] += 1.f;
+    EXPECT_FALSE(key == ReferenceCacheKey::Make<DummyReference>().AddAll(Scale{2.f}.scale_, b));
+}
+
+TEST_F(TestReferenceCache, StoreAndLoad)
+{
+    ReferenceCache cache(dir_, 1 << 20);
+
+    const auto key   = ReferenceCacheKey::Make<DummyReference>().Add(make_iota(2, 3));
+    const auto other = ReferenceCacheKey::Make<DummyReference>().Add(make_iota(2, 3, 1));
+
+    Tensor<float> out({2, 3});
+    EXPECT_FALSE(cache.Load(key, out));
+
+    const auto ref = make_iota(2, 3, 5);
+    cache.Store(key, ref);
+
+    EXPECT_TRUE(cache.Load(key, out));
+    EXPECT_EQ(out.mData, ref.mData);
+
+    EXPECT_FALSE(cache.Load(other, out));
+
+    // size mismatch is a miss
+    Tensor<float> wrong({3, 3});
+    EXPECT_FALSE(cache.Load(key, wrong));
+}
+
+TEST_F(TestReferenceCache, RunReferenceCachedSkipsReferenceOnHit)
+{
+    ReferenceCache cache(dir_, 1 << 20);
+
+    const auto key = ReferenceCacheKey::Make<DummyReference>().Add(std::string("gemm"));
+
+    int num_runs = 0;
+    auto run     = [&](Tensor<float>& out) {
+        return ck::utils::run_reference_cached(
+            key,
+            out,
+            [&]() {
+                ++num_runs;
+                out = make_iota(16, 16, 3);
+            },
+            &cache);
+    };
+
+    Tensor<float> out0({16, 16});
+    EXPECT_FALSE(run(out0));
+
+    Tensor<float> out1({16, 16});
+    EXPECT_TRUE(run(out1));
+
+    EXPECT_EQ(num_runs, 1);
+    EXPECT_EQ(out0.mData, out1.mData);
+}
+
+TEST_F(TestReferenceCache, RunReferenceCachedMakesKeyOnlyWithCache)
+{
+    ReferenceCache cache(dir_, 1 << 20);
+
+    int num_keys = 0;
+    auto make_key = [&]() {
+        ++num_keys;
+        return ReferenceCacheKey::Make<DummyReference>().Add(std::string("gemm"));
+    };
+
+    Tensor<float> out({4, 4});
+
+    ck::utils::run_reference_cached(make_key, out, [] {}, nullptr);
+    EXPECT_EQ(num_keys, 0);
+
+    ck::utils::run_reference_cached(make_key, out, [] {}, &cache);
+    EXPECT_EQ(num_keys, 1);
+}
+
+TEST_F(TestReferenceCache, KeyIgnoresEmptyStructs)
+{
+    struct Empty
+    {
+    };
+
+    EXPECT_TRUE(ReferenceCacheKey::Make<DummyReference>().Add(Empty{}).Add(1) ==
+                ReferenceCacheKey::Make<DummyReference>().Add(1));
+    EXPECT_FALSE(ReferenceCacheKey::Make<DummyReference>().Add(1.5f) ==
+                 ReferenceCacheKey::Make<DummyReference>().Add(2.5f));
+}
+
+TEST_F(TestReferenceCache, TrimEvictsLeastRecentlyUsed)
+{
+    ReferenceCache cache(dir_, std::size_t{1} << 30);
+
+    std::vector<ReferenceCacheKey> keys;
+    for(int i = 0; i < 3; ++i)
+    {
+        keys.push_back(ReferenceCacheKey::Make<DummyReference>().Add(i));
+        cache.Store(keys.back(), make_iota(64, 64, i));
+    }
+
+    // make the oldest entry the most recently used one
+    const auto now = std::filesystem::file_time_type::clock::now();
+    for(auto& entry : std::filesystem::directory_iterator(dir_))
+        std::filesystem::last_write_time(entry.path(), now - std::chrono::hours(1));
+
+    Tensor<float> out({64, 64});
+    EXPECT_TRUE(cache.Load(keys[0], out));
+
+    const std::size_t entry_bytes = cache.GetSizeInBytes() / 3;
+    cache.Trim(entry_bytes + entry_bytes / 2);
+
+    EXPECT_LE(cache.GetSizeInBytes(), entry_bytes + entry_bytes / 2);
+    EXPECT_TRUE(cache.Load(keys[0], out));
+    EXPECT_FALSE(cache.Load(keys[1], out));
+    EXPECT_FALSE(cache.Load(keys[2], out));
+}
+
+TEST(Environment, GetEnvUnsigned)
+{
+    const char* name = "CK_TEST_ENVIRONMENT_UNSIGNED";
+
+    unsetenv(name);
+    EXPECT_EQ(ck::utils::GetEnvUnsigned(name, 7), 7);
+
+    setenv(name, "4096", 1);
+    EXPECT_EQ(ck::utils::GetEnvUnsigned(name, 7), 4096);
+
+    for(const char* str : {"", "abc", "12MB", "-1", " 1", "99999999999999999999999"})
+    {
+        setenv(name, str, 1);
+        EXPECT_EQ(ck::utils::GetEnvUnsigned(name, 7), std::nullopt) << str;
+    }
+
+    unsetenv(name);
+}
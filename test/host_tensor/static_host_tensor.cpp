@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+TEST(StaticHostTensorDescriptor, MatchesDynamicDescriptor)
+{
+    const HostTensorDescriptor dynamic({3, 4, 5}, {1, 3, 12});
+    const StaticHostTensorDescriptor<3> desc(dynamic);
+
+    EXPECT_EQ(desc.GetNumOfDimension(), 3);
+    EXPECT_EQ(desc.GetElementSize(), dynamic.GetElementSize());
+    EXPECT_EQ(desc.GetElementSpaceSize(), dynamic.GetElementSpaceSize());
+
+    for(std::size_t i = 0; i < 3; ++i)
+        for(std::size_t j = 0; j < 4; ++j)
+            for(std::size_t k = 0; k < 5; ++k)
+            {
+                EXPECT_EQ(desc.GetOffsetFromMultiIndex(i, j, k),
+                          dynamic.GetOffsetFromMultiIndex(i, j, k));
+                EXPECT_EQ(desc.GetOffsetFromMultiIndex(std::vector<std::size_t>{i, j, k}),
+                          dynamic.GetOffsetFromMultiIndex(i, j, k));
+            }
+
+    const HostTensorDescriptor back = desc;
+    EXPECT_EQ(back.GetLengths(), dynamic.GetLengths());
+    EXPECT_EQ(back.GetStrides(), dynamic.GetStrides());
+
+    const StaticHostTensorDescriptor<2> packed{2, 3};
+    EXPECT_EQ(packed.GetStrides()[0], 3);
+    EXPECT_EQ(packed.GetStrides()[1], 1);
+
+    EXPECT_THROW((StaticHostTensorDescriptor<2>(dynamic)), std::runtime_error);
+}
+
+TEST(StaticTensor, InteroperatesWithTensor)
+{
+    Tensor<int> dynamic({4, 6});
+    for(std::size_t i = 0; i < dynamic.mData.size(); ++i)
+        dynamic.mData[i] = static_cast<int>(i);
+
+    StaticTensor<int, 2> tensor(dynamic);
+    EXPECT_EQ(tensor(2, 3), dynamic(2, 3));
+
+    tensor(1, 1) = -1;
+    const auto copy = tensor.ToTensor();
+    EXPECT_EQ(copy(1, 1), -1);
+    EXPECT_EQ(copy.GetLengths(), dynamic.GetLengths());
+
+    // zero-copy views in both directions
+    const StaticTensorView<int, 2> view{dynamic};
+    view(0, 5) = 42;
+    EXPECT_EQ(dynamic(0, 5), 42);
+
+    const TensorView<const int> dynamic_view = tensor;
+    EXPECT_EQ(dynamic_view(1, 1), -1);
+
+    const StaticTensorView<const int, 2> transposed{make_tensor_view(dynamic).Permute({1, 0})};
+    EXPECT_EQ(transposed(5, 0), 42);
+}
+
+TEST(StaticTensor, ReferenceGemm)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    StaticTensor<float, 2> a({5, 7});
+    Tensor<float> b({7, 3});
+    StaticTensor<float, 2> c({5, 3});
+
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        a.mData[i] = static_cast<float>(i % 5) - 2.f;
+    for(std::size_t i = 0; i < b.mData.size(); ++i)
+        b.mData[i] = static_cast<float>(i % 3) + 1.f;
+
+    auto ref_gemm     = ReferenceGemm{};
+    auto ref_argument = ref_gemm.MakeArgument(a, b, c, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    for(std::size_t m = 0; m < 5; ++m)
+        for(std::size_t n = 0; n < 3; ++n)
+        {
+            float expected = 0;
+            for(std::size_t k = 0; k < 7; ++k)
+                expected += a(m, k) * b(k, n);
+
+            EXPECT_EQ(c(m, n), expected);
+        }
+}
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/tensor_io.hpp"
+
+namespace {
+
+class TensorIo : public ::testing::Test
+{
+    protected:
+    std::string TempPath(const std::string& name)
+    {
+        auto path = ::testing::TempDir() + "ck_test_tensor_io_" + name;
+        paths_.push_back(path);
+        return path;
+    }
+
+    void TearDown() override
+    {
+        for(const auto& path : paths_)
+            std::remove(path.c_str());
+    }
+
+    std::vector<std::string> paths_;
+};
+
+template <typename T>
+Tensor<T> make_tensor(std::initializer_list<std::size_t> lens)
+{
+    Tensor<T> t(lens);
+    ck::utils::FillUniformDistributionIntegerValue<T>{-5.f, 5.f}(t.begin(), t.end());
+    return t;
+}
+
+} // namespace
+
+TEST_F(TensorIo, NpyHeaderRoundTrip)
+{
+    const std::string header =
+        ck::utils::MakeNpyHeader(ck::utils::TensorFileDataType::F16, {3, 5, 7});
+
+    EXPECT_EQ(header.size() % 64, 0);
+
+    const auto parsed =
+        ck::utils::ParseNpyHeader(reinterpret_cast<const std::byte*>(header.data()),
+                                  header.size() + sizeof(ck::half_t) * 3 * 5 * 7);
+
+    EXPECT_EQ(parsed.entry.type, ck::utils::TensorFileDataType::F16);
+    EXPECT_EQ(parsed.entry.lengths, (std::vector<std::size_t>{3, 5, 7}));
+    EXPECT_EQ(parsed.entry.begin, header.size());
+    EXPECT_FALSE(parsed.fortran_order);
+}
+
+TEST_F(TensorIo, NpyParsesNumpyWrittenHeader)
+{
+    // header as written by numpy.save for np.zeros((2, 3), dtype=np.int32, order='F')
+    std::string dict = "{'descr': '<i4', 'fortran_order': True, 'shape': (2, 3), }";
+    dict.append(64 - (10 + dict.size() + 1) % 64, ' ');
+    dict.push_back('\n');
+
+    std::string file("\x93NUMPY\x01\x00", 8);
+    file.push_back(static_cast<char>(dict.size() & 0xff));
+    file.push_back(static_cast<char>(dict.size() >> 8));
+    file += dict;
+
+    const std::vector<int32_t> data{0, 3, 1, 4, 2, 5}; // column-major 2x3
+    file.append(reinterpret_cast<const char*>(data.data()), sizeof(int32_t) * data.size());
+
+    const auto path = TempPath("fortran.npy");
+    std::ofstream(path, std::ios::binary).write(file.data(), file.size());
+
+    const auto view = ck::utils::LoadNpy<int32_t>(path);
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{2, 3}));
+    EXPECT_EQ(view(0, 1), 1);
+    EXPECT_EQ(view(1, 0), 3);
+    EXPECT_EQ(view(1, 2), 5);
+}
+
+TEST_F(TensorIo, NpySaveLoad)
+{
+    const auto path = TempPath("save.npy");
+    const auto src  = make_tensor<float>({4, 6, 8});
+
+    ck::utils::SaveNpy(path, src);
+
+    const auto loaded = ck::utils::LoadNpy<float>(path);
+
+    EXPECT_EQ(loaded.GetLengths(), src.GetLengths());
+    EXPECT_TRUE(ck::utils::check_err(loaded, src));
+    EXPECT_THROW(ck::utils::LoadNpy<ck::half_t>(path), std::runtime_error);
+}
+
+TEST_F(TensorIo, NpySaveStridedView)
+{
+    const auto path = TempPath("strided.npy");
+    const auto src  = make_tensor<int8_t>({5, 7});
+
+    const auto transposed = TensorView<const int8_t>{src}.Permute({1, 0});
+
+    ck::utils::SaveNpy(path, transposed);
+
+    const auto loaded = ck::utils::LoadNpy<int8_t>(path);
+
+    EXPECT_EQ(loaded.GetLengths(), (std::vector<std::size_t>{7, 5}));
+    EXPECT_TRUE(loaded.IsPacked());
+    EXPECT_TRUE(ck::utils::check_err(loaded, transposed));
+}
+
+TEST_F(TensorIo, NpyCreateWritesThroughMapping)
+{
+    const auto path = TempPath("create.npy");
+    const auto src  = make_tensor<ck::half_t>({3, 9});
+
+    {
+        auto out = ck::utils::CreateNpy<ck::half_t>(path, {3, 9});
+        std::copy(src.begin(), src.end(), out.data());
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(ck::utils::LoadNpy<ck::half_t>(path), src));
+}
+
+TEST_F(TensorIo, SafeTensorsRoundTrip)
+{
+    const auto path = TempPath("model.safetensors");
+
+    const auto w = make_tensor<ck::bhalf_t>({16, 8});
+    const auto b = make_tensor<int32_t>({8});
+    const auto q = make_tensor<int8_t>({3, 3, 3});
+
+    {
+        ck::utils::SafeTensorsWriter writer(
+            path,
+            {{"w", ck::utils::TensorFileDataType::BF16, {16, 8}},
+             {"b", ck::utils::TensorFileDataType::I32, {8}},
+             {"q", ck::utils::TensorFileDataType::I8, {3, 3, 3}}},
+            {{"format", "pt"}});
+
+        writer.Write("w", w);
+        writer.Write("b", b);
+        writer.Write("q", q);
+    }
+
+    ck::utils::SafeTensorsFile file(path);
+
+    EXPECT_EQ(file.GetNames(), (std::vector<std::string>{"b", "q", "w"}));
+    EXPECT_EQ(file.GetMetadata().at("format"), "pt");
+    EXPECT_EQ(file.GetEntry("w").begin % 8, 0);
+
+    EXPECT_TRUE(ck::utils::check_err(file.Get<ck::bhalf_t>("w"), w));
+    EXPECT_TRUE(ck::utils::check_err(file.Get<int32_t>("b"), b));
+    EXPECT_TRUE(ck::utils::check_err(file.Get<int8_t>("q"), q));
+
+    EXPECT_THROW(file.Get<float>("w"), std::runtime_error);
+    EXPECT_THROW(file.Get<float>("missing"), std::runtime_error);
+}
+
+TEST_F(TensorIo, NpyBf16Descr)
+{
+    const std::string header =
+        ck::utils::MakeNpyHeader(ck::utils::TensorFileDataType::BF16, {2});
+
+    // as numpy writes 2-byte void
+    EXPECT_NE(header.find("'descr': '|V2'"), std::string::npos);
+
+    const auto path = TempPath("bf16.npy");
+    const auto src  = make_tensor<ck::bhalf_t>({4, 4});
+
+    ck::utils::SaveNpy(path, src);
+
+    EXPECT_TRUE(ck::utils::check_err(ck::utils::LoadNpy<ck::bhalf_t>(path), src));
+}
+
+TEST_F(TensorIo, SafeTensorsUnaligned)
+{
+    const auto path = TempPath("unaligned.safetensors");
+
+    const auto q  = make_tensor<int8_t>({3});
+    const auto xt = make_tensor<float>({3, 2});
+    const auto b  = make_tensor<int32_t>({5, 1});
+
+    // strided
+    const auto x = TensorView<const float>{xt}.Permute({1, 0});
+
+    {
+        ck::utils::SafeTensorsWriter writer(path,
+                                            {{"q", ck::utils::TensorFileDataType::I8, {3}},
+                                             {"x", ck::utils::TensorFileDataType::F32, {2, 3}},
+                                             {"b", ck::utils::TensorFileDataType::I32, {5, 1}}});
+
+        EXPECT_THROW(writer.Get<float>("x"), std::runtime_error);
+
+        writer.Write("q", q);
+        writer.Write("x", x);
+        writer.Write("b", b);
+    }
+
+    ck::utils::SafeTensorsFile file(path);
+
+    EXPECT_EQ(file.GetEntry("x").begin % 4, 3);
+
+    const auto loaded_x = file.Get<float>("x");
+
+    EXPECT_TRUE(loaded_x.IsCopy());
+    EXPECT_TRUE(ck::utils::check_err(loaded_x, x));
+    EXPECT_TRUE(ck::utils::check_err(file.Get<int32_t>("b"), b));
+    EXPECT_FALSE(file.Get<int8_t>("q").IsCopy());
+}
+
+TEST_F(TensorIo, MappedTensorOutlivesFileObject)
+{
+    const auto path = TempPath("lifetime.safetensors");
+    const auto src  = make_tensor<float>({2, 2});
+
+    ck::utils::SafeTensorsWriter(path, {{"x", ck::utils::TensorFileDataType::F32, {2, 2}}})
+        .Write("x", src);
+
+    const auto view = ck::utils::SafeTensorsFile(path).Get<float>("x");
+
+    EXPECT_TRUE(ck::utils::check_err(view, src));
+}
@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/quantization/grouped_convolution_bias_forward_perchannel_quantization.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+namespace {
+
+using InLayout           = ck::tensor_layout::convolution::GNHWC;
+using WeiLayout          = ck::tensor_layout::convolution::GKYXC;
+using BiasLayout         = ck::tensor_layout::convolution::G_K;
+using RequantScaleLayout = ck::tensor_layout::convolution::G_K;
+using OutLayout          = ck::tensor_layout::convolution::GNHWK;
+
+using PassThrough  = ck::tensor_operation::element_wise::PassThrough;
+using ActivationOp = ck::tensor_operation::element_wise::Relu;
+using OutElementOp = ck::tensor_operation::element_wise::Add_Activation_Mul2_Clamp<ActivationOp>;
+
+// int8 conv2d with a per-channel bias and requantization scale, the D tensors
+using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD<
+    2,
+    InLayout,
+    WeiLayout,
+    ck::Tuple<BiasLayout, RequantScaleLayout>,
+    OutLayout,
+    int8_t,
+    int8_t,
+    ck::Tuple<int32_t, float>,
+    int8_t,
+    PassThrough,
+    PassThrough,
+    OutElementOp>;
+
+} // namespace
+
+// an argument made for one set of buffers, D tensors included, and run on another, against one
+// made for the latter directly
+TEST(RebindArgument, ConvFwdMultipleD)
+{
+    constexpr ck::index_t G  = 1;
+    constexpr ck::index_t N  = 4;
+    constexpr ck::index_t K  = 64;
+    constexpr ck::index_t C  = 32;
+    constexpr ck::index_t Y  = 3;
+    constexpr ck::index_t X  = 3;
+    constexpr ck::index_t Hi = 71;
+    constexpr ck::index_t Wi = 71;
+    constexpr ck::index_t Ho = 36;
+    constexpr ck::index_t Wo = 36;
+
+    const std::array<ck::index_t, 5> in_lengths{G, N, C, Hi, Wi};
+    const std::array<ck::index_t, 5> in_strides{N * Hi * Wi * C, Hi * Wi * C, 1, Wi * C, C};
+    const std::array<ck::index_t, 5> wei_lengths{G, K, C, Y, X};
+    const std::array<ck::index_t, 5> wei_strides{K * Y * X * C, Y * X * C, 1, X * C, C};
+    const std::array<ck::index_t, 5> d_lengths{G, N, K, Ho, Wo};
+    const std::array<ck::index_t, 5> d_strides{K, 0, 1, 0, 0};
+    const std::array<ck::index_t, 5> out_lengths{G, N, K, Ho, Wo};
+    const std::array<ck::index_t, 5> out_strides{N * Ho * Wo * K, Ho * Wo * K, 1, Wo * K, K};
+    const std::array<ck::index_t, 2> conv_strides{2, 2};
+    const std::array<ck::index_t, 2> conv_dilations{1, 1};
+    const std::array<ck::index_t, 2> in_left_pads{1, 1};
+    const std::array<ck::index_t, 2> in_right_pads{1, 1};
+
+    const std::size_t in_size  = G * N * Hi * Wi * C;
+    const std::size_t wei_size = G * K * Y * X * C;
+    const std::size_t out_size = G * N * Ho * Wo * K;
+
+    Tensor<int8_t> in({in_size});
+    Tensor<int8_t> wei({wei_size});
+    Tensor<int32_t> bias({G * K});
+    Tensor<float> requant_scale({G * K});
+    Tensor<int8_t> out({out_size});
+    Tensor<int8_t> out_ref({out_size});
+    Tensor<int8_t> out_unused({out_size});
+
+    in.GenerateTensorValue(GeneratorTensor_2<int8_t>{-5, 5});
+    wei.GenerateTensorValue(GeneratorTensor_2<int8_t>{-5, 5});
+    bias.GenerateTensorValue(GeneratorTensor_2<int32_t>{-128, 128});
+    requant_scale.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 0.1f});
+
+    // buffers the rebound arguments are made for, never written
+    DeviceMem in_unused_buf(sizeof(int8_t) * in_size);
+    DeviceMem wei_unused_buf(sizeof(int8_t) * wei_size);
+    DeviceMem bias_unused_buf(sizeof(int32_t) * G * K);
+    DeviceMem requant_scale_unused_buf(sizeof(float) * G * K);
+    DeviceMem out_unused_buf(sizeof(int8_t) * out_size);
+
+    DeviceMem in_buf(sizeof(int8_t) * in_size);
+    DeviceMem wei_buf(sizeof(int8_t) * wei_size);
+    DeviceMem bias_buf(sizeof(int32_t) * G * K);
+    DeviceMem requant_scale_buf(sizeof(float) * G * K);
+    DeviceMem out_buf(sizeof(int8_t) * out_size);
+    DeviceMem out_ref_buf(sizeof(int8_t) * out_size);
+
+    in_buf.ToDevice(in.mData.data());
+    wei_buf.ToDevice(wei.mData.data());
+    bias_buf.ToDevice(bias.mData.data());
+    requant_scale_buf.ToDevice(requant_scale.mData.data());
+
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+            DeviceOp>::GetInstances();
+
+    int num_rebound = 0;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto ref_argument_ptr = op_ptr->MakeArgumentPointer(
+            in_buf.GetDeviceBuffer(),
+            wei_buf.GetDeviceBuffer(),
+            {bias_buf.GetDeviceBuffer(), requant_scale_buf.GetDeviceBuffer()},
+            out_ref_buf.GetDeviceBuffer(),
+            in_lengths,
+            in_strides,
+            wei_lengths,
+            wei_strides,
+            {d_lengths, d_lengths},
+            {d_strides, d_strides},
+            out_lengths,
+            out_strides,
+            conv_strides,
+            conv_dilations,
+            in_left_pads,
+            in_right_pads,
+            PassThrough{},
+            PassThrough{},
+            OutElementOp{ActivationOp{}});
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            in_unused_buf.GetDeviceBuffer(),
+            wei_unused_buf.GetDeviceBuffer(),
+            {bias_unused_buf.GetDeviceBuffer(), requant_scale_unused_buf.GetDeviceBuffer()},
+            out_unused_buf.GetDeviceBuffer(),
+            in_lengths,
+            in_strides,
+            wei_lengths,
+            wei_strides,
+            {d_lengths, d_lengths},
+            {d_strides, d_strides},
+            out_lengths,
+            out_strides,
+            conv_strides,
+            conv_dilations,
+            in_left_pads,
+            in_right_pads,
+            PassThrough{},
+            PassThrough{},
+            OutElementOp{ActivationOp{}});
+
+        if(!op_ptr->IsSupportedArgument(ref_argument_ptr.get()))
+        {
+            continue;
+        }
+
+        // inputs are A, B, then the D tensors
+        EXPECT_TRUE(argument_ptr->SetInputPointer(0, in_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetInputPointer(1, wei_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetInputPointer(2, bias_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetInputPointer(3, requant_scale_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetInputPointer(4, in_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetOutputPointer(0, out_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(op_ptr->SetElementwiseOps(
+            argument_ptr.get(), PassThrough{}, PassThrough{}, OutElementOp{ActivationOp{}}));
+
+        out_buf.SetZero();
+        out_ref_buf.SetZero();
+        out_unused_buf.SetZero();
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        invoker_ptr->Run(ref_argument_ptr.get());
+        invoker_ptr->Run(argument_ptr.get());
+
+        out_buf.FromDevice(out.mData.data());
+        out_ref_buf.FromDevice(out_ref.mData.data());
+        out_unused_buf.FromDevice(out_unused.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(out.mData, out_ref.mData)) << op_ptr->GetTypeString();
+        EXPECT_TRUE(ck::utils::check_err(out_unused.mData, std::vector<int8_t>(out_size)))
+            << op_ptr->GetTypeString();
+
+        ++num_rebound;
+    }
+
+    EXPECT_GT(num_rebound, 0);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceOp = ck::tensor_operation::device::DeviceGemm<Row,
+                                                          Col,
+                                                          Row,
+                                                          ck::half_t,
+                                                          ck::half_t,
+                                                          ck::half_t,
+                                                          PassThrough,
+                                                          PassThrough,
+                                                          PassThrough>;
+
+} // namespace
+
+// an argument made for one set of buffers and run on another
+TEST(RebindArgument, Gemm)
+{
+    constexpr ck::index_t M = 256;
+    constexpr ck::index_t N = 512;
+    constexpr ck::index_t K = 128;
+
+    Tensor<ck::half_t> a_m_k({M, K}, {K, 1});
+    Tensor<ck::half_t> b_k_n({K, N}, {1, K});
+    Tensor<ck::half_t> c_m_n({M, N}, {N, 1});
+    Tensor<ck::half_t> c_m_n_ref({M, N}, {N, 1});
+    Tensor<ck::half_t> c_m_n_unused({M, N}, {N, 1});
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<ck::half_t>{-5, 5});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<ck::half_t>{-5, 5});
+
+    auto ref_gemm = ck::tensor_operation::host::ReferenceGemm<ck::half_t,
+                                                              ck::half_t,
+                                                              ck::half_t,
+                                                              float,
+                                                              PassThrough,
+                                                              PassThrough,
+                                                              PassThrough>{};
+
+    ref_gemm.MakeInvoker().Run(ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n_ref, {}, {}, {}));
+
+    // buffers the arguments are made for, never written
+    DeviceMem a_unused_buf(sizeof(ck::half_t) * M * K);
+    DeviceMem b_unused_buf(sizeof(ck::half_t) * K * N);
+    DeviceMem c_unused_buf(sizeof(ck::half_t) * M * N);
+
+    DeviceMem a_buf(sizeof(ck::half_t) * M * K);
+    DeviceMem b_buf(sizeof(ck::half_t) * K * N);
+    DeviceMem c_buf(sizeof(ck::half_t) * M * N);
+
+    a_buf.ToDevice(a_m_k.mData.data());
+    b_buf.ToDevice(b_k_n.mData.data());
+
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+            DeviceOp>::GetInstances();
+
+    int num_rebound = 0;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a_unused_buf.GetDeviceBuffer(),
+                                                        b_unused_buf.GetDeviceBuffer(),
+                                                        c_unused_buf.GetDeviceBuffer(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        K,
+                                                        K,
+                                                        N,
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()) ||
+           !argument_ptr->SetInputPointer(0, a_buf.GetDeviceBuffer()))
+        {
+            continue;
+        }
+
+        EXPECT_TRUE(argument_ptr->SetInputPointer(1, b_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetOutputPointer(0, c_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetInputPointer(2, a_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetOutputPointer(1, c_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(op_ptr->SetElementwiseOps(
+            argument_ptr.get(), PassThrough{}, PassThrough{}, PassThrough{}));
+
+        c_buf.SetZero();
+        c_unused_buf.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get());
+
+        c_buf.FromDevice(c_m_n.mData.data());
+        c_unused_buf.FromDevice(c_m_n_unused.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(c_m_n.mData, c_m_n_ref.mData))
+            << op_ptr->GetTypeString();
+        EXPECT_TRUE(ck::utils::check_err(c_m_n_unused.mData, std::vector<ck::half_t>(M * N)))
+            << op_ptr->GetTypeString();
+
+        ++num_rebound;
+    }
+
+    EXPECT_GT(num_rebound, 0);
+}
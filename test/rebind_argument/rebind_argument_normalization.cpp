@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_normalization.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/normalization.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// layernorm of the rows of a M x N matrix
+using DeviceOp = ck::tensor_operation::device::
+    DeviceNormalization<float, float, float, float, float, PassThrough, 2, 1>;
+
+} // namespace
+
+// an argument made for one set of buffers and run on another, against one made for the latter
+// directly
+TEST(RebindArgument, Normalization)
+{
+    constexpr ck::index_t M = 128;
+    constexpr ck::index_t N = 1024;
+
+    constexpr float epsilon = 1e-4f;
+
+    const std::vector<ck::index_t> lengths{M, N};
+    const std::vector<ck::index_t> x_strides{N, 1};
+    const std::vector<ck::index_t> gamma_beta_strides{0, 1};
+    const std::vector<ck::index_t> reduce_dims{1};
+
+    Tensor<float> x({M, N}, {N, 1});
+    Tensor<float> gamma({N}, {1});
+    Tensor<float> beta({N}, {1});
+    Tensor<float> y({M, N}, {N, 1});
+    Tensor<float> y_ref({M, N}, {N, 1});
+    Tensor<float> y_unused({M, N}, {N, 1});
+
+    x.GenerateTensorValue(GeneratorTensor_3<float>{-1, 1});
+    gamma.GenerateTensorValue(GeneratorTensor_3<float>{-1, 1});
+    beta.GenerateTensorValue(GeneratorTensor_3<float>{-1, 1});
+
+    // buffers the rebound arguments are made for, never written
+    DeviceMem x_unused_buf(sizeof(float) * M * N);
+    DeviceMem gamma_unused_buf(sizeof(float) * N);
+    DeviceMem beta_unused_buf(sizeof(float) * N);
+    DeviceMem y_unused_buf(sizeof(float) * M * N);
+
+    DeviceMem x_buf(sizeof(float) * M * N);
+    DeviceMem gamma_buf(sizeof(float) * N);
+    DeviceMem beta_buf(sizeof(float) * N);
+    DeviceMem y_buf(sizeof(float) * M * N);
+    DeviceMem y_ref_buf(sizeof(float) * M * N);
+
+    x_buf.ToDevice(x.mData.data());
+    gamma_buf.ToDevice(gamma.mData.data());
+    beta_buf.ToDevice(beta.mData.data());
+
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+            DeviceOp>::GetInstances();
+
+    int num_rebound = 0;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto ref_argument_ptr = op_ptr->MakeArgumentPointer(lengths,
+                                                            x_strides,
+                                                            gamma_beta_strides,
+                                                            gamma_beta_strides,
+                                                            x_strides,
+                                                            reduce_dims,
+                                                            epsilon,
+                                                            x_buf.GetDeviceBuffer(),
+                                                            gamma_buf.GetDeviceBuffer(),
+                                                            beta_buf.GetDeviceBuffer(),
+                                                            y_ref_buf.GetDeviceBuffer(),
+                                                            nullptr,
+                                                            nullptr,
+                                                            PassThrough{});
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(lengths,
+                                                        x_strides,
+                                                        gamma_beta_strides,
+                                                        gamma_beta_strides,
+                                                        x_strides,
+                                                        reduce_dims,
+                                                        epsilon,
+                                                        x_unused_buf.GetDeviceBuffer(),
+                                                        gamma_unused_buf.GetDeviceBuffer(),
+                                                        beta_unused_buf.GetDeviceBuffer(),
+                                                        y_unused_buf.GetDeviceBuffer(),
+                                                        nullptr,
+                                                        nullptr,
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(ref_argument_ptr.get()))
+        {
+            continue;
+        }
+
+        EXPECT_TRUE(argument_ptr->SetInputPointer(0, x_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetInputPointer(1, gamma_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetInputPointer(2, beta_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetOutputPointer(0, y_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(op_ptr->SetElementwiseOps(argument_ptr.get(), PassThrough{}));
+
+        // the saved mean and inverse variance are not kept by the argument
+        EXPECT_FALSE(argument_ptr->SetOutputPointer(1, y_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetOutputPointer(2, y_buf.GetDeviceBuffer()));
+
+        y_buf.SetZero();
+        y_ref_buf.SetZero();
+        y_unused_buf.SetZero();
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        invoker_ptr->Run(ref_argument_ptr.get());
+        invoker_ptr->Run(argument_ptr.get());
+
+        y_buf.FromDevice(y.mData.data());
+        y_ref_buf.FromDevice(y_ref.mData.data());
+        y_unused_buf.FromDevice(y_unused.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(y.mData, y_ref.mData)) << op_ptr->GetTypeString();
+        EXPECT_TRUE(ck::utils::check_err(y_unused.mData, std::vector<float>(M * N)))
+            << op_ptr->GetTypeString();
+
+        ++num_rebound;
+    }
+
+    EXPECT_GT(num_rebound, 0);
+}
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/device/device_reduce.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// sum of the rows of a M x K matrix
+using ReduceInstanceFactory =
+    ck::tensor_operation::device::instance::DeviceReduceInstanceFactory<float,
+                                                                        float,
+                                                                        float,
+                                                                        2,
+                                                                        1,
+                                                                        ck::reduce::Add,
+                                                                        PassThrough,
+                                                                        PassThrough,
+                                                                        false,
+                                                                        false,
+                                                                        false>;
+
+} // namespace
+
+// an argument made for one set of buffers and scales and run on another, against one made for
+// the latter directly
+TEST(RebindArgument, Reduce)
+{
+    constexpr ck::index_t M = 64;
+    constexpr ck::index_t K = 1024;
+
+    constexpr float alpha = 2.f;
+    constexpr float beta  = 0.5f;
+
+    const std::array<ck::index_t, 2> in_lengths{M, K};
+    const std::array<ck::index_t, 2> in_strides{K, 1};
+    const std::array<ck::index_t, 1> out_lengths{M};
+    const std::array<ck::index_t, 1> out_strides{1};
+    const std::array<int, 1> reduce_dims{1};
+
+    Tensor<float> in_m_k({M, K}, {K, 1});
+    Tensor<float> out_m({M});
+    Tensor<float> out_m_ref({M});
+    Tensor<float> out_m_unused({M});
+
+    in_m_k.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    out_m.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    const std::vector<float> out_m_init = out_m.mData;
+
+    // buffers the rebound arguments are made for, never written
+    DeviceMem in_unused_buf(sizeof(float) * M * K);
+    DeviceMem out_unused_buf(sizeof(float) * M);
+
+    DeviceMem in_buf(sizeof(float) * M * K);
+    DeviceMem out_buf(sizeof(float) * M);
+    DeviceMem out_ref_buf(sizeof(float) * M);
+
+    in_buf.ToDevice(in_m_k.mData.data());
+
+    const auto op_ptrs = ReduceInstanceFactory::GetInstances();
+
+    int num_rebound = 0;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto ref_argument_ptr = op_ptr->MakeArgumentPointer(in_lengths,
+                                                            in_strides,
+                                                            out_lengths,
+                                                            out_strides,
+                                                            reduce_dims,
+                                                            alpha,
+                                                            beta,
+                                                            in_buf.GetDeviceBuffer(),
+                                                            nullptr,
+                                                            out_ref_buf.GetDeviceBuffer(),
+                                                            nullptr,
+                                                            PassThrough{},
+                                                            PassThrough{});
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(in_lengths,
+                                                        in_strides,
+                                                        out_lengths,
+                                                        out_strides,
+                                                        reduce_dims,
+                                                        1.f,
+                                                        0.f,
+                                                        in_unused_buf.GetDeviceBuffer(),
+                                                        nullptr,
+                                                        out_unused_buf.GetDeviceBuffer(),
+                                                        nullptr,
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(ref_argument_ptr.get()) ||
+           !op_ptr->SetScales(argument_ptr.get(), alpha, beta))
+        {
+            continue;
+        }
+
+        EXPECT_TRUE(argument_ptr->SetInputPointer(0, in_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetOutputPointer(0, out_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(op_ptr->SetElementwiseOps(argument_ptr.get(), PassThrough{}, PassThrough{}));
+
+        // beta is no longer 0
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get())) << op_ptr->GetTypeString();
+
+        out_buf.ToDevice(out_m_init.data());
+        out_ref_buf.ToDevice(out_m_init.data());
+        out_unused_buf.SetZero();
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        invoker_ptr->Run(ref_argument_ptr.get());
+        invoker_ptr->Run(argument_ptr.get());
+
+        out_buf.FromDevice(out_m.mData.data());
+        out_ref_buf.FromDevice(out_m_ref.mData.data());
+        out_unused_buf.FromDevice(out_m_unused.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(out_m.mData, out_m_ref.mData))
+            << op_ptr->GetTypeString();
+        EXPECT_TRUE(ck::utils::check_err(out_m_unused.mData, std::vector<float>(M)))
+            << op_ptr->GetTypeString();
+
+        ++num_rebound;
+    }
+
+    EXPECT_GT(num_rebound, 0);
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_softmax.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/softmax.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceOp =
+    ck::tensor_operation::device::DeviceSoftmax<float, float, float, PassThrough, PassThrough, 3>;
+
+} // namespace
+
+// an argument made for one set of buffers and scales and run on another, against one made for
+// the latter directly
+TEST(RebindArgument, Softmax)
+{
+    constexpr ck::index_t G = 2;
+    constexpr ck::index_t M = 128;
+    constexpr ck::index_t K = 1024;
+
+    const float alpha = 2.f;
+    const float beta  = 0.5f;
+
+    const float unused_alpha = 1.f;
+    const float unused_beta  = 0.f;
+
+    const std::vector<ck::index_t> lengths{G, M, K};
+    const std::vector<ck::index_t> strides{M * K, K, 1};
+    const std::vector<int> reduce_dims{2};
+
+    Tensor<float> in({G, M, K}, {M * K, K, 1});
+    Tensor<float> out({G, M, K}, {M * K, K, 1});
+    Tensor<float> out_ref({G, M, K}, {M * K, K, 1});
+    Tensor<float> out_unused({G, M, K}, {M * K, K, 1});
+
+    in.GenerateTensorValue(GeneratorTensor_3<float>{-5, 5});
+    out.GenerateTensorValue(GeneratorTensor_3<float>{-5, 5});
+
+    const std::vector<float> out_init = out.mData;
+
+    // buffers the rebound arguments are made for, never written
+    DeviceMem in_unused_buf(sizeof(float) * G * M * K);
+    DeviceMem out_unused_buf(sizeof(float) * G * M * K);
+
+    DeviceMem in_buf(sizeof(float) * G * M * K);
+    DeviceMem out_buf(sizeof(float) * G * M * K);
+    DeviceMem out_ref_buf(sizeof(float) * G * M * K);
+
+    in_buf.ToDevice(in.mData.data());
+
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+            DeviceOp>::GetInstances();
+
+    int num_rebound = 0;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto ref_argument_ptr = op_ptr->MakeArgumentPointer(lengths,
+                                                            strides,
+                                                            reduce_dims,
+                                                            &alpha,
+                                                            &beta,
+                                                            in_buf.GetDeviceBuffer(),
+                                                            out_ref_buf.GetDeviceBuffer(),
+                                                            PassThrough{},
+                                                            PassThrough{});
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(lengths,
+                                                        strides,
+                                                        reduce_dims,
+                                                        &unused_alpha,
+                                                        &unused_beta,
+                                                        in_unused_buf.GetDeviceBuffer(),
+                                                        out_unused_buf.GetDeviceBuffer(),
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(ref_argument_ptr.get()) ||
+           !op_ptr->SetScales(argument_ptr.get(), &alpha, &beta))
+        {
+            continue;
+        }
+
+        EXPECT_TRUE(argument_ptr->SetInputPointer(0, in_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(argument_ptr->SetOutputPointer(0, out_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetInputPointer(1, in_buf.GetDeviceBuffer()));
+        EXPECT_FALSE(argument_ptr->SetOutputPointer(1, out_buf.GetDeviceBuffer()));
+        EXPECT_TRUE(op_ptr->SetElementwiseOps(argument_ptr.get(), PassThrough{}, PassThrough{}));
+
+        out_buf.ToDevice(out_init.data());
+        out_ref_buf.ToDevice(out_init.data());
+        out_unused_buf.SetZero();
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        invoker_ptr->Run(ref_argument_ptr.get());
+        invoker_ptr->Run(argument_ptr.get());
+
+        out_buf.FromDevice(out.mData.data());
+        out_ref_buf.FromDevice(out_ref.mData.data());
+        out_unused_buf.FromDevice(out_unused.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(out.mData, out_ref.mData)) << op_ptr->GetTypeString();
+        EXPECT_TRUE(ck::utils::check_err(out_unused.mData, std::vector<float>(G * M * K)))
+            << op_ptr->GetTypeString();
+
+        ++num_rebound;
+    }
+
+    EXPECT_GT(num_rebound, 0);
+}
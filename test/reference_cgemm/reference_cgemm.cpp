@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_cgemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using ck::tensor_operation::host::CGemmAlgorithm;
+
+template <typename DataType>
+using ReferenceCGemm = ck::tensor_operation::host::
+    ReferenceCGemm<DataType, DataType, DataType, PassThrough, PassThrough, PassThrough>;
+
+struct CGemmProblem
+{
+    CGemmProblem(std::size_t M, std::size_t N, std::size_t K, bool b_col_major = false)
+        : a_real({M, K}),
+          a_imag({M, K}),
+          b_real(MakeB(K, N, b_col_major)),
+          b_imag(MakeB(K, N, b_col_major)),
+          c_real({M, N}),
+          c_imag({M, N})
+    {
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_real);
+        ck::utils::FillUniformDistribution<float>{-2.f, 1.f}(a_imag);
+        ck::utils::FillUniformDistribution<float>{-1.f, 2.f}(b_real);
+        ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(b_imag);
+    }
+
+    static Tensor<float> MakeB(std::size_t K, std::size_t N, bool col_major)
+    {
+        if(col_major)
+            return Tensor<float>(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+
+        return Tensor<float>({K, N});
+    }
+
+    void Run(CGemmAlgorithm algorithm)
+    {
+        auto ref_cgemm    = ReferenceCGemm<float>{};
+        auto ref_argument = ref_cgemm.MakeArgument(a_real,
+                                                   a_imag,
+                                                   b_real,
+                                                   b_imag,
+                                                   c_real,
+                                                   c_imag,
+                                                   PassThrough{},
+                                                   PassThrough{},
+                                                   PassThrough{},
+                                                   algorithm);
+        ref_cgemm.MakeInvoker().Run(ref_argument);
+    }
+
+    // the naive loop the reference used to run, accumulating in AccDataType
+    template <typename AccDataType>
+    void RunNaive(Tensor<float>& real, Tensor<float>& imag) const
+    {
+        const std::size_t K = a_real.GetLengths()[1];
+
+        for(std::size_t m = 0; m < real.GetLengths()[0]; ++m)
+            for(std::size_t n = 0; n < real.GetLengths()[1]; ++n)
+            {
+                AccDataType v_real = 0;
+                AccDataType v_imag = 0;
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    const AccDataType ar = a_real(m, k), ai = a_imag(m, k);
+                    const AccDataType br = b_real(k, n), bi = b_imag(k, n);
+
+                    v_real += ar * br - ai * bi;
+                    v_imag += ar * bi + ai * br;
+                }
+                real(m, n) = static_cast<float>(v_real);
+                imag(m, n) = static_cast<float>(v_imag);
+            }
+    }
+
+    Tensor<float> a_real, a_imag, b_real, b_imag, c_real, c_imag;
+};
+
+double max_abs_diff(const Tensor<float>& x, const Tensor<float>& y)
+{
+    double err = 0;
+    for(std::size_t i = 0; i < x.mData.size(); ++i)
+        err = std::max(err, std::abs(double(x.mData[i]) - double(y.mData[i])));
+    return err;
+}
+
+} // namespace
+
+TEST(ReferenceCGemm, StandardMatchesNaiveLoop)
+{
+    for(bool b_col_major : {false, true})
+    {
+        // sizes that are not multiples of the tile sizes
+        CGemmProblem problem(37, 301, 517, b_col_major);
+        problem.Run(CGemmAlgorithm::Standard);
+
+        Tensor<float> real({37, 301}), imag({37, 301});
+        problem.RunNaive<float>(real, imag);
+
+        EXPECT_LE(max_abs_diff(problem.c_real, real), 1e-3);
+        EXPECT_LE(max_abs_diff(problem.c_imag, imag), 1e-3);
+    }
+}
+
+TEST(ReferenceCGemm, Gauss3M)
+{
+    CGemmProblem problem(64, 96, 1024);
+
+    Tensor<float> real({64, 96}), imag({64, 96});
+    problem.RunNaive<double>(real, imag);
+
+    problem.Run(CGemmAlgorithm::Gauss3M);
+    const double err_3m = max_abs_diff(problem.c_imag, imag);
+    EXPECT_LE(max_abs_diff(problem.c_real, real), 1e-2);
+    EXPECT_LE(err_3m, 1e-2);
+
+    problem.Run(CGemmAlgorithm::Gauss3MFp64Accumulation);
+    EXPECT_LE(max_abs_diff(problem.c_real, real), 1e-4);
+    EXPECT_LE(max_abs_diff(problem.c_imag, imag), 1e-4);
+    EXPECT_LE(max_abs_diff(problem.c_imag, imag), err_3m);
+}
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+namespace {
+
+using ck::half_t;
+using ck::Tuple;
+using ck::tensor_operation::host::ReferenceElementwise;
+
+using Add         = ck::tensor_operation::element_wise::Add;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// two outputs: y0 = x0 + x1, y1 = x0 * x1
+struct AddMultiply
+{
+    void operator()(float& y0, float& y1, const float& x0, const float& x1) const
+    {
+        y0 = x0 + x1;
+        y1 = x0 * x1;
+    }
+};
+
+template <typename... Ts>
+void RunReference(const std::tuple<TensorView<const Ts>...>& ins, TensorView<float> out, Add op)
+{
+    auto ref     = ReferenceElementwise<Tuple<Ts...>, Tuple<float>, Add>{};
+    auto invoker = ref.MakeInvoker();
+
+    invoker.Run(ref.MakeArgument(ins, {out}, op));
+}
+
+} // namespace
+
+TEST(ReferenceElementwise, Contiguous)
+{
+    Tensor<float> a({3, 5, 1000});
+    Tensor<half_t> b({3, 5, 1000});
+    Tensor<float> c({3, 5, 1000});
+
+    a.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+    b.GenerateTensorValue(GeneratorTensor_3<half_t>{-1.f, 1.f}, 1);
+
+    auto ref     = ReferenceElementwise<Tuple<float, half_t>, Tuple<float>, Add>{};
+    auto invoker = ref.MakeInvoker();
+
+    invoker.Run(ref.MakeArgument({a, b}, {c}, Add{}));
+
+    Tensor<float> c_ref({3, 5, 1000});
+    c_ref.ForEach([&](auto& self, auto idx) { Add{}(self(idx), a(idx), b(idx)); });
+
+    EXPECT_TRUE(ck::utils::check_err(c, c_ref));
+}
+
+TEST(ReferenceElementwise, Broadcast)
+{
+    const std::size_t M = 7;
+    const std::size_t N = 5000;
+    const std::size_t K = 3;
+
+    Tensor<float> a_m({M});
+    Tensor<float> b_m_n_k({M, N, K});
+    Tensor<float> c_m_n_k({M, N, K});
+    Tensor<float> d_m_n({M, N});
+    Tensor<float> e_n({N});
+
+    a_m.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+    b_m_n_k.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+    e_n.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+
+    // a(m) broadcast along n and k
+    const auto a_m_n_k = make_tensor_view(a_m).Reshape({M, 1, 1}).Broadcast({M, N, K});
+
+    RunReference<float, float>({a_m_n_k, b_m_n_k}, c_m_n_k, Add{});
+
+    // e(n) broadcast along m, NumPy style
+    const auto e_m_n = make_tensor_view(e_n).Broadcast({M, N});
+
+    RunReference<float, float>({e_m_n, e_m_n}, d_m_n, Add{});
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_EQ(d_m_n(m, n), e_n(n) + e_n(n));
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                ASSERT_EQ(c_m_n_k(m, n, k), a_m(m) + b_m_n_k(m, n, k));
+            }
+        }
+    }
+}
+
+TEST(ReferenceElementwise, Permute)
+{
+    const std::size_t N = 2;
+    const std::size_t C = 33;
+    const std::size_t H = 9;
+    const std::size_t W = 17;
+
+    Tensor<half_t> a_nchw({N, C, H, W});
+    Tensor<half_t> b_nhwc({N, H, W, C});
+
+    a_nchw.GenerateTensorValue(GeneratorTensor_3<half_t>{-1.f, 1.f}, 1);
+
+    auto ref     = ReferenceElementwise<Tuple<half_t>, Tuple<half_t>, PassThrough>{};
+    auto invoker = ref.MakeInvoker();
+
+    // write through an NCHW-ordered view of the NHWC output
+    invoker.Run(
+        ref.MakeArgument({a_nchw}, {make_tensor_view(b_nhwc).Permute({0, 3, 1, 2})}, {}));
+
+    a_nchw.ForEach([&](auto& self, auto idx) {
+        ASSERT_EQ(ck::type_convert<float>(b_nhwc(idx[0], idx[2], idx[3], idx[1])),
+                  ck::type_convert<float>(self(idx)));
+    });
+}
+
+TEST(ReferenceElementwise, MultipleOutputsStrided)
+{
+    const std::size_t M = 40;
+    const std::size_t N = 30;
+
+    Tensor<float> x0({M, N});
+    Tensor<float> x1_n_m({N, M});
+    Tensor<float> y0({M, N});
+    Tensor<float> y1({M, N});
+
+    x0.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+    x1_n_m.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f}, 1);
+
+    // every other column of x0, x1 transposed
+    const auto x0_m_n = make_tensor_view(x0).Slice(1, 0, N, 2);
+    const auto x1_m_n = make_tensor_view(x1_n_m).Permute({1, 0}).Slice(1, 0, N, 2);
+
+    auto y0_m_n = make_tensor_view(y0).Slice(1, 0, N, 2);
+    auto y1_m_n = make_tensor_view(y1).Slice(1, 0, N, 2);
+
+    auto ref     = ReferenceElementwise<Tuple<float, float>, Tuple<float, float>, AddMultiply>{};
+    auto invoker = ref.MakeInvoker();
+
+    invoker.Run(ref.MakeArgument({x0_m_n, x1_m_n}, {y0_m_n, y1_m_n}, AddMultiply{}));
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; n += 2)
+        {
+            ASSERT_EQ(y0(m, n), x0(m, n) + x1_n_m(n, m));
+            ASSERT_EQ(y1(m, n), x0(m, n) * x1_n_m(n, m));
+        }
+    }
+}
+
+TEST(ReferenceElementwise, CollapseDimensions)
+{
+    using Strides = std::vector<std::vector<std::size_t>>;
+
+    // a packed 4D output and a broadcast input collapse to 2 dimensions
+    const auto loop = ck::utils::detail::make_host_elementwise_loop(
+        {2, 3, 4, 5}, Strides{{60, 20, 5, 1}, {0, 0, 5, 1}});
+
+    EXPECT_EQ(loop.lengths, (std::vector<std::size_t>{6, 20}));
+    EXPECT_EQ(loop.strides, (Strides{{20, 1}, {0, 1}}));
+
+    // a column major output is walked in its own memory order, unit dimensions are dropped
+    const auto loop_t = ck::utils::detail::make_host_elementwise_loop(
+        {4, 1, 6}, Strides{{1, 24, 4}, {6, 6, 1}});
+
+    EXPECT_EQ(loop_t.lengths, (std::vector<std::size_t>{6, 4}));
+    EXPECT_EQ(loop_t.strides, (Strides{{4, 1}, {1, 6}}));
+
+    Tensor<float> c({2, 0, 3});
+
+    RunReference<float, float>({c, c}, c, Add{});
+}
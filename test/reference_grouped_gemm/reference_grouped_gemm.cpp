@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+namespace {
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using GemmDesc    = ck::tensor_operation::device::GemmDesc;
+
+using Shape = std::array<int, 3>; // M, N, K
+
+template <typename Layout>
+HostTensorDescriptor MakeDescriptor(std::size_t row, std::size_t col, std::size_t stride)
+{
+    if constexpr(std::is_same_v<Layout, Row>)
+    {
+        return HostTensorDescriptor(std::vector<std::size_t>{row, col},
+                                    std::vector<std::size_t>{stride, 1});
+    }
+    else
+    {
+        return HostTensorDescriptor(std::vector<std::size_t>{row, col},
+                                    std::vector<std::size_t>{1, stride});
+    }
+}
+
+// every group against ReferenceGemm, padded leading dimensions
+template <typename ALayout, typename BLayout, typename CLayout>
+void TestGroupedGemm(const std::vector<Shape>& shapes)
+{
+    std::vector<Tensor<ck::half_t>> a_m_k;
+    std::vector<Tensor<ck::half_t>> b_k_n;
+    std::vector<Tensor<float>> c_m_n;
+    std::vector<Tensor<float>> c_m_n_ref;
+    std::vector<GemmDesc> gemm_descs;
+
+    for(const auto& shape : shapes)
+    {
+        const auto [M, N, K] = shape;
+
+        const int stride_A = (std::is_same_v<ALayout, Row> ? K : M) + 3;
+        const int stride_B = (std::is_same_v<BLayout, Row> ? N : K) + 1;
+        const int stride_C = (std::is_same_v<CLayout, Row> ? N : M) + 2;
+
+        a_m_k.emplace_back(MakeDescriptor<ALayout>(M, K, stride_A));
+        b_k_n.emplace_back(MakeDescriptor<BLayout>(K, N, stride_B));
+        c_m_n.emplace_back(MakeDescriptor<CLayout>(M, N, stride_C));
+        c_m_n_ref.emplace_back(MakeDescriptor<CLayout>(M, N, stride_C));
+
+        a_m_k.back().GenerateTensorValue(GeneratorTensor_3<ck::half_t>{-1.f, 1.f}, 1);
+        b_k_n.back().GenerateTensorValue(GeneratorTensor_3<ck::half_t>{-1.f, 1.f}, 1);
+
+        gemm_descs.push_back({M, N, K, stride_A, stride_B, stride_C, {}});
+    }
+
+    std::vector<const ck::half_t*> p_as;
+    std::vector<const ck::half_t*> p_bs;
+    std::vector<float*> p_cs;
+
+    for(std::size_t i = 0; i < gemm_descs.size(); ++i)
+    {
+        p_as.push_back(a_m_k[i].data());
+        p_bs.push_back(b_k_n[i].data());
+        p_cs.push_back(c_m_n[i].data());
+    }
+
+    auto ref_grouped_gemm = ck::tensor_operation::host::ReferenceGroupedGemm<ALayout,
+                                                                             BLayout,
+                                                                             CLayout,
+                                                                             ck::half_t,
+                                                                             ck::half_t,
+                                                                             float,
+                                                                             float,
+                                                                             PassThrough,
+                                                                             PassThrough,
+                                                                             PassThrough>{};
+
+    ref_grouped_gemm.MakeInvoker().Run(
+        ref_grouped_gemm.MakeArgument(p_as, p_bs, p_cs, gemm_descs, {}, {}, {}));
+
+    for(std::size_t i = 0; i < gemm_descs.size(); ++i)
+    {
+        auto ref_gemm = ck::tensor_operation::host::ReferenceGemm<ck::half_t,
+                                                                  ck::half_t,
+                                                                  float,
+                                                                  float,
+                                                                  PassThrough,
+                                                                  PassThrough,
+                                                                  PassThrough>{};
+
+        ref_gemm.MakeInvoker().Run(
+            ref_gemm.MakeArgument(a_m_k[i], b_k_n[i], c_m_n_ref[i], {}, {}, {}));
+
+        EXPECT_TRUE(ck::utils::check_err(c_m_n[i], c_m_n_ref[i])) << "group " << i;
+    }
+}
+
+std::vector<Shape> MakeShapes(std::size_t group_count, int max_size)
+{
+    std::vector<Shape> shapes;
+
+    std::srand(1);
+
+    for(std::size_t i = 0; i < group_count; ++i)
+    {
+        shapes.push_back(
+            {1 + std::rand() % max_size, 1 + std::rand() % max_size, std::rand() % max_size});
+    }
+
+    return shapes;
+}
+
+} // namespace
+
+TEST(ReferenceGroupedGemm, MixedSizes)
+{
+    // one group large enough to be split into row blocks, many that are packed together
+    auto shapes = MakeShapes(40, 64);
+    shapes.push_back({700, 300, 200});
+
+    TestGroupedGemm<Row, Row, Row>(shapes);
+    TestGroupedGemm<Col, Col, Col>(shapes);
+    TestGroupedGemm<Row, Col, Row>(shapes);
+}
+
+TEST(ReferenceGroupedGemm, ManyTinyGroups) { TestGroupedGemm<Row, Col, Row>(MakeShapes(2000, 8)); }
+
+TEST(ReferenceGroupedGemm, EmptyGroups)
+{
+    TestGroupedGemm<Row, Row, Row>({{0, 5, 5}, {5, 0, 5}, {5, 5, 0}, {17, 13, 11}});
+}
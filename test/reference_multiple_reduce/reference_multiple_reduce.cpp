@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/utility/reduction_operator.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using UnarySquare = ck::tensor_operation::element_wise::UnarySquare;
+using UnaryDivide = ck::tensor_operation::element_wise::UnaryDivide;
+
+// mean, mean square and max in one pass
+using ReferenceMeanMeanSquareMax = ck::tensor_operation::host::ReferenceMultipleReduce<
+    ck::bhalf_t,
+    float,
+    ck::Tuple<float, float, ck::bhalf_t>,
+    ck::Tuple<ck::reduce::Add, ck::reduce::Add, ck::reduce::Max>,
+    ck::Tuple<PassThrough, UnarySquare, PassThrough>,
+    ck::Tuple<UnaryDivide, UnaryDivide, PassThrough>>;
+
+std::vector<std::size_t> InvariantLengths(const std::vector<std::size_t>& lengths,
+                                          const std::vector<int>& reduce_dims)
+{
+    std::vector<std::size_t> invariant_lengths;
+
+    for(std::size_t d = 0; d < lengths.size(); ++d)
+    {
+        if(std::find(reduce_dims.begin(), reduce_dims.end(), d) == reduce_dims.end())
+        {
+            invariant_lengths.push_back(lengths[d]);
+        }
+    }
+
+    return invariant_lengths.empty() ? std::vector<std::size_t>{1} : invariant_lengths;
+}
+
+// one reduction at a time, element by element
+void TestMultipleReduce(const TensorView<const ck::bhalf_t>& in,
+                        const std::vector<int>& reduce_dims)
+{
+    const auto out_lengths = InvariantLengths(in.GetLengths(), reduce_dims);
+
+    std::size_t reduce_length = 1;
+    for(const int d : reduce_dims)
+    {
+        reduce_length *= in.GetLengths()[d];
+    }
+
+    Tensor<float> mean(out_lengths);
+    Tensor<float> meansquare(out_lengths);
+    Tensor<ck::bhalf_t> max(out_lengths);
+
+    // outputs written through a transposed view
+    std::vector<std::size_t> reversed(out_lengths.size());
+    std::iota(reversed.rbegin(), reversed.rend(), 0);
+
+    Tensor<float> meansquare_t(make_tensor_view(meansquare).Permute(reversed).GetLengths());
+
+    auto ref = ReferenceMeanMeanSquareMax{};
+
+    ref.MakeInvoker().Run(ref.MakeArgument(
+        in,
+        {mean, make_tensor_view(meansquare_t).Permute(reversed), max},
+        reduce_dims,
+        ck::make_tuple(PassThrough{}, UnarySquare{}, PassThrough{}),
+        ck::make_tuple(UnaryDivide{static_cast<int32_t>(reduce_length)},
+                       UnaryDivide{static_cast<int32_t>(reduce_length)},
+                       PassThrough{})));
+
+    const std::size_t out_size = mean.mDesc.GetElementSize();
+
+    std::vector<float> sum(out_size, 0);
+    std::vector<float> sum_square(out_size, 0);
+    std::vector<float> max_ref(out_size, std::numeric_limits<float>::lowest());
+
+    const auto& lengths = in.GetLengths();
+
+    std::vector<std::size_t> idx(lengths.size(), 0);
+
+    for(std::size_t i = 0; i < in.mDesc.GetElementSize(); ++i)
+    {
+        std::size_t in_offset  = 0;
+        std::size_t out_offset = 0;
+
+        for(std::size_t d = 0, rest = i; d < lengths.size(); ++d)
+        {
+            const std::size_t stride =
+                std::accumulate(lengths.begin() + d + 1, lengths.end(), 1, std::multiplies<>{});
+
+            idx[d] = rest / stride;
+            rest %= stride;
+
+            in_offset += idx[d] * in.GetStrides()[d];
+
+            if(std::find(reduce_dims.begin(), reduce_dims.end(), d) == reduce_dims.end())
+            {
+                out_offset = out_offset * lengths[d] + idx[d];
+            }
+        }
+
+        const float v = ck::type_convert<float>(in.data()[in_offset]);
+
+        sum[out_offset] += v;
+        sum_square[out_offset] += v * v;
+        max_ref[out_offset] = std::max(max_ref[out_offset], v);
+    }
+
+    for(std::size_t i = 0; i < out_size; ++i)
+    {
+        // integer valued inputs, the sums are exact in any order
+        EXPECT_EQ(mean.mData[i], sum[i] / reduce_length) << i;
+        EXPECT_EQ(ck::type_convert<float>(max.mData[i]), max_ref[i]) << i;
+    }
+
+    meansquare.ForEach([&](auto& self, auto out_idx) {
+        std::vector<std::size_t> t_idx(out_idx.rbegin(), out_idx.rend());
+
+        self(out_idx) = meansquare_t(t_idx);
+    });
+
+    for(std::size_t i = 0; i < out_size; ++i)
+    {
+        EXPECT_EQ(meansquare.mData[i], sum_square[i] / reduce_length) << i;
+    }
+}
+
+} // namespace
+
+TEST(ReferenceMultipleReduce, InnerAndOuterDims)
+{
+    Tensor<ck::bhalf_t> in({5, 7, 33, 300});
+    in.GenerateTensorValue(GeneratorTensor_2<ck::bhalf_t>{-5, 5});
+
+    TestMultipleReduce(in, {1, 2, 3});
+    TestMultipleReduce(in, {3});
+    TestMultipleReduce(in, {0});
+    TestMultipleReduce(in, {0, 2});
+    TestMultipleReduce(in, {2, 1});
+    TestMultipleReduce(in, {0, 1, 2, 3});
+    TestMultipleReduce(in, {});
+}
+
+TEST(ReferenceMultipleReduce, StridedInput)
+{
+    Tensor<ck::bhalf_t> in({40, 3, 600});
+    in.GenerateTensorValue(GeneratorTensor_2<ck::bhalf_t>{-5, 5});
+
+    // every other element of a permuted input
+    const auto view = make_tensor_view(in).Permute({2, 0, 1}).Slice(0, 0, 600, 2);
+
+    TestMultipleReduce(view, {0});
+    TestMultipleReduce(view, {1, 2});
+    TestMultipleReduce(view, {2});
+}
+
+TEST(ReferenceMultipleReduce, EmptyAndInvalid)
+{
+    Tensor<ck::bhalf_t> in({4, 0, 6});
+
+    Tensor<float> mean({4, 6});
+    Tensor<float> meansquare({4, 6});
+    Tensor<ck::bhalf_t> max({4, 6});
+
+    auto ref = ReferenceMeanMeanSquareMax{};
+
+    auto f_run = [&](const std::vector<int>& reduce_dims) {
+        ref.MakeInvoker().Run(
+            ref.MakeArgument(in,
+                             {mean, meansquare, max},
+                             reduce_dims,
+                             ck::make_tuple(PassThrough{}, UnarySquare{}, PassThrough{}),
+                             ck::make_tuple(UnaryDivide{}, UnaryDivide{}, PassThrough{})));
+    };
+
+    // nothing to reduce, every output is the identity value
+    f_run({1});
+
+    const auto lowest = ck::type_convert<ck::bhalf_t>(ck::NumericLimits<float>::Lowest());
+
+    for(std::size_t i = 0; i < mean.mData.size(); ++i)
+    {
+        EXPECT_EQ(mean.mData[i], 0.f);
+        EXPECT_EQ(meansquare.mData[i], 0.f);
+        EXPECT_EQ(ck::type_convert<float>(max.mData[i]), ck::type_convert<float>(lowest));
+    }
+
+    EXPECT_THROW(f_run({0}), std::runtime_error);
+    EXPECT_THROW(f_run({1, 1}), std::runtime_error);
+    EXPECT_THROW(f_run({3}), std::runtime_error);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/packed_int4.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_packed_int4.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+TEST(PackedInt4, PackUnpackRoundTrip)
+{
+    // odd sizes exercise the trailing nibble, large ones the vector and parallel paths
+    for(std::size_t n : {1, 7, 64, 129, 200001})
+    {
+        std::vector<int8_t> src(n);
+        for(std::size_t i = 0; i < n; ++i)
+            src[i] = static_cast<int8_t>(static_cast<int>(i * 7 % 16) - 8);
+
+        std::vector<uint8_t> packed(ck::utils::packed_int4_bytes(n), 0xff);
+        ck::utils::pack_int4(src.data(), packed.data(), n);
+
+        if(n % 2 != 0)
+        {
+            EXPECT_EQ(packed.back() >> 4, 0);
+        }
+
+        std::vector<int8_t> dst(n);
+        ck::utils::unpack_int4(packed.data(), dst.data(), n);
+
+        EXPECT_TRUE(ck::utils::check_err(dst, src)) << "n = " << n;
+    }
+}
+
+TEST(PackedInt4, OutOfRangeValuesWrap)
+{
+    const std::vector<int8_t> src = {8, -9, 15, 16, 127, -128};
+    const std::vector<int8_t> wrapped = {-8, 7, -1, 0, -1, 0};
+
+    std::vector<uint8_t> packed(ck::utils::packed_int4_bytes(src.size()));
+    ck::utils::pack_int4(src.data(), packed.data(), src.size());
+
+    std::vector<int8_t> dst(src.size());
+    ck::utils::unpack_int4(packed.data(), dst.data(), dst.size());
+
+    EXPECT_TRUE(ck::utils::check_err(dst, wrapped));
+}
+
+TEST(PackedInt4, TensorElementAccess)
+{
+    PackedInt4Tensor t({3, 5});
+    EXPECT_EQ(t.GetElementSpaceSizeInBytes(), 8);
+
+    for(std::size_t i = 0; i < 3; ++i)
+        for(std::size_t j = 0; j < 5; ++j)
+            t(i, j) = static_cast<int8_t>(int(i * 5 + j) % 16 - 8);
+
+    // neighbouring nibbles are left untouched by a write
+    t(1, 2) = int8_t{3};
+    t(1, 3) = t(0, 0);
+
+    const auto& ct = t;
+    for(std::size_t i = 0; i < 3; ++i)
+        for(std::size_t j = 0; j < 5; ++j)
+        {
+            int8_t expected = static_cast<int8_t>(int(i * 5 + j) % 16 - 8);
+            if(i == 1 && j == 2)
+                expected = 3;
+            if(i == 1 && j == 3)
+                expected = -8;
+
+            EXPECT_EQ(ct(i, j), expected);
+            EXPECT_EQ(ct(std::vector<std::size_t>{i, j}), expected);
+        }
+
+    const Tensor<int8_t> unpacked = t.Unpack();
+    const PackedInt4Tensor repacked(unpacked);
+    EXPECT_EQ(repacked.mData, t.mData);
+}
+
+TEST(ReferenceGemmPackedInt4, MatchesReferenceGemm)
+{
+    // odd K puts every other row of A off a byte boundary, K = 601 spans several K blocks
+    const std::size_t M = 37, N = 70;
+
+    for(std::size_t K : {std::size_t{99}, std::size_t{601}})
+    {
+        for(bool b_row_major : {false, true})
+        {
+            Tensor<int8_t> a({M, K});
+            Tensor<int8_t> b = b_row_major ? Tensor<int8_t>({K, N}, {N, std::size_t{1}})
+                                           : Tensor<int8_t>({K, N}, {std::size_t{1}, K});
+            a.GenerateTensorValue(GeneratorTensor_2<int8_t>{-8, 8});
+            b.GenerateTensorValue(GeneratorTensor_2<int8_t>{-8, 8});
+
+            const PackedInt4Tensor a_packed(a);
+            const PackedInt4Tensor b_packed(b);
+            EXPECT_EQ(a_packed.GetElementSpaceSizeInBytes(), (M * K + 1) / 2);
+
+            Tensor<int32_t> c_ref({M, N});
+            Tensor<int32_t> c({M, N});
+
+            using RefGemm = ck::tensor_operation::host::ReferenceGemm<int8_t,
+                                                                      int8_t,
+                                                                      int32_t,
+                                                                      int32_t,
+                                                                      PassThrough,
+                                                                      PassThrough,
+                                                                      PassThrough>;
+            auto ref_argument = RefGemm::MakeArgument(a, b, c_ref, {}, {}, {});
+            RefGemm::MakeInvoker().Run(ref_argument);
+
+            using Gemm = ck::tensor_operation::host::ReferenceGemmPackedInt4<int32_t, PassThrough>;
+            auto argument = Gemm::MakeArgument(a_packed, b_packed, c, {});
+            Gemm::MakeInvoker().Run(argument);
+
+            EXPECT_TRUE(ck::utils::check_err(c.mData, c_ref.mData)) << K << " " << b_row_major;
+        }
+    }
+}
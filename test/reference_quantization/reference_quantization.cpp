@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_gemm_int8.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_quantization.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_quantization.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Relu        = ck::tensor_operation::element_wise::Relu;
+
+using ck::utils::HostInt8Dot;
+
+const HostInt8Dot all_dots[] = {HostInt8Dot::Scalar,
+                                HostInt8Dot::Avx2,
+                                HostInt8Dot::AvxVnni,
+                                HostInt8Dot::Avx512Bw,
+                                HostInt8Dot::Avx512Vnni};
+
+} // namespace
+
+TEST(HostGemmInt8, AllKernelsMatchInt32Loop)
+{
+    // K not a multiple of the packing, N not a multiple of the 4 column micro kernel,
+    // and extreme values to exercise the unsigned offset of the VNNI kernels
+    const std::size_t M = 21, N = 131, K = 77;
+
+    Tensor<int8_t> a({M, K});
+    Tensor<int8_t> b({N, K});
+    a.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    b.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    a(0, 0) = -128;
+    b(0, 0) = -128;
+
+    Tensor<int32_t> expected({M, N});
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int32_t acc = 0;
+            for(std::size_t k = 0; k < K; ++k)
+                acc += int32_t{a(m, k)} * int32_t{b(n, k)};
+            expected(m, n) = acc;
+        }
+
+    const auto packed_b =
+        ck::utils::host_gemm_int8_pack_b(N, K, [&](auto n, auto k) { return b(n, k); });
+
+    for(auto dot : all_dots)
+    {
+        Tensor<int32_t> c({M, N});
+
+        ck::utils::host_gemm_s8s8s32(
+            M,
+            packed_b,
+            [&](auto m, int8_t* p_row) { std::copy(&a(m, 0), &a(m, 0) + K, p_row); },
+            [&](auto m, auto n_begin, auto n_end, const int32_t* p_c) {
+                std::copy(p_c, p_c + (n_end - n_begin), &c(m, n_begin));
+            },
+            dot);
+
+        EXPECT_TRUE(ck::utils::check_err(c, expected)) << ck::utils::GetHostInt8DotString(dot);
+    }
+}
+
+TEST(ReferenceGemmQuantization, MatchesFloatReferenceBitExact)
+{
+    using CDEElementOp = ck::tensor_operation::element_wise::Add_Activation_Mul_Clamp<Relu>;
+
+    const std::size_t M = 67, N = 45, K = 300;
+
+    Tensor<int8_t> a_m_k({M, K});
+    Tensor<int8_t> b_k_n(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<int32_t> bias_n({N});
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    bias_n.GenerateTensorValue(GeneratorTensor_2<int32_t>{-128, 127});
+
+    const auto cde_element_op = CDEElementOp{0.03f, Relu{}};
+
+    // the verification the quantization examples used to do
+    Tensor<int32_t> c_m_n({M, N});
+    Tensor<int8_t> e_expected({M, N});
+    {
+        using ReferenceGemm = ck::tensor_operation::host::
+            ReferenceGemm<int8_t, int8_t, int32_t, float, PassThrough, PassThrough, PassThrough>;
+
+        auto argument = ReferenceGemm::MakeArgument(
+            a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+        ReferenceGemm::MakeInvoker().Run(argument);
+
+        for(std::size_t m = 0; m < M; ++m)
+            for(std::size_t n = 0; n < N; ++n)
+                cde_element_op(e_expected(m, n), c_m_n(m, n), bias_n(n));
+    }
+
+    using ReferenceGemmQuantization = ck::tensor_operation::host::
+        ReferenceGemmQuantization<int8_t, CDEElementOp, int32_t>;
+
+    Tensor<int8_t> e_m_n({M, N});
+    auto argument = ReferenceGemmQuantization::MakeArgument(
+        a_m_k,
+        b_k_n,
+        {TensorView<const int32_t>{bias_n}.Broadcast({M, N})},
+        e_m_n,
+        cde_element_op);
+    ReferenceGemmQuantization::MakeInvoker().Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(e_m_n, e_expected));
+}
+
+TEST(ReferenceConvFwdQuantization, MatchesFloatReferenceBitExact)
+{
+    using CDEElementOp = ck::tensor_operation::element_wise::Add_Activation_Mul2_Clamp<Relu>;
+
+    // G, N, K, C, (Hi, Wi), (Y, X), stride 2, dilation 1, pad 1
+    const std::size_t G = 2, N = 3, K = 19, C = 13, Hi = 11, Wi = 9, Y = 3, X = 3;
+    const std::size_t Ho = 6, Wo = 5;
+
+    const std::vector<ck::index_t> strides{2, 2}, dilations{1, 1}, pads{1, 1};
+
+    // GNHWC / GKYXC / GNHWK physical layouts, descriptors in GNCHW order
+    Tensor<int8_t> in(std::vector<std::size_t>{G, N, C, Hi, Wi},
+                      std::vector<std::size_t>{N * Hi * Wi * C, Hi * Wi * C, 1, Wi * C, C});
+    Tensor<int8_t> wei(std::vector<std::size_t>{G, K, C, Y, X},
+                       std::vector<std::size_t>{K * Y * X * C, Y * X * C, 1, X * C, C});
+    Tensor<int32_t> bias(std::vector<std::size_t>{G, N, K, Ho, Wo},
+                         std::vector<std::size_t>{K, 0, 1, 0, 0});
+    Tensor<float> requant_scale(std::vector<std::size_t>{G, N, K, Ho, Wo},
+                                std::vector<std::size_t>{K, 0, 1, 0, 0});
+    const HostTensorDescriptor out_desc(
+        std::vector<std::size_t>{G, N, K, Ho, Wo},
+        std::vector<std::size_t>{N * Ho * Wo * K, Ho * Wo * K, 1, Wo * K, K});
+
+    in.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    wei.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    bias.GenerateTensorValue(GeneratorTensor_2<int32_t>{-128, 127});
+    requant_scale.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 0.1f});
+
+    const auto cde_element_op = CDEElementOp{Relu{}};
+
+    Tensor<int32_t> c_host(out_desc);
+    Tensor<int8_t> out_expected(out_desc);
+    {
+        using ReferenceConvFwd = ck::tensor_operation::host::
+            ReferenceConvFwd<2, int8_t, int8_t, int32_t, PassThrough, PassThrough, PassThrough>;
+
+        auto argument = ReferenceConvFwd::MakeArgument(in,
+                                                       wei,
+                                                       c_host,
+                                                       strides,
+                                                       dilations,
+                                                       pads,
+                                                       pads,
+                                                       PassThrough{},
+                                                       PassThrough{},
+                                                       PassThrough{});
+        ReferenceConvFwd::MakeInvoker().Run(argument);
+
+        out_expected.ForEach([&](auto&, auto idx) {
+            cde_element_op(out_expected(idx), c_host(idx), bias(idx), requant_scale(idx));
+        });
+    }
+
+    using ReferenceConvFwdQuantization = ck::tensor_operation::host::
+        ReferenceConvFwdQuantization<2, int8_t, CDEElementOp, int32_t, float>;
+
+    Tensor<int8_t> out(out_desc);
+    auto argument = ReferenceConvFwdQuantization::MakeArgument(
+        in, wei, {bias, requant_scale}, out, strides, dilations, pads, pads, cde_element_op);
+    ReferenceConvFwdQuantization::MakeInvoker().Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(out, out_expected));
+}
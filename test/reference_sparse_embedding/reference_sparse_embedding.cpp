@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embedding3_forward_layernorm.hpp"
+
+namespace {
+
+template <ck::index_t NumEmbeddings>
+using ReferenceSparseEmbedding =
+    ck::tensor_operation::host::ReferenceSparseEmbeddingForwardLayernorm<float,
+                                                                         int64_t,
+                                                                         float,
+                                                                         float,
+                                                                         float,
+                                                                         float,
+                                                                         NumEmbeddings>;
+
+template <ck::index_t NumEmbeddings>
+struct SparseEmbeddingProblem
+{
+    SparseEmbeddingProblem(std::size_t num_rows, std::size_t dim, std::size_t index_length)
+        : gamma({dim}), beta({dim}), out({index_length, dim})
+    {
+        for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+        {
+            embs.emplace_back(std::vector<std::size_t>{num_rows, dim});
+            indices.emplace_back(std::vector<std::size_t>{index_length});
+
+            ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(embs.back());
+            ck::utils::FillUniformDistributionIntegerValue<int64_t>{
+                0.f, static_cast<float>(num_rows - 1)}(indices.back());
+        }
+
+        ck::utils::FillUniformDistribution<float>{0.f, 1.f}(gamma);
+        ck::utils::FillUniformDistribution<float>{0.f, 1.f}(beta);
+    }
+
+    template <std::size_t... Is>
+    auto MakeArgument(float epsilon, std::index_sequence<Is...>)
+    {
+        using Reference = ReferenceSparseEmbedding<NumEmbeddings>;
+
+        return Reference::MakeArgument(out,
+                                       typename Reference::EmbTables{embs[Is]...},
+                                       typename Reference::Indices{indices[Is]...},
+                                       gamma,
+                                       beta,
+                                       embs[0].GetLengths()[0],
+                                       embs[0].GetLengths()[1],
+                                       out.GetLengths()[0],
+                                       epsilon);
+    }
+
+    void Run(float epsilon)
+    {
+        auto argument = MakeArgument(epsilon, std::make_index_sequence<NumEmbeddings>{});
+        ReferenceSparseEmbedding<NumEmbeddings>::MakeInvoker().Run(argument);
+    }
+
+    // gather, then two-pass mean / variance in double
+    Tensor<float> RunNaive(float epsilon) const
+    {
+        const std::size_t L = out.GetLengths()[0];
+        const std::size_t D = out.GetLengths()[1];
+
+        Tensor<float> result({L, D});
+
+        for(std::size_t l = 0; l < L; ++l)
+        {
+            std::vector<double> x(D, 0);
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                for(std::size_t d = 0; d < D; ++d)
+                    x[d] += embs[i](indices[i](l), d);
+
+            double mean = 0;
+            for(std::size_t d = 0; d < D; ++d)
+                mean += x[d];
+            mean /= D;
+
+            double var = 0;
+            for(std::size_t d = 0; d < D; ++d)
+                var += (x[d] - mean) * (x[d] - mean);
+            var /= D;
+
+            for(std::size_t d = 0; d < D; ++d)
+                result(l, d) = (x[d] - mean) / std::sqrt(var + epsilon) * gamma(d) + beta(d);
+        }
+
+        return result;
+    }
+
+    std::vector<Tensor<float>> embs;
+    std::vector<Tensor<int64_t>> indices;
+    Tensor<float> gamma;
+    Tensor<float> beta;
+    Tensor<float> out;
+};
+
+} // namespace
+
+TEST(ReferenceSparseEmbedding, MatchesNaiveForAnyNumberOfTables)
+{
+    constexpr float epsilon = 1e-4;
+
+    SparseEmbeddingProblem<1> one_table(64, 96, 37);
+    one_table.Run(epsilon);
+    EXPECT_TRUE(ck::utils::check_err(one_table.out, one_table.RunNaive(epsilon)));
+
+    SparseEmbeddingProblem<5> five_tables(128, 200, 53);
+    five_tables.Run(epsilon);
+    EXPECT_TRUE(ck::utils::check_err(five_tables.out, five_tables.RunNaive(epsilon)));
+}
+
+TEST(ReferenceSparseEmbedding, ThreeTableInterface)
+{
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceSparseEmbedding3ForwardLayernorm<float, int64_t, float, float, float, float>;
+
+    constexpr float epsilon = 1e-4;
+
+    SparseEmbeddingProblem<3> problem(256, 512, 100);
+
+    auto argument = ReferenceInstance::MakeArgument(problem.out,
+                                                    problem.embs[0],
+                                                    problem.embs[1],
+                                                    problem.embs[2],
+                                                    problem.indices[0],
+                                                    problem.indices[1],
+                                                    problem.indices[2],
+                                                    problem.gamma,
+                                                    problem.beta,
+                                                    256,
+                                                    512,
+                                                    100,
+                                                    epsilon);
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(problem.out, problem.RunNaive(epsilon)));
+}
+
+TEST(ReferenceSparseEmbedding, OutOfRangeIndexThrows)
+{
+    SparseEmbeddingProblem<2> problem(16, 8, 10);
+    problem.indices[1](7) = 16;
+
+    EXPECT_THROW(problem.Run(1e-4), std::runtime_error);
+}
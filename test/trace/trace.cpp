@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/host_utility/trace.hpp"
+
+namespace {
+
+using ck::trace::Tracer;
+
+std::size_t count(const std::string& str, const std::string& substr)
+{
+    std::size_t n = 0;
+
+    for(auto pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + 1))
+    {
+        ++n;
+    }
+
+    return n;
+}
+
+// the events recorded since the last call
+std::string write_trace()
+{
+    std::ostringstream os;
+
+    Tracer::GetInstance().Write(os);
+
+    return os.str();
+}
+
+class Trace : public testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        Tracer::GetInstance().SetEnabled(true);
+
+        write_trace();
+    }
+
+    void TearDown() override { Tracer::GetInstance().SetEnabled(false); }
+};
+
+} // namespace
+
+static_assert(CK_ENABLE_TRACE);
+static_assert(std::is_empty_v<ck::trace::NullZone>);
+
+TEST_F(Trace, Zones)
+{
+    {
+        CK_TRACE_ZONE(outer, "test", "outer");
+        outer.AddArg("M", 3840);
+        outer.SetDetail("a \"quoted\"\tname");
+
+        {
+            CK_TRACE_ZONE(inner, "test", "inner");
+        }
+
+        CK_TRACE_COUNTER("test", "tflops", 1.5);
+    }
+
+    const std::string trace = write_trace();
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_EQ(count(trace, R"("ph":"X")"), 2);
+    EXPECT_EQ(count(trace, R"("ph":"C")"), 1);
+
+    // in order of completion
+    EXPECT_LT(trace.find(R"("name":"inner")"), trace.find(R"("name":"outer")"));
+
+    EXPECT_NE(trace.find(R"("args":{"M":3840,"detail":"a \"quoted\"\u0009name"})"),
+              std::string::npos);
+    EXPECT_NE(trace.find(R"("args":{"tflops":1.5})"), std::string::npos);
+
+    // drained
+    EXPECT_EQ(count(write_trace(), R"("ph":"X")"), 0);
+}
+
+TEST_F(Trace, Disabled)
+{
+    Tracer::GetInstance().SetEnabled(false);
+
+    {
+        CK_TRACE_ZONE(zone, "test", "zone");
+        zone.AddArg("M", 1);
+
+        CK_TRACE_COUNTER("test", "tflops", 1);
+    }
+
+    const std::string trace = write_trace();
+
+    EXPECT_EQ(count(trace, R"("ph":"X")"), 0);
+    EXPECT_EQ(count(trace, R"("ph":"C")"), 0);
+}
+
+TEST_F(Trace, Limits)
+{
+    {
+        CK_TRACE_ZONE(zone, "test", "zone");
+
+        for(std::size_t i = 0; i < ck::trace::Event::max_num_args + 1; ++i)
+        {
+            zone.AddArg("arg", i);
+        }
+
+        zone.SetDetail(std::string(ck::trace::Event::max_detail_size + 1, 'x'));
+    }
+
+    const std::string trace = write_trace();
+
+    EXPECT_EQ(count(trace, R"("arg":)"), ck::trace::Event::max_num_args);
+    EXPECT_NE(trace.find("\"" + std::string(ck::trace::Event::max_detail_size, 'x') + "\""),
+              std::string::npos);
+}
+
+TEST_F(Trace, Threads)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_zones   = 1000;
+
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&] {
+            for(int i = 0; i < num_zones; ++i)
+            {
+                CK_TRACE_ZONE(zone, "test", "zone");
+                zone.AddArg("i", i);
+            }
+        });
+    }
+
+    // concurrently with the recording
+    std::string trace = write_trace();
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    trace += write_trace();
+
+    EXPECT_EQ(count(trace, R"("ph":"X")"), num_threads * num_zones);
+
+    std::set<std::string> tids;
+
+    for(auto pos = trace.find(R"("ph":"X")"); pos != std::string::npos;
+        pos      = trace.find(R"("ph":"X")", pos + 1))
+    {
+        const auto tid_pos = trace.find(R"("tid":)", pos);
+
+        tids.insert(trace.substr(tid_pos, trace.find(',', tid_pos) - tid_pos));
+    }
+
+    EXPECT_EQ(tids.size(), num_threads);
+}
+
+TEST_F(Trace, MoreEventsThanBuffered)
+{
+    constexpr std::size_t num_zones = 3 * Tracer::buffer_capacity;
+
+    for(std::size_t i = 0; i < num_zones; ++i)
+    {
+        CK_TRACE_ZONE(zone, "test", "zone");
+        zone.AddArg("i", i);
+    }
+
+    const std::string trace = write_trace();
+
+    EXPECT_EQ(count(trace, R"("ph":"X")"), num_zones);
+    EXPECT_EQ(count(trace, "dropped"), 0);
+
+    // in order of recording
+    EXPECT_LT(trace.find(R"("i":0})"), trace.find(R"("i":1})"));
+    EXPECT_LT(trace.find(R"("i":)" + std::to_string(num_zones - 2) + "}"),
+              trace.find(R"("i":)" + std::to_string(num_zones - 1) + "}"));
+}
+
+TEST_F(Trace, MovedEventsLimit)
+{
+    // far more than max_moved_bytes of JSON
+    constexpr std::size_t num_zones = Tracer::max_moved_bytes / 32;
+
+    for(std::size_t i = 0; i < num_zones; ++i)
+    {
+        CK_TRACE_ZONE(zone, "test", "zone");
+        zone.AddArg("i", i);
+    }
+
+    const std::string trace = write_trace();
+
+    const std::size_t num_written = count(trace, R"("ph":"X")");
+
+    EXPECT_LT(trace.size(), Tracer::max_moved_bytes + Tracer::buffer_capacity * 256);
+    EXPECT_LT(num_written, num_zones);
+
+    // the others are counted as dropped
+    const auto pos = trace.find(" events dropped)");
+
+    ASSERT_NE(pos, std::string::npos);
+
+    const auto begin = trace.rfind('(', pos) + 1;
+
+    EXPECT_EQ(num_written + std::stoull(trace.substr(begin, pos - begin)), num_zones);
+}
+
+TEST(TraceEventBuffer, Overflow)
+{
+    ck::trace::EventBuffer buffer{4, 1};
+
+    std::vector<int64_t> timestamps;
+
+    auto f_push = [&](int64_t ts) {
+        ck::trace::Event event;
+
+        event.ts_ns_ = ts;
+
+        return buffer.Push(event);
+    };
+
+    auto f_drain = [&] {
+        timestamps.clear();
+
+        buffer.Drain([&](const ck::trace::Event& event) { timestamps.push_back(event.ts_ns_); });
+    };
+
+    for(int64_t ts = 0; ts < 6; ++ts)
+    {
+        EXPECT_EQ(f_push(ts), ts < 4);
+    }
+
+    EXPECT_EQ(buffer.GetNumDropped(), 2);
+
+    f_drain();
+
+    EXPECT_EQ(timestamps, std::vector<int64_t>({0, 1, 2, 3}));
+
+    // wrapped around
+    EXPECT_TRUE(f_push(6));
+    EXPECT_TRUE(f_push(7));
+
+    f_drain();
+
+    EXPECT_EQ(timestamps, std::vector<int64_t>({6, 7}));
+    EXPECT_EQ(buffer.GetNumDropped(), 2);
+}
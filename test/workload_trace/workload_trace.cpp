@@ -0,0 +1,488 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_recorder.hpp"
+#include "ck/library/utility/workload_trace.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseInvoker;
+using ck::tensor_operation::device::DeviceGemm;
+using ck::tensor_operation::device::instance::DeviceOperationRecorder;
+using ck::utils::WorkloadRecord;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+struct Identity
+{
+};
+
+using DeviceOp = DeviceGemm<Row, Col, Row, float, float, float, Identity, Identity, Identity>;
+
+// CPU stand-in for a GEMM instance: C[m, n] = sum over k of A[m, k] * B[n, k]
+struct DeviceGemmReference : public DeviceOp
+{
+    struct Argument : public BaseArgument
+    {
+        Argument(const float* p_a,
+                 const float* p_b,
+                 float* p_c,
+                 ck::index_t M,
+                 ck::index_t N,
+                 ck::index_t K,
+                 ck::index_t StrideA,
+                 ck::index_t StrideB,
+                 ck::index_t StrideC)
+            : p_a_{p_a},
+              p_b_{p_b},
+              p_c_{p_c},
+              M_{M},
+              N_{N},
+              K_{K},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideC_{StrideC}
+        {
+        }
+
+        const float* p_a_;
+        const float* p_b_;
+        float* p_c_;
+        ck::index_t M_, N_, K_, StrideA_, StrideB_, StrideC_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const BaseArgument* p_arg, const StreamConfig& = StreamConfig{}) override
+        {
+            const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+            for(ck::index_t m = 0; m < arg.M_; ++m)
+            {
+                for(ck::index_t n = 0; n < arg.N_; ++n)
+                {
+                    float c = 0;
+
+                    for(ck::index_t k = 0; k < arg.K_; ++k)
+                    {
+                        c += arg.p_a_[m * arg.StrideA_ + k] * arg.p_b_[n * arg.StrideB_ + k];
+                    }
+
+                    arg.p_c_[m * arg.StrideC_ + n] = c;
+                }
+            }
+
+            return 0.5f;
+        }
+    };
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
+                                                      const void* p_b,
+                                                      void* p_c,
+                                                      ck::index_t M,
+                                                      ck::index_t N,
+                                                      ck::index_t K,
+                                                      ck::index_t StrideA,
+                                                      ck::index_t StrideB,
+                                                      ck::index_t StrideC,
+                                                      Identity,
+                                                      Identity,
+                                                      Identity) override
+    {
+        return std::make_unique<Argument>(static_cast<const float*>(p_a),
+                                          static_cast<const float*>(p_b),
+                                          static_cast<float*>(p_c),
+                                          M,
+                                          N,
+                                          K,
+                                          StrideA,
+                                          StrideB,
+                                          StrideC);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->K_ > 0;
+    }
+
+    std::string GetTypeString() const override { return "DeviceGemmReference"; }
+};
+
+using Scale = ck::tensor_operation::element_wise::Scale;
+
+using ScaleDeviceOp = DeviceGemm<Row, Col, Row, float, float, float, Identity, Identity, Scale>;
+
+// instance of a GEMM with a scaled C that runs nothing, for the parameters of the records
+struct DeviceGemmScaleStub : public ScaleDeviceOp
+{
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void*,
+                                                      const void*,
+                                                      void*,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      Identity,
+                                                      Identity,
+                                                      Scale) override
+    {
+        return std::make_unique<BaseArgument>();
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<BaseInvoker>();
+    }
+
+    bool IsSupportedArgument(const BaseArgument*) override { return true; }
+
+    bool SetElementwiseOps(BaseArgument*, Identity, Identity, Scale) override { return true; }
+
+    std::string GetTypeString() const override { return "DeviceGemmScaleStub"; }
+};
+
+WorkloadRecord
+make_record(std::vector<int64_t> problem, std::string instance, uint64_t instance_id, double time)
+{
+    WorkloadRecord record;
+
+    record.operation_   = "gemm";
+    record.problem_     = std::move(problem);
+    record.instance_    = std::move(instance);
+    record.instance_id_ = instance_id;
+    record.ave_time_ms_ = time;
+
+    return record;
+}
+
+void expect_equal(const WorkloadRecord& a, const WorkloadRecord& b)
+{
+    EXPECT_EQ(a.operation_, b.operation_);
+    EXPECT_EQ(a.problem_, b.problem_);
+    EXPECT_EQ(a.parameters_, b.parameters_);
+    EXPECT_EQ(a.instance_, b.instance_);
+    EXPECT_EQ(a.instance_id_, b.instance_id_);
+    EXPECT_EQ(a.ave_time_ms_, b.ave_time_ms_);
+}
+
+} // namespace
+
+TEST(WorkloadTrace, RoundTrip)
+{
+    std::vector<WorkloadRecord> records{
+        make_record({1, 1, 3840, 4096, 4096, 4096, 4096, 4096}, "instance_a", 0x1234, 0.25),
+        make_record({0, 3, 1, -1, -1, -1, -1, -1}, "", 0xffffffffffffffffull, 0),
+        make_record({}, "instance_b", 0, 1e-3)};
+
+    records[1].parameters_ = {1.5, -0.5};
+
+    const auto decoded = ck::utils::DecodeWorkloadTrace(ck::utils::EncodeWorkloadTrace(records));
+
+    ASSERT_EQ(decoded.size(), records.size());
+
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        expect_equal(decoded[i], records[i]);
+    }
+
+    EXPECT_TRUE(ck::utils::DecodeWorkloadTrace("").empty());
+    EXPECT_TRUE(ck::utils::DecodeWorkloadTrace(ck::utils::EncodeWorkloadTrace({})).empty());
+}
+
+// the strings are written once per segment
+TEST(WorkloadTrace, Compact)
+{
+    const std::string instance(200, 'x');
+
+    std::vector<WorkloadRecord> records;
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        records.push_back(
+            make_record({1, 1, 1024, 1024, 64 * i, 64 * i, 1024, 1024}, instance, 7, 0.1));
+    }
+
+    const std::string bytes = ck::utils::EncodeWorkloadTrace(records);
+
+    EXPECT_LT(bytes.size(), instance.size() + 40 * records.size());
+
+    EXPECT_EQ(ck::utils::DecodeWorkloadTrace(bytes).size(), records.size());
+}
+
+TEST(WorkloadTrace, Segments)
+{
+    const std::vector<WorkloadRecord> records_0{make_record({1, 0, 16}, "instance_a", 1, 1),
+                                                make_record({1, 0, 32}, "instance_b", 2, 2)};
+    const std::vector<WorkloadRecord> records_1{make_record({1, 0, 64}, "instance_b", 2, 3)};
+
+    const auto decoded = ck::utils::DecodeWorkloadTrace(ck::utils::EncodeWorkloadTrace(records_0) +
+                                                        ck::utils::EncodeWorkloadTrace(records_1));
+
+    ASSERT_EQ(decoded.size(), 3);
+
+    expect_equal(decoded[0], records_0[0]);
+    expect_equal(decoded[1], records_0[1]);
+    expect_equal(decoded[2], records_1[0]);
+
+    // as the encoder of a writer flushes them
+    ck::utils::WorkloadTraceEncoder encoder;
+
+    std::string bytes;
+
+    for(const auto& record : records_0)
+    {
+        encoder.Encode(record);
+
+        bytes += encoder.Flush();
+    }
+
+    EXPECT_EQ(bytes, ck::utils::EncodeWorkloadTrace(records_0));
+}
+
+TEST(WorkloadTrace, Malformed)
+{
+    const std::string bytes = ck::utils::EncodeWorkloadTrace(
+        {make_record({1, 1, 3840, 4096, 4096, 4096, 4096, 4096}, "instance_a", 0x1234, 0.25)});
+
+    // cut at an entry boundary, e.g. by a crash, the trace holds the records written before
+    for(std::size_t size = 1; size < bytes.size(); ++size)
+    {
+        try
+        {
+            EXPECT_TRUE(ck::utils::DecodeWorkloadTrace(bytes.substr(0, size)).empty()) << size;
+        }
+        catch(const std::runtime_error&)
+        {
+        }
+    }
+
+    EXPECT_THROW(ck::utils::DecodeWorkloadTrace(bytes.substr(0, 3)), std::runtime_error);
+    EXPECT_THROW(ck::utils::DecodeWorkloadTrace(bytes.substr(0, bytes.size() - 1)),
+                 std::runtime_error);
+
+    EXPECT_THROW(ck::utils::DecodeWorkloadTrace("not a trace"), std::runtime_error);
+    EXPECT_THROW(ck::utils::DecodeWorkloadTrace(bytes + '\x7f'), std::runtime_error);
+    EXPECT_THROW(ck::utils::LoadWorkloadTrace(testing::TempDir() + "/no_such_trace"),
+                 std::runtime_error);
+}
+
+TEST(WorkloadTrace, Plan)
+{
+    const std::vector<WorkloadRecord> records{make_record({1, 0, 16}, "instance_a", 1, 1),
+                                              make_record({1, 0, 32}, "instance_b", 2, 5),
+                                              make_record({1, 0, 16}, "instance_c", 3, 1),
+                                              make_record({1, 0, 16}, "instance_a", 1, 1),
+                                              make_record({1, 0, 64}, "instance_a", 1, 0),
+                                              make_record({1, 0, 64}, "instance_a", 1, 0)};
+
+    const auto items = ck::utils::PlanWorkloadReplay(records);
+
+    ASSERT_EQ(items.size(), 3);
+
+    EXPECT_EQ(items[0].record_.problem_, std::vector<int64_t>({1, 0, 32}));
+    EXPECT_EQ(items[0].num_calls_, 1);
+    EXPECT_EQ(items[0].total_time_ms_, 5);
+
+    EXPECT_EQ(items[1].record_.problem_, std::vector<int64_t>({1, 0, 16}));
+    EXPECT_EQ(items[1].num_calls_, 3);
+    EXPECT_EQ(items[1].total_time_ms_, 3);
+    EXPECT_EQ(items[1].instance_ids_, std::vector<uint64_t>({1, 3}));
+
+    EXPECT_EQ(items[2].record_.problem_, std::vector<int64_t>({1, 0, 64}));
+    EXPECT_EQ(items[2].num_calls_, 2);
+}
+
+TEST(WorkloadTrace, Commands)
+{
+    const auto items = ck::utils::PlanWorkloadReplay(
+        {make_record({1, 1, 3840, 4096, 4096, 4096, 4096, 4096}, "instance_a", 12, 1),
+         make_record({1, 1, 3840, 4096, 4096, 4096, 4096, 4096}, "instance_b", 34, 1)});
+
+    ck::utils::WorkloadReplayOptions options;
+
+    const std::vector<std::string> command{"ckProfiler", "gemm", "1",    "1",    "0",   "1", "0",
+                                           "1",          "3840", "4096", "4096", "4096", "4096",
+                                           "4096"};
+
+    auto commands = ck::utils::MakeWorkloadReplayCommands(items, options);
+
+    ASSERT_EQ(commands.size(), 2);
+
+    EXPECT_EQ(commands[0].back(), "12");
+    EXPECT_EQ(commands[1].back(), "34");
+
+    commands[0].pop_back();
+
+    EXPECT_EQ(commands[0], command);
+
+    options.all_instances_ = true;
+
+    commands = ck::utils::MakeWorkloadReplayCommands(items, options);
+
+    ASSERT_EQ(commands.size(), 1);
+
+    EXPECT_EQ(commands[0], command);
+
+    EXPECT_THROW(ck::utils::MakeWorkloadReplayCommands(
+                     ck::utils::PlanWorkloadReplay({make_record({1}, "instance_a", 12, 1)}),
+                     options),
+                 std::runtime_error);
+}
+
+TEST(WorkloadTrace, Record)
+{
+    const std::string path = testing::TempDir() + "/workload_trace_record.ckwt";
+
+    std::remove(path.c_str());
+
+    constexpr ck::index_t M = 4;
+    constexpr ck::index_t N = 3;
+    constexpr ck::index_t K = 2;
+
+    const std::vector<float> a{1, 2, 3, 4, 5, 6, 7, 8};
+    const std::vector<float> b{1, 0, 0, 1, 1, 1};
+
+    std::vector<float> c(M * N);
+
+    // two runs, each appending a segment
+    for(int run = 0; run < 2; ++run)
+    {
+        ck::utils::WorkloadTraceWriter writer{path};
+
+        auto op_ptr = std::unique_ptr<DeviceOp>{std::make_unique<DeviceOperationRecorder<DeviceOp>>(
+            std::make_unique<DeviceGemmReference>(), writer)};
+
+        EXPECT_EQ(op_ptr->GetTypeString(), "DeviceGemmReference");
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            a.data(), b.data(), c.data(), M, N, K, K, K, N, {}, {}, {});
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()));
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        EXPECT_EQ(invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, true}), 0.5f);
+        EXPECT_EQ(invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false}), 0.5f);
+
+        EXPECT_EQ(c, std::vector<float>({1, 2, 3, 3, 4, 7, 5, 6, 11, 7, 8, 15}));
+    }
+
+    const auto records = ck::utils::LoadWorkloadTrace(path);
+
+    ASSERT_EQ(records.size(), 4);
+
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(records[i].operation_, "gemm");
+        EXPECT_EQ(records[i].problem_, std::vector<int64_t>({0, 1, M, N, K, K, K, N}));
+        EXPECT_EQ(records[i].instance_, "DeviceGemmReference");
+        EXPECT_EQ(records[i].instance_id_, DeviceGemmReference{}.GetInstanceId());
+        EXPECT_EQ(records[i].ave_time_ms_, i % 2 == 0 ? 0.5 : 0);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(WorkloadTrace, RecordParameters)
+{
+    const std::string path = testing::TempDir() + "/workload_trace_record_parameters.ckwt";
+
+    std::remove(path.c_str());
+
+    {
+        ck::utils::WorkloadTraceWriter writer{path};
+
+        auto op_ptr =
+            std::unique_ptr<ScaleDeviceOp>{std::make_unique<DeviceOperationRecorder<ScaleDeviceOp>>(
+                std::make_unique<DeviceGemmScaleStub>(), writer)};
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            nullptr, nullptr, nullptr, 4, 3, 2, 2, 2, 3, {}, {}, Scale{0.5f});
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        invoker_ptr->Run(argument_ptr.get());
+
+        // the record follows the element-wise operations of the argument
+        ASSERT_TRUE(op_ptr->SetElementwiseOps(argument_ptr.get(), {}, {}, Scale{2.f}));
+
+        invoker_ptr->Run(argument_ptr.get());
+    }
+
+    const auto records = ck::utils::LoadWorkloadTrace(path);
+
+    ASSERT_EQ(records.size(), 2);
+
+    EXPECT_EQ(records[0].parameters_, std::vector<double>({0.5}));
+    EXPECT_EQ(records[1].parameters_, std::vector<double>({2}));
+
+    std::remove(path.c_str());
+}
+
+TEST(WorkloadTrace, WriterBuffers)
+{
+    const std::string path = testing::TempDir() + "/workload_trace_writer_buffers.ckwt";
+
+    std::remove(path.c_str());
+
+    const auto record = make_record({1, 0, 16}, "instance_a", 1, 1);
+
+    {
+        ck::utils::WorkloadTraceWriter writer{path};
+
+        writer.Write(record);
+        writer.Write(record);
+
+        EXPECT_TRUE(ck::utils::LoadWorkloadTrace(path).empty());
+
+        writer.Flush();
+
+        EXPECT_EQ(ck::utils::LoadWorkloadTrace(path).size(), 2);
+
+        // written at the latest on destruction
+        writer.Write(record);
+    }
+
+    EXPECT_EQ(ck::utils::LoadWorkloadTrace(path).size(), 3);
+
+    // and once enough bytes are buffered
+    const std::size_t record_size = ck::utils::EncodeWorkloadTrace({record, record}).size() -
+                                    ck::utils::EncodeWorkloadTrace({record}).size();
+    const std::size_t num_records =
+        ck::utils::WorkloadTraceWriter::max_buffered_bytes / record_size + 1;
+
+    {
+        ck::utils::WorkloadTraceWriter writer{path};
+
+        for(std::size_t i = 0; i < num_records; ++i)
+        {
+            writer.Write(record);
+        }
+
+        EXPECT_GT(ck::utils::LoadWorkloadTrace(path).size(), 3);
+    }
+
+    std::remove(path.c_str());
+}
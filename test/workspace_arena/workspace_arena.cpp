@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ck/library/utility/device_memory_pool.hpp"
+#include "ck/library/utility/workspace_arena.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseOperator;
+using ck::utils::HostMemoryAllocator;
+using ck::utils::WorkspaceArena;
+
+// a host allocator counting the bytes it has allocated
+class CountingHostMemoryAllocator : public HostMemoryAllocator
+{
+    public:
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr) override
+    {
+        void* p = HostMemoryAllocator::Allocate(size, stream);
+
+        sizes_.push_back({p, size});
+        bytes_allocated_ += size;
+
+        return p;
+    }
+
+    void Free(void* p) override
+    {
+        for(auto it = sizes_.begin(); it != sizes_.end(); ++it)
+        {
+            if(it->first == p)
+            {
+                bytes_allocated_ -= it->second;
+                sizes_.erase(it);
+                break;
+            }
+        }
+
+        HostMemoryAllocator::Free(p);
+    }
+
+    std::size_t bytes_allocated_ = 0;
+
+    private:
+    std::vector<std::pair<void*, std::size_t>> sizes_;
+};
+
+struct Operator : public BaseOperator
+{
+    explicit Operator(std::size_t workspace_size) : workspace_size_{workspace_size} {}
+
+    std::size_t GetWorkSpaceSize(const BaseArgument*) const override { return workspace_size_; }
+
+    std::size_t workspace_size_;
+};
+
+std::uintptr_t address(void* p) { return reinterpret_cast<std::uintptr_t>(p); }
+
+} // namespace
+
+TEST(WorkspaceArena, Regions)
+{
+    CountingHostMemoryAllocator allocator;
+
+    WorkspaceArena arena{allocator};
+
+    EXPECT_EQ(arena.Reserve(0), nullptr);
+    EXPECT_EQ(arena.GetNumAllocations(), 0);
+
+    void* p0 = arena.Reserve(1000);
+
+    EXPECT_EQ(address(p0) % WorkspaceArena::alignment, 0);
+    EXPECT_EQ(arena.GetCapacity(), 1024);
+
+    arena.Reset();
+
+    // live at the same time: disjoint and aligned
+    std::vector<void*> ps;
+
+    for(std::size_t size : {100, 700, 1})
+    {
+        ps.push_back(arena.Reserve(size));
+    }
+
+    EXPECT_EQ(ps[0], p0);
+    EXPECT_EQ(address(ps[1]) - address(ps[0]), 256);
+    EXPECT_EQ(arena.GetBytesReserved(), 256 + 768 + 256);
+
+    for(void* p : ps)
+    {
+        EXPECT_EQ(address(p) % WorkspaceArena::alignment, 0);
+    }
+
+    for(std::size_t i = 0; i < ps.size(); ++i)
+    {
+        for(std::size_t j = 0; j < i; ++j)
+        {
+            EXPECT_NE(ps[i], ps[j]);
+        }
+    }
+}
+
+TEST(WorkspaceArena, Grow)
+{
+    CountingHostMemoryAllocator allocator;
+
+    {
+        WorkspaceArena arena{allocator};
+
+        arena.Reserve(1024);
+        arena.Reserve(4096);
+
+        // the second region did not fit
+        EXPECT_EQ(arena.GetNumAllocations(), 2);
+        EXPECT_EQ(allocator.bytes_allocated_, 1024 + 4096);
+
+        arena.Reset();
+
+        EXPECT_EQ(arena.GetCapacity(), 1024 + 4096);
+        EXPECT_EQ(allocator.bytes_allocated_, 0);
+
+        // the largest sequence fits from now on
+        for(int i = 0; i < 10; ++i)
+        {
+            arena.Reset();
+
+            arena.Reserve(4096);
+            arena.Reserve(1024);
+        }
+
+        arena.Reset();
+        arena.Reserve(512);
+
+        EXPECT_EQ(arena.GetNumAllocations(), 3);
+        EXPECT_EQ(arena.GetCapacity(), 1024 + 4096);
+        EXPECT_EQ(allocator.bytes_allocated_, 1024 + 4096);
+    }
+
+    EXPECT_EQ(allocator.bytes_allocated_, 0);
+}
+
+TEST(WorkspaceArena, Operators)
+{
+    CountingHostMemoryAllocator allocator;
+
+    WorkspaceArena arena{allocator};
+
+    Operator op0{3000};
+    Operator op1{0};
+
+    BaseArgument arg0;
+    BaseArgument arg1;
+
+    arg1.p_workspace_ = &arg0;
+
+    void* p0 = arena.Reserve(op0, &arg0);
+
+    EXPECT_NE(p0, nullptr);
+    EXPECT_EQ(arg0.p_workspace_, p0);
+
+    // no workspace
+    EXPECT_EQ(arena.Reserve(op1, &arg1), nullptr);
+    EXPECT_EQ(arg1.p_workspace_, nullptr);
+
+    EXPECT_EQ(arena.GetBytesReserved(), 3072);
+
+    arena.Reset();
+
+    EXPECT_EQ(arena.Reserve(op0, &arg1), p0);
+    EXPECT_EQ(arg1.p_workspace_, p0);
+    EXPECT_EQ(arena.GetNumAllocations(), 1);
+}